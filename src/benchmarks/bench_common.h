@@ -0,0 +1,65 @@
+/**
+ * @file bench_common.h
+ * @brief Общие утилиты для бенчмарков контейнеров
+ */
+
+#ifndef S21_BENCH_COMMON_H
+#define S21_BENCH_COMMON_H
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21_bench {
+
+/**
+ * @brief Секундомер на основе steady_clock
+ */
+class Stopwatch {
+ public:
+  Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+  /**
+   * @brief Перезапустить отсчет
+   */
+  void Reset() { start_ = std::chrono::steady_clock::now(); }
+
+  /**
+   * @brief Прошедшее время
+   * @return Время с момента запуска в миллисекундах
+   */
+  double ElapsedMs() const {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Вывести строку результата в едином формате
+ * @param name Название замера
+ * @param ms Время в миллисекундах
+ * @param ops Количество операций (для пересчета в нс/операцию)
+ */
+inline void PrintResult(const std::string &name, double ms, size_t ops) {
+  std::printf("%-44s %10.2f ms %10.2f ns/op\n", name.c_str(), ms,
+              ops ? ms * 1e6 / static_cast<double>(ops) : 0.0);
+}
+
+/**
+ * @brief Не дать компилятору выбросить вычисленное значение
+ * @param value Значение, которое должно считаться использованным
+ */
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_BENCH_COMMON_H
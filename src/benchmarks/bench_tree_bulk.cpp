@@ -0,0 +1,67 @@
+/**
+ * @file bench_tree_bulk.cpp
+ * @brief Бенчмарк массового построения словаря из снимка ключей
+ *
+ * Сравнивает поэлементную вставку с конструктором из диапазона для
+ * отсортированного и перемешанного входа. Размер задается первым аргументом
+ * (по умолчанию 5M, для замера старта большого индекса - 50000000).
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_common.h"
+
+using Row = std::pair<int, int>;
+
+/**
+ * @brief Построить словарь из диапазона и вывести время
+ * @tparam Map Тип словаря
+ * @param label Название замера
+ * @param rows Строки снимка
+ */
+template <typename Map>
+static void BuildFromRange(const std::string &label,
+                           const std::vector<Row> &rows) {
+  s21_bench::Stopwatch timer;
+  auto *map = new Map(rows.begin(), rows.end());
+  s21_bench::PrintResult(label, timer.ElapsedMs(), rows.size());
+  s21_bench::DoNotOptimize(map->size());
+  delete map;
+}
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+  std::vector<Row> rows(n);
+  for (size_t i = 0; i < n; ++i) {
+    rows[i] = {static_cast<int>(i), static_cast<int>(i)};
+  }
+
+  using Map = s21::map<int, int>;
+  using PooledMap = s21::map<int, int, std::less<int>,
+                             std::allocator<std::pair<const int, int>>,
+                             s21::PooledTreePolicy>;
+
+  s21_bench::Stopwatch timer;
+  auto *inserted = new Map();
+  for (const Row &row : rows) inserted->insert(row.first, row.second);
+  s21_bench::PrintResult("sorted, insert one by one", timer.ElapsedMs(), n);
+  delete inserted;
+
+  BuildFromRange<Map>("sorted, range constructor", rows);
+  BuildFromRange<PooledMap>("sorted, range constructor (pool)", rows);
+
+  std::shuffle(rows.begin(), rows.end(), std::mt19937(42));
+  timer.Reset();
+  inserted = new Map();
+  for (const Row &row : rows) inserted->insert(row.first, row.second);
+  s21_bench::PrintResult("shuffled, insert one by one", timer.ElapsedMs(), n);
+  delete inserted;
+
+  BuildFromRange<Map>("shuffled, range constructor", rows);
+  return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file bench_tree_churn.cpp
+ * @brief Бенчмарк удаления: высота дерева при чередовании вставок и удалений
+ *
+ * Выполняет миллионы случайных вставок и удалений и после каждого миллиона
+ * операций проверяет, что высота дерева не превышает 2 * log2(n + 1).
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "bench_common.h"
+
+using Tree = s21::RBTree<int, int>;
+
+/**
+ * @brief Высота дерева без рекурсии
+ * @param root Корень дерева
+ * @return Количество узлов на самом длинном пути от корня до листа
+ */
+static size_t TreeHeight(Tree::RBTreeNode *root) {
+  std::vector<std::pair<Tree::RBTreeNode *, size_t>> stack;
+  size_t height = 0;
+  if (root) stack.push_back({root, 1});
+  while (!stack.empty()) {
+    auto [node, depth] = stack.back();
+    stack.pop_back();
+    if (depth > height) height = depth;
+    if (node->left) stack.push_back({node->left, depth + 1});
+    if (node->right) stack.push_back({node->right, depth + 1});
+  }
+  return height;
+}
+
+int main() {
+  const size_t kOps = 8000000;
+  const size_t kReport = 1000000;
+  const int kKeyRange = 1 << 20;
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> key_dist(0, kKeyRange - 1);
+  Tree tree;
+  bool ok = true;
+
+  std::printf("%12s %12s %8s %8s\n", "ops", "size", "height", "bound");
+  s21_bench::Stopwatch timer;
+  for (size_t op = 1; op <= kOps; ++op) {
+    int key = key_dist(gen);
+    // Доля удалений растет со временем, чтобы дерево и росло, и сжималось
+    if (gen() % 100 < (op < kOps / 2 ? 40u : 60u)) {
+      tree.remove(key);
+    } else {
+      tree.insert(key, static_cast<int>(op));
+    }
+    if (op % kReport == 0) {
+      double elapsed = timer.ElapsedMs();
+      size_t height = TreeHeight(tree.root);
+      double bound = 2 * std::log2(static_cast<double>(tree.size()) + 1);
+      std::printf("%12zu %12zu %8zu %8.1f\n", op, tree.size(), height, bound);
+      if (static_cast<double>(height) > bound) ok = false;
+      timer.Reset();
+      s21_bench::PrintResult("mixed insert/remove", elapsed, kReport);
+    }
+  }
+
+  std::printf("height bound %s\n", ok ? "holds" : "VIOLATED");
+  return ok ? 0 : 1;
+}
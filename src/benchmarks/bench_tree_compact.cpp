@@ -0,0 +1,137 @@
+/**
+ * @file bench_tree_compact.cpp
+ * @brief Бенчмарк компактных узлов: цвет в бите указателя на родителя
+ *
+ * Для ключей int и uint64_t сравниваются обычный и компактный узел, каждый
+ * с глобальным new/delete и с пулом узлов. Память считает аллокатор-счетчик:
+ * выводится число запрошенных байт на элемент. Без пула glibc malloc
+ * округляет блоки до 16 байт и добавляет свой заголовок, поэтому узлы в
+ * 32 и 40 байт занимают одинаковые 48; выигрыш виден только в слэбах пула.
+ * Затем замеряется поиск случайных ключей. Размер задается первым
+ * аргументом (по умолчанию 1M), второй аргумент - число повторов поиска
+ * (по умолчанию 3), выводится лучшее время.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+size_t allocated_bytes = 0;  ///< Байты, выданные CountingAllocator
+
+/**
+ * @brief Аллокатор, подсчитывающий выданную память
+ * @tparam T Тип элемента
+ */
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+  T *allocate(size_t n) {
+    allocated_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) noexcept {
+    allocated_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+/// Пул узлов вместе с компактными узлами
+struct PooledCompactPolicy : s21::PooledTreePolicy {
+  static constexpr bool compact_nodes = true;
+};
+
+/**
+ * @brief Замерить память на элемент и поиск
+ * @tparam Key Тип ключа
+ * @tparam Policy Политика дерева
+ * @param label Название конфигурации
+ * @param keys Ключи в порядке вставки
+ * @param probes Ключи для поиска
+ * @param repeats Число повторов поиска
+ */
+template <typename Key, typename Policy>
+void Run(const std::string &label, const std::vector<Key> &keys,
+         const std::vector<Key> &probes, size_t repeats) {
+  using Map = s21::map<Key, Key, std::less<Key>,
+                       CountingAllocator<std::pair<const Key, Key>>, Policy>;
+  const size_t before = allocated_bytes;
+  {
+    Map map;
+    for (Key key : keys) map.insert(key, key);
+    std::printf("%-44s node %3zu B, %6.1f B/elem\n",
+                (label + ", memory").c_str(),
+                sizeof(typename Map::RBTreeNode),
+                static_cast<double>(allocated_bytes - before) / map.size());
+
+    double best = 0;
+    for (size_t i = 0; i < repeats; ++i) {
+      Key sum = 0;
+      s21_bench::Stopwatch timer;
+      for (Key probe : probes) {
+        auto it = map.find(probe);
+        if (it != map.end()) sum += it->second;
+      }
+      double ms = timer.ElapsedMs();
+      if (i == 0 || ms < best) best = ms;
+      s21_bench::DoNotOptimize(sum);
+    }
+    s21_bench::PrintResult(label + ", find", best, probes.size());
+  }
+}
+
+/**
+ * @brief Прогнать все конфигурации для одного типа ключа
+ * @tparam Key Тип ключа
+ * @param name Название типа ключа
+ * @param n Число элементов
+ * @param repeats Число повторов поиска
+ */
+template <typename Key>
+void RunKey(const std::string &name, size_t n, size_t repeats) {
+  std::vector<Key> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<Key>(i * 2);
+  std::mt19937_64 gen(42);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  std::vector<Key> probes(n);
+  for (auto &probe : probes) probe = static_cast<Key>(gen() % (n * 2));
+
+  Run<Key, s21::DefaultTreePolicy>(name + " default", keys, probes, repeats);
+  Run<Key, s21::CompactTreePolicy>(name + " compact", keys, probes, repeats);
+  Run<Key, s21::PooledTreePolicy>(name + " pooled", keys, probes, repeats);
+  Run<Key, PooledCompactPolicy>(name + " pooled compact", keys, probes,
+                                repeats);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+  RunKey<int>("int", n, repeats);
+  RunKey<std::uint64_t>("uint64_t", n, repeats);
+  return 0;
+}
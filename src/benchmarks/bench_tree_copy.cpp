@@ -0,0 +1,79 @@
+/**
+ * @file bench_tree_copy.cpp
+ * @brief Бенчмарк копирования и разрушения больших деревьев
+ *
+ * Исходный map строится вставкой ключей в случайном порядке, поэтому его
+ * узлы лежат в памяти вразброс. Замеряются конструктор копирования,
+ * полный обход копии и ее разрушение; для сравнения те же замеры для
+ * std::map. Размер задается первым аргументом (по умолчанию 10M), второй
+ * аргумент - число повторов (по умолчанию 3), выводится лучшее время.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+/**
+ * @brief Замерить копирование, обход и разрушение копии
+ * @tparam Map Тип словаря
+ * @param label Название контейнера
+ * @param source Копируемый словарь
+ * @param repeats Число повторов
+ */
+template <typename Map>
+void Run(const std::string &label, const Map &source, size_t repeats) {
+  double copy = 0;
+  double scan = 0;
+  double destroy = 0;
+  for (size_t i = 0; i < repeats; ++i) {
+    s21_bench::Stopwatch timer;
+    auto *clone = new Map(source);
+    double ms = timer.ElapsedMs();
+    if (i == 0 || ms < copy) copy = ms;
+
+    long sum = 0;
+    timer.Reset();
+    for (const auto &item : *clone) sum += item.second;
+    ms = timer.ElapsedMs();
+    if (i == 0 || ms < scan) scan = ms;
+    s21_bench::DoNotOptimize(sum);
+
+    timer.Reset();
+    delete clone;
+    ms = timer.ElapsedMs();
+    if (i == 0 || ms < destroy) destroy = ms;
+  }
+  s21_bench::PrintResult(label + ", copy construct", copy, source.size());
+  s21_bench::PrintResult(label + ", scan copy", scan, source.size());
+  s21_bench::PrintResult(label + ", destroy copy", destroy, source.size());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+  std::vector<long> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<long>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+
+  {
+    s21::map<long, long> source;
+    for (long key : keys) source.insert(key, key);
+    Run("s21::map", source, repeats);
+  }
+  {
+    std::map<long, long> source;
+    for (long key : keys) source.emplace(key, key);
+    Run("std::map", source, repeats);
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file bench_tree_find_many.cpp
+ * @brief Бенчмарк пакетного поиска find_many/contains_many против цикла find
+ *
+ * Дерево из ключей, вставленных в случайном порядке, намного больше
+ * последнего уровня кеша (по умолчанию 4M элементов, около 160 МБ узлов),
+ * поэтому почти каждый уровень спуска - промах кеша. Пробы - случайные
+ * ключи, половина из них отсутствует в дереве. Размер задается первым
+ * аргументом, второй аргумент - число повторов (по умолчанию 3),
+ * выводится лучшее время.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+/**
+ * @brief Замерить лучший из повторов прогон функции
+ * @param label Название замера
+ * @param ops Число операций за прогон
+ * @param repeats Число повторов
+ * @param body Замеряемая функция, возвращает контрольную сумму
+ */
+void Measure(const std::string &label, size_t ops, size_t repeats,
+             const std::function<long()> &body) {
+  double best = 0;
+  for (size_t i = 0; i < repeats; ++i) {
+    s21_bench::Stopwatch timer;
+    long sum = body();
+    double ms = timer.ElapsedMs();
+    if (i == 0 || ms < best) best = ms;
+    s21_bench::DoNotOptimize(sum);
+  }
+  s21_bench::PrintResult(label, best, ops);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+  std::vector<long> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<long>(i * 2);
+  std::mt19937_64 gen(42);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  std::vector<long> probes(n);
+  for (auto &probe : probes) probe = static_cast<long>(gen() % (n * 2));
+
+  s21::map<long, long> map;
+  for (long key : keys) map.insert(key, key);
+  using Iterator = s21::map<long, long>::const_iterator;
+  const auto &view = map;
+
+  std::vector<Iterator> found(probes.size());
+  Measure("map find loop", probes.size(), repeats, [&] {
+    long sum = 0;
+    for (size_t i = 0; i < probes.size(); ++i) {
+      found[i] = view.find(probes[i]);
+      if (found[i] != view.end()) sum += found[i]->second;
+    }
+    return sum;
+  });
+  Measure("map find_many", probes.size(), repeats, [&] {
+    view.find_many(probes.begin(), probes.end(), found.begin());
+    long sum = 0;
+    for (const auto &it : found) {
+      if (it != view.end()) sum += it->second;
+    }
+    return sum;
+  });
+
+  std::vector<char> present(probes.size());
+  Measure("map contains loop", probes.size(), repeats, [&] {
+    for (size_t i = 0; i < probes.size(); ++i) {
+      present[i] = view.contains(probes[i]);
+    }
+    return static_cast<long>(std::count(present.begin(), present.end(), 1));
+  });
+  Measure("map contains_many", probes.size(), repeats, [&] {
+    view.contains_many(probes.begin(), probes.end(), present.begin());
+    return static_cast<long>(std::count(present.begin(), present.end(), 1));
+  });
+  return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file bench_tree_frozen.cpp
+ * @brief Бенчмарк поиска во frozen_set/frozen_map против дерева
+ *
+ * Множество и словарь строятся вставкой ключей в случайном порядке, затем
+ * замораживаются. Сравниваются contains/find дерева, снимка и
+ * std::lower_bound по отсортированному массиву (та же память, но двоичный
+ * поиск без раскладки). Половина проб отсутствует. Размер задается первым
+ * аргументом (по умолчанию 4M), второй аргумент - число повторов (по
+ * умолчанию 3), выводится лучшее время.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+/**
+ * @brief Замерить лучший из повторов прогон функции
+ * @param label Название замера
+ * @param ops Число операций за прогон
+ * @param repeats Число повторов
+ * @param body Замеряемая функция, возвращает контрольную сумму
+ */
+void Measure(const std::string &label, size_t ops, size_t repeats,
+             const std::function<long()> &body) {
+  double best = 0;
+  for (size_t i = 0; i < repeats; ++i) {
+    s21_bench::Stopwatch timer;
+    long sum = body();
+    double ms = timer.ElapsedMs();
+    if (i == 0 || ms < best) best = ms;
+    s21_bench::DoNotOptimize(sum);
+  }
+  s21_bench::PrintResult(label, best, ops);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i * 2);
+  std::mt19937_64 gen(42);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  std::vector<int> probes(n);
+  for (auto &probe : probes) probe = static_cast<int>(gen() % (n * 2));
+
+  s21::set<int> set;
+  s21::map<int, int> map;
+  for (int key : keys) {
+    set.insert(key);
+    map.insert(key, key);
+  }
+
+  s21_bench::Stopwatch timer;
+  s21::frozen_set<int> frozenSet = set.freeze();
+  s21_bench::PrintResult("set freeze", timer.ElapsedMs(), n);
+  timer.Reset();
+  s21::frozen_map<int, int> frozenMap = map.freeze();
+  s21_bench::PrintResult("map freeze", timer.ElapsedMs(), n);
+  std::vector<int> sorted(set.begin(), set.end());
+
+  Measure("set contains", n, repeats, [&] {
+    long found = 0;
+    for (int probe : probes) found += set.contains(probe);
+    return found;
+  });
+  Measure("frozen_set contains", n, repeats, [&] {
+    long found = 0;
+    for (int probe : probes) found += frozenSet.contains(probe);
+    return found;
+  });
+  Measure("sorted vector binary search", n, repeats, [&] {
+    long found = 0;
+    for (int probe : probes) {
+      found += std::binary_search(sorted.begin(), sorted.end(), probe);
+    }
+    return found;
+  });
+
+  const auto &view = map;
+  Measure("map find", n, repeats, [&] {
+    long sum = 0;
+    for (int probe : probes) {
+      auto it = view.find(probe);
+      if (it != view.end()) sum += it->second;
+    }
+    return sum;
+  });
+  Measure("frozen_map find", n, repeats, [&] {
+    long sum = 0;
+    for (int probe : probes) {
+      auto it = frozenMap.find(probe);
+      if (it != frozenMap.end()) sum += it.value();
+    }
+    return sum;
+  });
+  Measure("frozen_map lower_bound", n, repeats, [&] {
+    long sum = 0;
+    for (int probe : probes) {
+      auto it = frozenMap.lower_bound(probe);
+      if (it != frozenMap.end()) sum += it.key();
+    }
+    return sum;
+  });
+
+  Measure("map full scan", n, repeats, [&] {
+    long sum = 0;
+    for (const auto &item : view) sum += item.second;
+    return sum;
+  });
+  Measure("frozen_map full scan", n, repeats, [&] {
+    long sum = 0;
+    for (auto it = frozenMap.begin(); it != frozenMap.end(); ++it) {
+      sum += it.value();
+    }
+    return sum;
+  });
+  return 0;
+}
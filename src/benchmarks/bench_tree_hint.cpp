@@ -0,0 +1,79 @@
+/**
+ * @file bench_tree_hint.cpp
+ * @brief Бенчмарк вставки почти отсортированных ключей с подсказкой
+ *
+ * Ключи - возрастающие отметки времени, часть из которых (второй аргумент,
+ * в процентах, по умолчанию 5) приходит с небольшим опозданием. Сравнивает
+ * insert без подсказки, insert(end(), value) и emplace_hint(end(), ...) для
+ * map, set и multiset. Размер задается первым аргументом (по умолчанию 2M).
+ */
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+/**
+ * @brief Заполнить контейнер и вывести время
+ * @tparam Container Тип контейнера
+ * @tparam Insert Функция insert(container, key)
+ * @param label Название замера
+ * @param keys Ключи в порядке поступления
+ * @param insert Способ вставки
+ */
+template <typename Container, typename Insert>
+static void Fill(const std::string &label, const std::vector<long> &keys,
+                 Insert insert) {
+  auto *container = new Container();
+  s21_bench::Stopwatch timer;
+  for (long key : keys) insert(*container, key);
+  s21_bench::PrintResult(label, timer.ElapsedMs(), keys.size());
+  s21_bench::DoNotOptimize(container->size());
+  delete container;
+}
+
+/**
+ * @brief Замерить три способа вставки для одного набора ключей
+ * @param title Название набора ключей
+ * @param keys Ключи в порядке поступления
+ */
+static void Run(const std::string &title, const std::vector<long> &keys) {
+  using Map = s21::map<long, long>;
+  using Set = s21::set<long>;
+  using Multiset = s21::multiset<long>;
+
+  Fill<Map>(title + ", map insert", keys,
+            [](Map &m, long key) { m.insert(key, key); });
+  Fill<Map>(title + ", map insert(end)", keys,
+            [](Map &m, long key) { m.insert(m.cend(), {key, key}); });
+  Fill<Map>(title + ", map emplace_hint(end)", keys,
+            [](Map &m, long key) { m.emplace_hint(m.cend(), key, key); });
+  Fill<Set>(title + ", set insert", keys,
+            [](Set &s, long key) { s.insert(key); });
+  Fill<Set>(title + ", set insert(end)", keys,
+            [](Set &s, long key) { s.insert(s.cend(), key); });
+  Fill<Multiset>(title + ", multiset insert", keys,
+                 [](Multiset &s, long key) { s.insert(key); });
+  Fill<Multiset>(title + ", multiset insert(end)", keys,
+                 [](Multiset &s, long key) { s.insert(s.cend(), key); });
+}
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+  const unsigned late = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5;
+
+  std::vector<long> sorted(n);
+  std::vector<long> nearly(n);
+  std::mt19937 gen(42);
+  for (size_t i = 0; i < n; ++i) {
+    sorted[i] = static_cast<long>(i);
+    long delay = gen() % 100 < late ? static_cast<long>(gen() % 64) : 0;
+    nearly[i] = static_cast<long>(i) * 4 - delay;
+  }
+
+  Run("sorted", sorted);
+  Run("nearly sorted", nearly);
+  return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file bench_tree_parallel.cpp
+ * @brief Бенчмарк масштабирования параллельных операций над множествами
+ *
+ * Для 1, 2, 4, ... потоков (до числа ядер или третьего аргумента) замеряет
+ * parallel_union, parallel_intersection, parallel_difference и
+ * parallel_insert на двух множествах по n ключей с пересечением около
+ * половины. Размер задается первым аргументом (по умолчанию 1000000), второй
+ * аргумент - число повторов каждого замера (по умолчанию 3). Копии входных
+ * множеств готовятся вне секундомера.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers/tree/tree_parallel.h"
+#include "bench_common.h"
+
+namespace {
+
+using Set = s21::set<long>;
+
+/**
+ * @brief Замерить операцию над копиями множеств
+ * @param name Название замера
+ * @param threads Число потоков
+ * @param repeats Число повторов, выводится лучшее время
+ * @param left Левый операнд, копируется перед каждым повтором
+ * @param right Правый операнд, копируется перед каждым повтором
+ * @param op Операция op(left, right, pool)
+ */
+template <typename Op>
+void Measure(const std::string &name, size_t threads, size_t repeats,
+             const Set &left, const Set &right, Op op) {
+  s21::TaskPool pool(threads);
+  double best = 0;
+  for (size_t i = 0; i < repeats; ++i) {
+    Set target(left);
+    Set operand(right);
+    s21_bench::Stopwatch timer;
+    op(target, operand, pool);
+    double ms = timer.ElapsedMs();
+    s21_bench::DoNotOptimize(target.size());
+    if (i == 0 || ms < best) best = ms;
+  }
+  s21_bench::PrintResult(name + ", threads: " + std::to_string(threads),
+                         best, left.size() + right.size());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+  const size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+  const size_t max_threads =
+      argc > 3 ? std::strtoull(argv[3], nullptr, 10) : cores;
+
+  std::mt19937_64 gen(42);
+  std::vector<long> keys(n);
+  std::vector<long> delta(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = static_cast<long>(gen() % (3 * n));
+    delta[i] = static_cast<long>(gen() % (3 * n));
+  }
+  const Set left(keys.begin(), keys.end());
+  const Set right(delta.begin(), delta.end());
+
+  std::vector<size_t> counts;
+  for (size_t threads = 1; threads < max_threads; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(max_threads);
+
+  for (size_t threads : counts) {
+    Measure("union", threads, repeats, left, right,
+            [](Set &a, Set &b, s21::TaskPool &pool) {
+              a.parallel_union(std::move(b), pool);
+            });
+  }
+  for (size_t threads : counts) {
+    Measure("intersection", threads, repeats, left, right,
+            [](Set &a, Set &b, s21::TaskPool &pool) {
+              a.parallel_intersection(std::move(b), pool);
+            });
+  }
+  for (size_t threads : counts) {
+    Measure("difference", threads, repeats, left, right,
+            [](Set &a, Set &b, s21::TaskPool &pool) {
+              a.parallel_difference(std::move(b), pool);
+            });
+  }
+  for (size_t threads : counts) {
+    Measure("bulk insert", threads, repeats, left, right,
+            [&delta](Set &a, Set &, s21::TaskPool &pool) {
+              a.parallel_insert(delta.begin(), delta.end(), pool);
+            });
+  }
+  return 0;
+}
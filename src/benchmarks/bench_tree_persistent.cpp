@@ -0,0 +1,119 @@
+/**
+ * @file bench_tree_persistent.cpp
+ * @brief Бенчмарк снимков persistent_map против глубокого копирования map
+ *
+ * В словарь из n элементов (по умолчанию 1M) раунд за раундом берется
+ * снимок, после чего выполняется серия обновлений случайных ключей. Для
+ * s21::map снимок - конструктор копирования, для persistent_map - вызов
+ * snapshot(). Замеряются время снимка, время обновлений и память,
+ * которую удерживают все снимки сверх текущей версии. Память считают
+ * замещенные operator new/delete. Аргументы: n, число раундов (по
+ * умолчанию 20), число обновлений в раунде (по умолчанию 1000).
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+size_t live_bytes = 0;  ///< Байты, выделенные и еще не освобожденные
+
+}  // namespace
+
+void *operator new(size_t size) {
+  void *memory = std::malloc(size + sizeof(std::max_align_t));
+  if (memory == nullptr) throw std::bad_alloc();
+  *static_cast<size_t *>(memory) = size;
+  live_bytes += size;
+  return static_cast<char *>(memory) + sizeof(std::max_align_t);
+}
+
+void operator delete(void *memory) noexcept {
+  if (memory == nullptr) return;
+  void *block = static_cast<char *>(memory) - sizeof(std::max_align_t);
+  live_bytes -= *static_cast<size_t *>(block);
+  std::free(block);
+}
+
+void operator delete(void *memory, size_t) noexcept { operator delete(memory); }
+
+namespace {
+
+/**
+ * @brief Прогнать раунды снимков и обновлений
+ * @tparam Map Тип словаря
+ * @tparam Snapshot Тип снимка
+ * @param label Название контейнера
+ * @param map Заполненный словарь
+ * @param take Функция, делающая снимок
+ * @param rounds Число раундов
+ * @param updates Число обновлений в раунде
+ */
+template <typename Map, typename Snapshot, typename Take>
+void Run(const std::string &label, Map &map, Take take, size_t rounds,
+         size_t updates) {
+  std::mt19937_64 gen(7);
+  const size_t n = map.size();
+  std::vector<Snapshot> snapshots;
+  snapshots.reserve(rounds);
+  const size_t base = live_bytes;
+  double snapshot = 0;
+  double update = 0;
+  for (size_t round = 0; round < rounds; ++round) {
+    s21_bench::Stopwatch timer;
+    snapshots.push_back(take(map));
+    snapshot += timer.ElapsedMs();
+
+    timer.Reset();
+    for (size_t i = 0; i < updates; ++i) {
+      map.insert_or_assign(static_cast<long>(gen() % n),
+                           static_cast<long>(round));
+    }
+    update += timer.ElapsedMs();
+  }
+  const double retained =
+      static_cast<double>(live_bytes - base) / static_cast<double>(rounds);
+  s21_bench::PrintResult(label + ", snapshot", snapshot, rounds);
+  s21_bench::PrintResult(label + ", update", update, rounds * updates);
+  std::printf("%-44s %10.0f B/snapshot %8.1f B/update\n",
+              (label + ", retained memory").c_str(), retained,
+              retained / static_cast<double>(updates));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  const size_t rounds = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20;
+  const size_t updates =
+      argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1000;
+
+  {
+    s21::map<long, long> map;
+    for (size_t i = 0; i < n; ++i) map.insert(static_cast<long>(i), 0);
+    std::printf("%-44s %10zu B\n", "s21::map, base size", live_bytes);
+    Run<s21::map<long, long>, s21::map<long, long>>(
+        "s21::map deep copy", map,
+        [](const s21::map<long, long> &source) { return source; }, rounds,
+        updates);
+  }
+  {
+    s21::persistent_map<long, long> map;
+    for (size_t i = 0; i < n; ++i) map.insert(static_cast<long>(i), 0);
+    std::printf("%-44s %10zu B\n", "persistent_map, base size", live_bytes);
+    Run<s21::persistent_map<long, long>,
+        s21::persistent_map_snapshot<long, long>>(
+        "persistent_map", map,
+        [](const s21::persistent_map<long, long> &source) {
+          return source.snapshot();
+        },
+        rounds, updates);
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file bench_tree_pool.cpp
+ * @brief Бенчмарк пула узлов: глобальные new/delete против слэбов NodePool
+ *
+ * Для обеих политик измеряет вставку случайных ключей, удаление половины
+ * элементов, повторную вставку в освободившиеся узлы и разрушение дерева.
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+/**
+ * @brief Прогнать все замеры для одной политики дерева
+ * @tparam Policy Политика дерева
+ * @param label Название политики в отчете
+ * @param keys Ключи в порядке вставки
+ */
+template <typename Policy>
+static void Run(const std::string &label, const std::vector<int> &keys) {
+  using Map = s21::map<int, int, std::less<int>,
+                       std::allocator<std::pair<const int, int>>, Policy>;
+  const size_t n = keys.size();
+  s21_bench::Stopwatch timer;
+
+  auto *tree = new Map();
+  timer.Reset();
+  for (size_t i = 0; i < n; ++i) tree->insert(keys[i], static_cast<int>(i));
+  s21_bench::PrintResult(label + " insert", timer.ElapsedMs(), n);
+
+  timer.Reset();
+  for (size_t i = 0; i < n; i += 2) tree->erase(tree->find(keys[i]));
+  s21_bench::PrintResult(label + " erase", timer.ElapsedMs(), n / 2);
+
+  timer.Reset();
+  for (size_t i = 0; i < n; i += 2) tree->insert(keys[i], 0);
+  s21_bench::PrintResult(label + " reinsert", timer.ElapsedMs(), n / 2);
+  s21_bench::DoNotOptimize(tree->size());
+
+  timer.Reset();
+  delete tree;
+  s21_bench::PrintResult(label + " teardown", timer.ElapsedMs(), n);
+
+  // Многократное наполнение и очистка одного и того же дерева
+  Map reused;
+  const size_t kRounds = 20;
+  const size_t batch = n / kRounds;
+  timer.Reset();
+  for (size_t round = 0; round < kRounds; ++round) {
+    for (size_t i = 0; i < batch; ++i) reused.insert(keys[i], 0);
+    reused.clear();
+  }
+  s21_bench::PrintResult(label + " fill+clear", timer.ElapsedMs(),
+                         batch * kRounds);
+}
+
+int main() {
+  const size_t kElements = 1000000;
+  std::vector<int> keys(kElements);
+  for (size_t i = 0; i < kElements; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+
+  Run<s21::DefaultTreePolicy>("new/delete", keys);
+  Run<s21::PooledTreePolicy>("NodePool", keys);
+  return 0;
+}
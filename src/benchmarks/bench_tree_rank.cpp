@@ -0,0 +1,78 @@
+/**
+ * @file bench_tree_rank.cpp
+ * @brief Бенчмарк порядковой статистики: rank() и nth() против обхода
+ *
+ * Сравнивает поиск позиции ключа и k-го элемента через веса поддеревьев с
+ * линейным проходом итератором. Размер задается первым аргументом (по
+ * умолчанию 100000), число запросов - вторым (по умолчанию 500).
+ */
+
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bench_common.h"
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+  const size_t queries =
+      argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 500;
+
+  using Map = s21::map<int, int>;
+  using RankedMap = s21::map<int, int, std::less<int>,
+                             std::allocator<std::pair<const int, int>>,
+                             s21::OrderStatisticTreePolicy>;
+
+  std::mt19937 gen(42);
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(gen());
+  std::vector<int> probes(queries);
+  for (size_t i = 0; i < queries; ++i) probes[i] = keys[gen() % n];
+
+  s21_bench::Stopwatch timer;
+  Map plain;
+  for (int key : keys) plain.insert(key, key);
+  s21_bench::PrintResult("insert, plain", timer.ElapsedMs(), n);
+
+  timer.Reset();
+  RankedMap ranked;
+  for (int key : keys) ranked.insert(key, key);
+  s21_bench::PrintResult("insert, order statistics", timer.ElapsedMs(), n);
+
+  timer.Reset();
+  for (int probe : probes) {
+    size_t rank = 0;
+    for (auto it = plain.begin(); it != plain.end() && (*it).first < probe;
+         ++it) {
+      ++rank;
+    }
+    s21_bench::DoNotOptimize(rank);
+  }
+  s21_bench::PrintResult("rank, linear scan", timer.ElapsedMs(), queries);
+
+  timer.Reset();
+  for (int probe : probes) s21_bench::DoNotOptimize(ranked.rank(probe));
+  s21_bench::PrintResult("rank, rank()", timer.ElapsedMs(), queries);
+
+  timer.Reset();
+  for (size_t i = 0; i < queries; ++i) {
+    auto it = plain.begin();
+    for (size_t k = gen() % plain.size(); k > 0; --k) ++it;
+    s21_bench::DoNotOptimize((*it).first);
+  }
+  s21_bench::PrintResult("nth, linear advance", timer.ElapsedMs(), queries);
+
+  timer.Reset();
+  for (size_t i = 0; i < queries; ++i) {
+    s21_bench::DoNotOptimize((*ranked.nth(gen() % ranked.size())).first);
+  }
+  s21_bench::PrintResult("nth, nth()", timer.ElapsedMs(), queries);
+
+  timer.Reset();
+  for (int probe : probes) {
+    s21_bench::DoNotOptimize(ranked.find(probe) - ranked.begin());
+  }
+  s21_bench::PrintResult("iterator difference", timer.ElapsedMs(), queries);
+  return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file bench_tree_thread.cpp
+ * @brief Бенчмарк обхода прошитого дерева против подъема по родителям
+ *
+ * Ключи вставляются в случайном порядке, поэтому соседние по ключу узлы
+ * лежат в памяти вразброс. Для map с DefaultTreePolicy и ThreadedTreePolicy
+ * замеряется полный прямой и обратный обход (лучший из повторов) и
+ * задержка одного шага итератора: медиана, 99-й перцентиль и максимум.
+ * Задержка шага включает вызов steady_clock, одинаковый для обеих политик.
+ * Размер задается первым аргументом (по умолчанию 1M), второй аргумент -
+ * число повторов обхода (по умолчанию 5).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+namespace {
+
+/**
+ * @brief Замерить полный обход и задержку шага
+ * @tparam Map Тип словаря
+ * @param label Название политики
+ * @param keys Ключи в порядке вставки
+ * @param repeats Число повторов полного обхода
+ */
+template <typename Map>
+void Run(const std::string &label, const std::vector<long> &keys,
+         size_t repeats) {
+  Map map;
+  for (long key : keys) map.insert(key, key);
+
+  double forward = 0;
+  double backward = 0;
+  for (size_t i = 0; i < repeats; ++i) {
+    long sum = 0;
+    s21_bench::Stopwatch timer;
+    for (auto it = map.cbegin(); it != map.cend(); ++it) sum += it->second;
+    double ms = timer.ElapsedMs();
+    if (i == 0 || ms < forward) forward = ms;
+    s21_bench::DoNotOptimize(sum);
+
+    timer.Reset();
+    for (auto it = map.crbegin(); it != map.crend(); ++it) sum -= it->second;
+    ms = timer.ElapsedMs();
+    if (i == 0 || ms < backward) backward = ms;
+    s21_bench::DoNotOptimize(sum);
+  }
+  s21_bench::PrintResult(label + ", full scan", forward, map.size());
+  s21_bench::PrintResult(label + ", reverse scan", backward, map.size());
+
+  std::vector<double> steps;
+  steps.reserve(map.size());
+  auto it = map.cbegin();
+  for (size_t i = 0; i < map.size(); ++i) {
+    auto start = std::chrono::steady_clock::now();
+    ++it;
+    auto stop = std::chrono::steady_clock::now();
+    steps.push_back(
+        std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  s21_bench::DoNotOptimize(it);
+  std::sort(steps.begin(), steps.end());
+  std::printf("%-44s p50 %7.1f ns p99 %7.1f ns max %9.1f ns\n",
+              (label + ", step latency").c_str(), steps[steps.size() / 2],
+              steps[steps.size() * 99 / 100], steps.back());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  const size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+
+  std::vector<long> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<long>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+
+  using Walking = s21::map<long, long>;
+  using Threaded = s21::map<long, long, std::less<long>,
+                            std::allocator<std::pair<const long, long>>,
+                            s21::ThreadedTreePolicy>;
+  Run<Walking>("parent walk", keys, repeats);
+  Run<Threaded>("threaded", keys, repeats);
+  return 0;
+}
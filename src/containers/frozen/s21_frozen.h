@@ -0,0 +1,359 @@
+/**
+ * @file s21_frozen.h
+ * @brief Заголовочный файл для frozen_set и frozen_map - неизменяемых
+ * снимков множества и словаря с поиском по массиву в порядке Эйтцингера
+ */
+
+#ifndef S21_FROZEN_H
+#define S21_FROZEN_H
+
+namespace s21 {
+
+/**
+ * @brief Ключи, разложенные в порядке Эйтцингера, и поиск по ним
+ * @details Ключи лежат в массиве в порядке обхода в ширину полного
+ * бинарного дерева поиска: у слота k (нумерация с 1) потомки 2k и 2k + 1.
+ * Верхние уровни, через которые проходит каждый поиск, занимают несколько
+ * соседних кеш-линий, а спуск не читает указателей. Слот 0 означает конец
+ * @tparam Key Тип ключа
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename Compare>
+class FrozenIndex {
+ public:
+  using key_type = Key;
+  using key_compare = Compare;
+  using size_type = size_t;
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  key_compare key_comp() const { return comp_; }
+
+ protected:
+  FrozenIndex() = default;
+  explicit FrozenIndex(const Compare& comp) : comp_(comp) {}
+
+  /**
+   * @brief Расставить элементы отсортированного диапазона по слотам
+   * @param first Начало диапазона
+   * @param count Длина диапазона
+   * @return Итераторы на элементы в порядке слотов
+   */
+  template <typename ForwardIt>
+  static std::vector<ForwardIt> eytzingerOrder(ForwardIt first,
+                                               size_type count);
+
+  /**
+   * @brief Найти слот первого ключа не меньше key
+   * @details Спуск без ветвлений: результат сравнения становится младшим
+   * битом номера следующего слота, а prefetch запрашивает кеш-линию с
+   * потомками на несколько уровней ниже
+   * @param key Ключ
+   * @return Слот или 0, если все ключи меньше key
+   */
+  template <typename K>
+  size_type lowerBoundSlot(const K& key) const;
+
+  /**
+   * @brief Найти слот ключа, эквивалентного key
+   * @param key Ключ
+   * @return Слот или 0, если ключа нет
+   */
+  template <typename K>
+  size_type findSlot(const K& key) const;
+
+  /// @brief Слот наименьшего ключа (0 для пустого индекса)
+  static size_type firstSlot(size_type count) noexcept;
+  /// @brief Слот наибольшего ключа (0 для пустого индекса)
+  static size_type lastSlot(size_type count) noexcept;
+  /// @brief Слот следующего по порядку ключа или 0
+  static size_type nextSlot(size_type slot, size_type count) noexcept;
+  /// @brief Слот предыдущего по порядку ключа; для 0 - наибольший ключ
+  static size_type prevSlot(size_type slot, size_type count) noexcept;
+
+  /// @brief Ключ в слоте
+  const Key& keyAt(size_type slot) const noexcept { return keys_[slot - 1]; }
+
+  /// @brief Число ключей в одной кеш-линии, степень двойки
+  static constexpr size_type kKeysPerLine = [] {
+    size_type keys = 1;
+    while (keys * 2 * sizeof(Key) <= 64) keys *= 2;
+    return keys;
+  }();
+
+  std::vector<Key> keys_;  ///< Ключи по слотам: слот k в keys_[k - 1]
+  Compare comp_;           ///< Компаратор ключей
+};
+
+/**
+ * @brief Неизменяемое множество с поиском в порядке Эйтцингера
+ * @details Создается из set методом freeze() за O(n). Поиск быстрее, чем
+ * в дереве, так как не зависит от разбросанных по куче узлов. Обход по
+ * порядку ключей идет по слотам за амортизированное O(1) на шаг
+ * @tparam Key Тип ключа
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename Compare = std::less<Key>>
+class frozen_set : public FrozenIndex<Key, Compare> {
+  using Index = FrozenIndex<Key, Compare>;
+
+ public:
+  using value_type = Key;
+  using size_type = typename Index::size_type;
+  using const_reference = const value_type&;
+
+  /**
+   * @brief Константный двунаправленный итератор по порядку ключей
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    const_iterator() = default;
+
+    reference operator*() const { return set_->keyAt(slot_); }
+    pointer operator->() const { return &set_->keyAt(slot_); }
+    const_iterator& operator++() {
+      slot_ = Index::nextSlot(slot_, set_->size());
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    const_iterator& operator--() {
+      slot_ = Index::prevSlot(slot_, set_->size());
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator old = *this;
+      --*this;
+      return old;
+    }
+    bool operator==(const const_iterator& other) const {
+      return slot_ == other.slot_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    friend class frozen_set;
+    const_iterator(const frozen_set* set, size_type slot)
+        : set_(set), slot_(slot) {}
+
+    const frozen_set* set_ = nullptr;  ///< Множество
+    size_type slot_ = 0;               ///< Слот элемента, 0 для end()
+  };
+  using iterator = const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+
+  /**
+   * @brief Пустое множество
+   */
+  frozen_set() = default;
+
+  /**
+   * @brief Построить множество из отсортированного диапазона за O(n)
+   * @param first Начало диапазона, ключи строго возрастают по comp
+   * @param last Конец диапазона
+   * @param comp Компаратор ключей
+   */
+  template <typename ForwardIt>
+  frozen_set(ForwardIt first, ForwardIt last, const Compare& comp = Compare());
+
+  const_iterator begin() const;
+  const_iterator end() const { return const_iterator(this, 0); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  /**
+   * @brief Найти первый элемент не меньше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  const_iterator lower_bound(const Key& key) const;
+
+  /**
+   * @brief Поиск по значению, сравнимому с ключом
+   * @details Доступен только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K& key) const;
+};
+
+/**
+ * @brief Неизменяемый словарь с поиском в порядке Эйтцингера
+ * @details Создается из map методом freeze() за O(n). Ключи и значения
+ * лежат в отдельных массивах с общей нумерацией слотов: спуск читает
+ * только плотный массив ключей, а значение загружается один раз для
+ * найденного слота. Пары ключ-значение не хранятся, поэтому итератор
+ * возвращает пару ссылок
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class frozen_map : public FrozenIndex<Key, Compare> {
+  using Index = FrozenIndex<Key, Compare>;
+
+ public:
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = typename Index::size_type;
+  using const_reference = std::pair<const Key&, const T&>;
+
+  /**
+   * @brief Константный двунаправленный итератор по порядку ключей
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = frozen_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const_reference;
+
+    /**
+     * @brief Указатель на временную пару ссылок для operator->
+     */
+    struct pointer {
+      reference pair;  ///< Пара ссылок на ключ и значение
+      const reference* operator->() const noexcept { return &pair; }
+    };
+
+    const_iterator() = default;
+
+    reference operator*() const { return {key(), value()}; }
+    pointer operator->() const { return pointer{**this}; }
+    /// @brief Ключ элемента
+    const Key& key() const { return map_->keyAt(slot_); }
+    /// @brief Значение элемента
+    const T& value() const { return map_->values_[slot_ - 1]; }
+    const_iterator& operator++() {
+      slot_ = Index::nextSlot(slot_, map_->size());
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    const_iterator& operator--() {
+      slot_ = Index::prevSlot(slot_, map_->size());
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator old = *this;
+      --*this;
+      return old;
+    }
+    bool operator==(const const_iterator& other) const {
+      return slot_ == other.slot_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    friend class frozen_map;
+    const_iterator(const frozen_map* map, size_type slot)
+        : map_(map), slot_(slot) {}
+
+    const frozen_map* map_ = nullptr;  ///< Словарь
+    size_type slot_ = 0;               ///< Слот элемента, 0 для end()
+  };
+  using iterator = const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+
+  /**
+   * @brief Пустой словарь
+   */
+  frozen_map() = default;
+
+  /**
+   * @brief Построить словарь из отсортированного диапазона пар за O(n)
+   * @param first Начало диапазона, ключи строго возрастают по comp
+   * @param last Конец диапазона
+   * @param comp Компаратор ключей
+   */
+  template <typename ForwardIt>
+  frozen_map(ForwardIt first, ForwardIt last, const Compare& comp = Compare());
+
+  const_iterator begin() const;
+  const_iterator end() const { return const_iterator(this, 0); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  /**
+   * @brief Значение по ключу
+   * @param key Ключ
+   * @return Константная ссылка на значение
+   * @throw std::out_of_range Если ключа нет
+   */
+  const T& at(const Key& key) const;
+
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  /**
+   * @brief Найти первый элемент с ключом не меньше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  const_iterator lower_bound(const Key& key) const;
+
+  /**
+   * @brief Поиск по значению, сравнимому с ключом
+   * @details Доступен только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K& key) const;
+
+ private:
+  std::vector<T> values_;  ///< Значения по слотам: слот k в values_[k - 1]
+};
+
+}  // namespace s21
+
+// clang-format off
+#include "./s21_frozen_index.tpp"
+#include "./s21_frozen_containers.tpp"
+// clang-format on
+
+#endif  // S21_FROZEN_H
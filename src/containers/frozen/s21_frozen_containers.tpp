@@ -0,0 +1,213 @@
+/**
+ * @file s21_frozen_containers.tpp
+ * @brief Реализация методов frozen_set и frozen_map
+ */
+
+namespace s21 {
+
+/**
+ * @brief Построить множество из отсортированного диапазона
+ * @param first Начало диапазона, ключи строго возрастают по comp
+ * @param last Конец диапазона
+ * @param comp Компаратор ключей
+ */
+template <typename Key, typename Compare>
+template <typename ForwardIt>
+frozen_set<Key, Compare>::frozen_set(ForwardIt first, ForwardIt last,
+                                     const Compare& comp)
+    : Index(comp) {
+  auto count = static_cast<size_type>(std::distance(first, last));
+  this->keys_.reserve(count);
+  for (ForwardIt item : Index::eytzingerOrder(first, count)) {
+    this->keys_.push_back(*item);
+  }
+}
+
+/**
+ * @brief Итератор на наименьший ключ
+ * @return Итератор или end() для пустого множества
+ */
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::const_iterator
+frozen_set<Key, Compare>::begin() const {
+  return const_iterator(this, Index::firstSlot(this->size()));
+}
+
+/**
+ * @brief Найти ключ
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::const_iterator
+frozen_set<Key, Compare>::find(const Key& key) const {
+  return const_iterator(this, this->findSlot(key));
+}
+
+/**
+ * @brief Проверить наличие ключа
+ * @param key Ключ
+ * @return true, если ключ есть в множестве
+ */
+template <typename Key, typename Compare>
+bool frozen_set<Key, Compare>::contains(const Key& key) const {
+  return this->findSlot(key) != 0;
+}
+
+/**
+ * @brief Найти первый элемент не меньше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Compare>
+typename frozen_set<Key, Compare>::const_iterator
+frozen_set<Key, Compare>::lower_bound(const Key& key) const {
+  return const_iterator(this, this->lowerBoundSlot(key));
+}
+
+/**
+ * @brief Найти элемент, эквивалентный значению сравнимого с ключом типа
+ * @param key Значение для поиска
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename frozen_set<Key, Compare>::const_iterator
+frozen_set<Key, Compare>::find(const K& key) const {
+  return const_iterator(this, this->findSlot(key));
+}
+
+/**
+ * @brief Проверить наличие элемента, эквивалентного key
+ * @param key Значение для проверки
+ * @return true, если элемент есть в множестве
+ */
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+bool frozen_set<Key, Compare>::contains(const K& key) const {
+  return this->findSlot(key) != 0;
+}
+
+/**
+ * @brief Найти первый элемент не меньше значения сравнимого с ключом типа
+ * @param key Значение
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename frozen_set<Key, Compare>::const_iterator
+frozen_set<Key, Compare>::lower_bound(const K& key) const {
+  return const_iterator(this, this->lowerBoundSlot(key));
+}
+
+/**
+ * @brief Построить словарь из отсортированного диапазона пар
+ * @param first Начало диапазона, ключи строго возрастают по comp
+ * @param last Конец диапазона
+ * @param comp Компаратор ключей
+ */
+template <typename Key, typename T, typename Compare>
+template <typename ForwardIt>
+frozen_map<Key, T, Compare>::frozen_map(ForwardIt first, ForwardIt last,
+                                        const Compare& comp)
+    : Index(comp) {
+  auto count = static_cast<size_type>(std::distance(first, last));
+  this->keys_.reserve(count);
+  values_.reserve(count);
+  for (ForwardIt item : Index::eytzingerOrder(first, count)) {
+    this->keys_.push_back(item->first);
+    values_.push_back(item->second);
+  }
+}
+
+/**
+ * @brief Итератор на элемент с наименьшим ключом
+ * @return Итератор или end() для пустого словаря
+ */
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::const_iterator
+frozen_map<Key, T, Compare>::begin() const {
+  return const_iterator(this, Index::firstSlot(this->size()));
+}
+
+/**
+ * @brief Значение по ключу
+ * @param key Ключ
+ * @return Константная ссылка на значение
+ * @throw std::out_of_range Если ключа нет
+ */
+template <typename Key, typename T, typename Compare>
+const T& frozen_map<Key, T, Compare>::at(const Key& key) const {
+  size_type slot = this->findSlot(key);
+  if (slot == 0) throw std::out_of_range("Key not found");
+  return values_[slot - 1];
+}
+
+/**
+ * @brief Найти элемент по ключу
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::const_iterator
+frozen_map<Key, T, Compare>::find(const Key& key) const {
+  return const_iterator(this, this->findSlot(key));
+}
+
+/**
+ * @brief Проверить наличие ключа
+ * @param key Ключ
+ * @return true, если ключ есть в словаре
+ */
+template <typename Key, typename T, typename Compare>
+bool frozen_map<Key, T, Compare>::contains(const Key& key) const {
+  return this->findSlot(key) != 0;
+}
+
+/**
+ * @brief Найти первый элемент с ключом не меньше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare>
+typename frozen_map<Key, T, Compare>::const_iterator
+frozen_map<Key, T, Compare>::lower_bound(const Key& key) const {
+  return const_iterator(this, this->lowerBoundSlot(key));
+}
+
+/**
+ * @brief Найти элемент по значению, сравнимому с ключом
+ * @param key Значение для поиска
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename frozen_map<Key, T, Compare>::const_iterator
+frozen_map<Key, T, Compare>::find(const K& key) const {
+  return const_iterator(this, this->findSlot(key));
+}
+
+/**
+ * @brief Проверить наличие ключа, эквивалентного key
+ * @param key Значение для проверки
+ * @return true, если ключ есть в словаре
+ */
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool frozen_map<Key, T, Compare>::contains(const K& key) const {
+  return this->findSlot(key) != 0;
+}
+
+/**
+ * @brief Найти первый элемент с ключом не меньше значения сравнимого типа
+ * @param key Значение
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename frozen_map<Key, T, Compare>::const_iterator
+frozen_map<Key, T, Compare>::lower_bound(const K& key) const {
+  return const_iterator(this, this->lowerBoundSlot(key));
+}
+
+}  // namespace s21
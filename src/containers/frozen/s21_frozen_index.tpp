@@ -0,0 +1,137 @@
+/**
+ * @file s21_frozen_index.tpp
+ * @brief Реализация раскладки и поиска в порядке Эйтцингера для FrozenIndex
+ */
+
+namespace s21 {
+
+/**
+ * @brief Расставить элементы отсортированного диапазона по слотам
+ * @param first Начало диапазона
+ * @param count Длина диапазона
+ * @return Итераторы на элементы в порядке слотов
+ * @details Слоты перебираются в порядке ключей через nextSlot, поэтому
+ * i-й элемент диапазона попадает в i-й по порядку слот. Работает за O(n)
+ */
+template <typename Key, typename Compare>
+template <typename ForwardIt>
+std::vector<ForwardIt> FrozenIndex<Key, Compare>::eytzingerOrder(
+    ForwardIt first, size_type count) {
+  std::vector<ForwardIt> order(count, first);
+  for (size_type slot = firstSlot(count); slot != 0;
+       slot = nextSlot(slot, count), ++first) {
+    order[slot - 1] = first;
+  }
+  return order;
+}
+
+/**
+ * @brief Найти слот первого ключа не меньше key
+ * @param key Ключ
+ * @return Слот или 0, если все ключи меньше key
+ * @details Номер слота после спуска хранит путь: бит 1 - шаг вправо.
+ * Ответ - последний слот, из которого спуск шел влево, то есть номер без
+ * завершающих единиц и еще одного бита
+ */
+template <typename Key, typename Compare>
+template <typename K>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::lowerBoundSlot(const K& key) const {
+  const size_type count = keys_.size();
+  const Key* keys = keys_.data();
+  size_type slot = 1;
+  while (slot <= count) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(keys + std::min(slot * kKeysPerLine, count) - 1);
+#endif
+    slot = 2 * slot + static_cast<size_type>(comp_(keys[slot - 1], key));
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  return slot >> (__builtin_ctzll(~static_cast<unsigned long long>(slot)) + 1);
+#else
+  while (slot & 1) slot >>= 1;
+  return slot >> 1;
+#endif
+}
+
+/**
+ * @brief Найти слот ключа, эквивалентного key
+ * @param key Ключ
+ * @return Слот или 0, если ключа нет
+ */
+template <typename Key, typename Compare>
+template <typename K>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::findSlot(const K& key) const {
+  size_type slot = lowerBoundSlot(key);
+  return slot != 0 && !comp_(key, keyAt(slot)) ? slot : 0;
+}
+
+/**
+ * @brief Слот наименьшего ключа: крайний левый путь от корня
+ * @param count Число ключей
+ * @return Слот или 0 для пустого индекса
+ */
+template <typename Key, typename Compare>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::firstSlot(size_type count) noexcept {
+  if (count == 0) return 0;
+  size_type slot = 1;
+  while (2 * slot <= count) slot *= 2;
+  return slot;
+}
+
+/**
+ * @brief Слот наибольшего ключа: крайний правый путь от корня
+ * @param count Число ключей
+ * @return Слот или 0 для пустого индекса
+ */
+template <typename Key, typename Compare>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::lastSlot(size_type count) noexcept {
+  if (count == 0) return 0;
+  size_type slot = 1;
+  while (2 * slot + 1 <= count) slot = 2 * slot + 1;
+  return slot;
+}
+
+/**
+ * @brief Слот следующего по порядку ключа
+ * @param slot Текущий слот
+ * @param count Число ключей
+ * @return Слот или 0 после наибольшего ключа
+ * @details Как в дереве с указателями: минимум правого поддерева, иначе
+ * подъем, пока слот - правый потомок (нечетный номер)
+ */
+template <typename Key, typename Compare>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::nextSlot(size_type slot, size_type count) noexcept {
+  if (2 * slot + 1 <= count) {
+    slot = 2 * slot + 1;
+    while (2 * slot <= count) slot *= 2;
+    return slot;
+  }
+  while (slot & 1) slot >>= 1;
+  return slot >> 1;
+}
+
+/**
+ * @brief Слот предыдущего по порядку ключа
+ * @param slot Текущий слот, 0 означает end()
+ * @param count Число ключей
+ * @return Слот или 0 перед наименьшим ключом
+ */
+template <typename Key, typename Compare>
+typename FrozenIndex<Key, Compare>::size_type
+FrozenIndex<Key, Compare>::prevSlot(size_type slot, size_type count) noexcept {
+  if (slot == 0) return lastSlot(count);
+  if (2 * slot <= count) {
+    slot = 2 * slot;
+    while (2 * slot + 1 <= count) slot = 2 * slot + 1;
+    return slot;
+  }
+  while (slot != 0 && (slot & 1) == 0) slot >>= 1;
+  return slot >> 1;
+}
+
+}  // namespace s21
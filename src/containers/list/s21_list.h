@@ -11,8 +11,10 @@ namespace s21 {
 /**
  * @brief Шаблонный класс двусвязного списка
  * @tparam T Тип данных, хранимых в списке
+ * @tparam Allocator Аллокатор элементов, для узлов он перепривязывается к типу
+ * узла
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   /**
@@ -23,12 +25,14 @@ class list {
    */
   class ListNode {
    public:
-    T data;          ///< Данные узла
+    union {
+      T data;  ///< Данные узла, создаются через аллокатор списка
+    };
     ListNode* next;  ///< Указатель на следующий узел
     ListNode* prev;  ///< Указатель на предыдущий узел
 
-    ListNode(const T& data, ListNode* prev = nullptr, ListNode* next = nullptr);
-    ListNode(T&& data, ListNode* prev = nullptr, ListNode* next = nullptr);
+    ListNode(ListNode* prev, ListNode* next) noexcept;
+    ~ListNode() {}
   };
 
   /**
@@ -102,6 +106,7 @@ class list {
   using iterator = ListIterator;             ///< Тип итератора
   using const_iterator = ListConstIterator;  ///< Тип константного итератора
   using size_type = size_t;                  ///< Тип для размера списка
+  using allocator_type = Allocator;          ///< Тип аллокатора
 
   /**
    * @brief Конструктор по умолчанию
@@ -110,6 +115,14 @@ class list {
    */
   list();
 
+  /**
+   * @brief Конструктор с аллокатором
+   * @param alloc Аллокатор, из которого выделяются узлы
+   *
+   * Создает пустой список.
+   */
+  explicit list(const allocator_type& alloc);
+
   /**
    * @brief Конструктор копирования
    * @param other Копируемый список
@@ -118,6 +131,15 @@ class list {
    */
   list(const list& other);
 
+  /**
+   * @brief Конструктор копирования с аллокатором
+   * @param other Копируемый список
+   * @param alloc Аллокатор, из которого выделяются узлы
+   *
+   * Создает копию существующего списка в памяти аллокатора alloc.
+   */
+  list(const list& other, const allocator_type& alloc);
+
   /**
    * @brief Конструктор перемещения
    * @param other Перемещаемый список
@@ -126,23 +148,46 @@ class list {
    */
   list(list&& other) noexcept;
 
+  /**
+   * @brief Конструктор перемещения с аллокатором
+   * @param other Перемещаемый список
+   * @param alloc Аллокатор, из которого выделяются узлы
+   *
+   * Забирает узлы other, если аллокаторы равны, иначе перемещает элементы
+   * в новые узлы аллокатора alloc.
+   */
+  list(list&& other, const allocator_type& alloc);
+
   /**
    * @brief Конструктор из списка инициализации
    * @param init Список инициализации
+   * @param alloc Аллокатор, из которого выделяются узлы
    *
    * Создает список с элементами из списка инициализации.
    */
-  list(std::initializer_list<T> init);
+  list(std::initializer_list<T> init,
+       const allocator_type& alloc = allocator_type());
 
   /**
    * @brief Конструктор с заданным количеством элементов
    * @param count Количество элементов
    * @param value Значение для инициализации элементов (по умолчанию T())
+   * @param alloc Аллокатор, из которого выделяются узлы
    *
    * Создает список с указанным количеством элементов, инициализированных
    * заданным значением.
    */
-  list(size_type count, const T& value = T());
+  list(size_type count, const T& value = T(),
+       const allocator_type& alloc = allocator_type());
+
+  /**
+   * @brief Конструктор с количеством элементов и аллокатором
+   * @param count Количество элементов
+   * @param alloc Аллокатор, из которого выделяются узлы
+   *
+   * Создает список из count элементов T().
+   */
+  list(size_type count, const allocator_type& alloc);
 
   /**
    * @brief Деструктор
@@ -163,7 +208,16 @@ class list {
    * @param other Перемещаемый список
    * @return Ссылка на текущий список
    */
-  list& operator=(list&& other) noexcept;
+  list& operator=(list&& other) noexcept(
+      std::allocator_traits<Allocator>::propagate_on_container_move_assignment::
+          value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
+
+  /**
+   * @brief Возвращает копию аллокатора списка
+   * @return Аллокатор элементов
+   */
+  allocator_type get_allocator() const noexcept;
 
   /**
    * @brief Возвращает итератор на начало списка
@@ -358,9 +412,30 @@ class list {
   void insert_many_front(Args&&... args);
 
  private:
-  ListNode* head;   ///< Указатель на первый элемент
-  ListNode* tail;   ///< Указатель на последний элемент
-  size_type size_;  ///< Размер списка
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ListNode>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator alloc_;  ///< Аллокатор узлов
+  ListNode* head;         ///< Указатель на первый элемент
+  ListNode* tail;         ///< Указатель на последний элемент
+  size_type size_;        ///< Размер списка
+
+  /**
+   * @brief Выделяет узел и создает в нем элемент через аллокатор
+   * @param prev Указатель на предыдущий узел
+   * @param next Указатель на следующий узел
+   * @param args Аргументы конструктора элемента
+   * @return Указатель на новый узел
+   */
+  template <typename... Args>
+  ListNode* createNode(ListNode* prev, ListNode* next, Args&&... args);
+
+  /**
+   * @brief Разрушает элемент узла и возвращает память аллокатору
+   * @param node Удаляемый узел
+   */
+  void destroyNode(ListNode* node) noexcept;
 
   /**
    * @brief Вспомогательный метод для сортировки слиянием
@@ -385,6 +460,14 @@ class list {
   ListNode* merge(ListNode* left, ListNode* right);
 };
 
+namespace pmr {
+
+/// Список, выделяющий узлы из std::pmr::memory_resource
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 // clang-format off
@@ -10,8 +10,8 @@ namespace s21 {
  * @return Ссылка на данные первого узла
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-typename list<T>::reference list<T>::front() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reference list<T, Allocator>::front() {
   if (!head) throw std::out_of_range("List is empty");
   return head->data;
 }
@@ -21,8 +21,8 @@ typename list<T>::reference list<T>::front() {
  * @return Константная ссылка на данные первого узла
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-typename list<T>::const_reference list<T>::front() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() const {
   if (!head) throw std::out_of_range("List is empty");
   return head->data;
 }
@@ -32,8 +32,8 @@ typename list<T>::const_reference list<T>::front() const {
  * @return Ссылка на данные последнего узла
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-typename list<T>::reference list<T>::back() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reference list<T, Allocator>::back() {
   if (!tail) throw std::out_of_range("List is empty");
   return tail->data;
 }
@@ -43,8 +43,8 @@ typename list<T>::reference list<T>::back() {
  * @return Константная ссылка на данные последнего узла
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-typename list<T>::const_reference list<T>::back() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() const {
   if (!tail) throw std::out_of_range("List is empty");
   return tail->data;
 }
@@ -10,8 +10,8 @@ namespace s21 {
  *
  * Меняет порядок элементов на противоположный
  */
-template <typename T>
-void list<T>::reverse() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
   ListNode* current = head;
   ListNode* temp = nullptr;
   while (current) {
@@ -28,8 +28,8 @@ void list<T>::reverse() {
 /**
  * @brief Удаляет последовательные дубликаты
  */
-template <typename T>
-void list<T>::unique() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
   if (head == nullptr) return;
   ListNode* current = head;
   while (current->next) {
@@ -41,7 +41,7 @@ void list<T>::unique() {
       } else {
         tail = current;
       }
-      delete to_delete;
+      destroyNode(to_delete);
       --size_;
     } else {
       current = current->next;
@@ -52,8 +52,8 @@ void list<T>::unique() {
 /**
  * @brief Сортирует список
  */
-template <typename T>
-void list<T>::sort() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
   if (size_ < 2) return;
   head = mergeSort(head);
   tail = head;
@@ -66,14 +66,14 @@ void list<T>::sort() {
  * @brief Объединяет два отсортированных списка
  * @param other Список для объединения
  */
-template <typename T>
-void list<T>::merge(list& other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
   if (this != &other) {
     if (!other.empty()) {
       sort();
       other.sort();
 
-      ListNode dummy = ListNode(T(), nullptr, nullptr);
+      ListNode dummy(nullptr, nullptr);
       ListNode* current = &dummy;
 
       ListNode* l1 = head;
@@ -114,8 +114,8 @@ void list<T>::merge(list& other) {
  * @param pos Позиция вставки
  * @param other Список, элементы которого будут перемещены
  */
-template <typename T>
-void list<T>::splice(const_iterator pos, list& other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other) {
   if (this != &other && !other.empty()) {
     ListNode* insert_pos = const_cast<ListNode*>(pos.node);
     if (insert_pos) {
@@ -148,8 +148,9 @@ void list<T>::splice(const_iterator pos, list& other) {
  * @param node Начальный узел для сортировки
  * @return Указатель на отсортированный список
  */
-template <typename T>
-typename list<T>::ListNode* list<T>::mergeSort(ListNode* node) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListNode* list<T, Allocator>::mergeSort(
+    ListNode* node) {
   if (!node || !node->next) return node;
 
   ListNode* middle = getMiddle(node);
@@ -168,8 +169,9 @@ typename list<T>::ListNode* list<T>::mergeSort(ListNode* node) {
  * @param node Начальный узел
  * @return Указатель на средний узел
  */
-template <typename T>
-typename list<T>::ListNode* list<T>::getMiddle(ListNode* node) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListNode* list<T, Allocator>::getMiddle(
+    ListNode* node) {
   if (!node) return node;
 
   ListNode* slow = node;
@@ -191,8 +193,9 @@ typename list<T>::ListNode* list<T>::getMiddle(ListNode* node) {
  * @param right Второй список
  * @return Указатель на объединенный список
  */
-template <typename T>
-typename list<T>::ListNode* list<T>::merge(ListNode* left, ListNode* right) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListNode* list<T, Allocator>::merge(
+    ListNode* left, ListNode* right) {
   if (!left) return right;
   if (!right) return left;
 
@@ -9,8 +9,8 @@ namespace s21 {
  * @brief Проверяет, пуст ли список
  * @return true если список пуст, false в противном случае
  */
-template <typename T>
-[[nodiscard]] bool list<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+[[nodiscard]] bool list<T, Allocator>::empty() const noexcept {
   return size_ == 0;
 }
 
@@ -18,8 +18,10 @@ template <typename T>
  * @brief Возвращает текущий размер списка
  * @return Количество элементов в списке
  */
-template <typename T>
-[[nodiscard]] typename list<T>::size_type list<T>::size() const noexcept {
+template <typename T, typename Allocator>
+[[nodiscard]]
+typename list<T, Allocator>::size_type list<T, Allocator>::size(
+    ) const noexcept {
   return size_;
 }
 
@@ -27,8 +29,9 @@ template <typename T>
  * @brief Возвращает максимально возможный размер списка
  * @return Максимальное количество элементов, которое может содержать список
  */
-template <typename T>
-typename list<T>::size_type list<T>::max_size() const noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type
+list<T, Allocator>::max_size() const noexcept {
   return std::numeric_limits<size_type>::max();
 }
 
@@ -10,8 +10,19 @@ namespace s21 {
  *
  * Создает пустой список.
  */
-template <typename T>
-list<T>::list() : head(nullptr), tail(nullptr), size_(0) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::list()
+    : alloc_(), head(nullptr), tail(nullptr), size_(0) {}
+
+/**
+ * @brief Конструктор с аллокатором
+ * @param alloc Аллокатор, из которого выделяются узлы
+ *
+ * Создает пустой список.
+ */
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const allocator_type& alloc)
+    : alloc_(alloc), head(nullptr), tail(nullptr), size_(0) {}
 
 /**
  * @brief Конструктор копирования
@@ -19,8 +30,25 @@ list<T>::list() : head(nullptr), tail(nullptr), size_(0) {}
  *
  * Создает новый список как копию существующего.
  */
-template <typename T>
-list<T>::list(const list& other) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& other)
+    : list(std::allocator_traits<Allocator>::
+               select_on_container_copy_construction(other.get_allocator())) {
+  for (const auto& value : other) {
+    push_back(value);
+  }
+}
+
+/**
+ * @brief Конструктор копирования с аллокатором
+ * @param other Копируемый список
+ * @param alloc Аллокатор, из которого выделяются узлы
+ *
+ * Создает копию существующего списка в памяти аллокатора alloc.
+ */
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& other, const allocator_type& alloc)
+    : list(alloc) {
   for (const auto& value : other) {
     push_back(value);
   }
@@ -32,22 +60,51 @@ list<T>::list(const list& other) : list() {
  *
  * Создает новый список, перемещая содержимое другого списка.
  */
-template <typename T>
-list<T>::list(list&& other) noexcept
-    : head(other.head), tail(other.tail), size_(other.size_) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& other) noexcept
+    : alloc_(std::move(other.alloc_)),
+      head(other.head),
+      tail(other.tail),
+      size_(other.size_) {
   other.head = nullptr;
   other.tail = nullptr;
   other.size_ = 0;
 }
 
+/**
+ * @brief Конструктор перемещения с аллокатором
+ * @param other Перемещаемый список
+ * @param alloc Аллокатор, из которого выделяются узлы
+ *
+ * Узлы other можно забрать, только если их освободит alloc, то есть
+ * аллокаторы равны. Иначе элементы перемещаются в новые узлы, а other
+ * становится пустым.
+ */
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& other, const allocator_type& alloc)
+    : list(alloc) {
+  if (std::allocator_traits<Allocator>::is_always_equal::value ||
+      alloc_ == other.alloc_) {
+    head = std::exchange(other.head, nullptr);
+    tail = std::exchange(other.tail, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    return;
+  }
+  for (auto& value : other) push_back(std::move(value));
+  other.clear();
+}
+
 /**
  * @brief Конструктор из списка инициализации
  * @param init Список инициализации
+ * @param alloc Аллокатор, из которого выделяются узлы
  *
  * Создает список с элементами из списка инициализации.
  */
-template <typename T>
-list<T>::list(std::initializer_list<T> init) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<T> init,
+                         const allocator_type& alloc)
+    : list(alloc) {
   try {
     for (const auto& value : init) {
       push_back(value);
@@ -62,24 +119,38 @@ list<T>::list(std::initializer_list<T> init) : list() {
  * @brief Конструктор с заданным количеством элементов
  * @param count Количество элементов
  * @param value Значение для инициализации элементов (по умолчанию T())
+ * @param alloc Аллокатор, из которого выделяются узлы
  *
  * Создает список с указанным количеством элементов, инициализированных
  * заданным значением.
  */
-template <typename T>
-list<T>::list(size_type count, const T& value) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type count, const T& value,
+                         const allocator_type& alloc)
+    : list(alloc) {
   for (size_type i = 0; i < count; ++i) {
     push_back(value);
   }
 }
 
+/**
+ * @brief Конструктор с количеством элементов и аллокатором
+ * @param count Количество элементов
+ * @param alloc Аллокатор, из которого выделяются узлы
+ *
+ * Создает список из count элементов T().
+ */
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type count, const allocator_type& alloc)
+    : list(count, T(), alloc) {}
+
 /**
  * @brief Деструктор
  *
  * Освобождает память, занятую списком.
  */
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
   clear();
 }
 
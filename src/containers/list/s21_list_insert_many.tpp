@@ -12,14 +12,15 @@ namespace s21 {
  * @return Итератор на первый вставленный элемент
  * @throw std::invalid_argument если итератор невалиден
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename list<T>::iterator list<T>::insert_many(const_iterator pos,
+typename list<T, Allocator>::iterator list<T, Allocator>::insert_many(
+    const_iterator pos,
                                                 Args&&... args) {
   if (pos.node != nullptr && !pos.is_valid(*this)) {
     throw std::invalid_argument("Iterator does not belong to this list");
   }
-  list<T> temp;
+  list<T, Allocator> temp;
   (temp.push_back(std::forward<Args>(args)), ...);
   if (temp.empty()) return iterator(const_cast<ListNode*>(pos.node));
   auto first = temp.begin();
@@ -32,10 +33,10 @@ typename list<T>::iterator list<T>::insert_many(const_iterator pos,
  * @brief Вставляет элементы в конец списка
  * @param args Аргументы для вставки
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  list<T> temp;
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  list<T, Allocator> temp;
   (temp.push_back(std::forward<Args>(args)), ...);
   splice(cend(), temp);
 }
@@ -44,10 +45,10 @@ void list<T>::insert_many_back(Args&&... args) {
  * @brief Вставляет элементы в начало списка
  * @param args Аргументы для вставки
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
-  list<T> temp;
+void list<T, Allocator>::insert_many_front(Args&&... args) {
+  list<T, Allocator> temp;
   (temp.push_back(std::forward<Args>(args)), ...);
   splice(cbegin(), temp);
 }
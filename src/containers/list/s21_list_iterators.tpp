@@ -9,15 +9,16 @@ namespace s21 {
  * @brief Конструктор итератора
  * @param node Указатель на узел списка
  */
-template <typename T>
-list<T>::ListIterator::ListIterator(pointer node) : node(node) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::ListIterator::ListIterator(pointer node) : node(node) {}
 
 /**
  * @brief Оператор разыменования итератора
  * @return Ссылка на данные текущего узла
  */
-template <typename T>
-typename list<T>::ListIterator::reference list<T>::ListIterator::operator*() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator::reference
+list<T, Allocator>::ListIterator::operator*() {
   return node->data;
 }
 
@@ -25,8 +26,9 @@ typename list<T>::ListIterator::reference list<T>::ListIterator::operator*() {
  * @brief Префиксный инкремент итератора
  * @return Ссылка на текущий итератор
  */
-template <typename T>
-typename list<T>::ListIterator& list<T>::ListIterator::operator++() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator&
+list<T, Allocator>::ListIterator::operator++() {
   node = node->next;
   return *this;
 }
@@ -35,8 +37,9 @@ typename list<T>::ListIterator& list<T>::ListIterator::operator++() {
  * @brief Постфиксный инкремент итератора
  * @return Копия итератора до инкремента
  */
-template <typename T>
-typename list<T>::ListIterator list<T>::ListIterator::operator++(int) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator
+list<T, Allocator>::ListIterator::operator++(int) {
   ListIterator tmp = *this;
   node = node->next;
   return tmp;
@@ -47,8 +50,9 @@ typename list<T>::ListIterator list<T>::ListIterator::operator++(int) {
  * @return Ссылка на текущий итератор
  * @throw std::out_of_range если итератор указывает на nullptr
  */
-template <typename T>
-typename list<T>::ListIterator& list<T>::ListIterator::operator--() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator&
+list<T, Allocator>::ListIterator::operator--() {
   if (node) {
     node = node->prev;
   } else {
@@ -62,8 +66,8 @@ typename list<T>::ListIterator& list<T>::ListIterator::operator--() {
  * @param other Другой итератор
  * @return true если итераторы равны, иначе false
  */
-template <typename T>
-bool list<T>::ListIterator::operator==(
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListIterator::operator==(
     const ListIterator& other) const noexcept {
   return node == other.node;
 }
@@ -73,8 +77,8 @@ bool list<T>::ListIterator::operator==(
  * @param other Другой итератор
  * @return true если итераторы не равны, иначе false
  */
-template <typename T>
-bool list<T>::ListIterator::operator!=(
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListIterator::operator!=(
     const ListIterator& other) const noexcept {
   return node != other.node;
 }
@@ -84,8 +88,8 @@ bool list<T>::ListIterator::operator!=(
  * @param list Список, для которого проверяется принадлежность
  * @return true, если итератор принадлежит списку, иначе false
  */
-template <typename T>
-bool list<T>::ListIterator::is_valid(const list& list) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListIterator::is_valid(const list& list) const {
   ListNode* current = list.head;
   while (current) {
     if (current == node) {
@@ -100,24 +104,26 @@ bool list<T>::ListIterator::is_valid(const list& list) const {
  * @brief Конструктор константного итератора
  * @param node Указатель на узел списка
  */
-template <typename T>
-list<T>::ListConstIterator::ListConstIterator(pointer node) : node(node) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::ListConstIterator::ListConstIterator(
+    pointer node) : node(node) {}
 
 /**
  * @brief Конструктор константного итератора из обычного итератора
  * @param other Обычный итератор
  */
-template <typename T>
-list<T>::ListConstIterator::ListConstIterator(const ListIterator& other)
+template <typename T, typename Allocator>
+list<T, Allocator>::ListConstIterator::ListConstIterator(
+    const ListIterator& other)
     : node(other.node) {}
 
 /**
  * @brief Оператор разыменования константного итератора
  * @return Константная ссылка на данные текущего узла
  */
-template <typename T>
-typename list<T>::ListConstIterator::reference
-list<T>::ListConstIterator::operator*() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator::reference
+list<T, Allocator>::ListConstIterator::operator*() const {
   return node->data;
 }
 
@@ -125,8 +131,9 @@ list<T>::ListConstIterator::operator*() const {
  * @brief Префиксный инкремент константного итератора
  * @return Ссылка на текущий константный итератор
  */
-template <typename T>
-typename list<T>::ListConstIterator& list<T>::ListConstIterator::operator++() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator&
+list<T, Allocator>::ListConstIterator::operator++() {
   node = node->next;
   return *this;
 }
@@ -135,9 +142,9 @@ typename list<T>::ListConstIterator& list<T>::ListConstIterator::operator++() {
  * @brief Постфиксный инкремент константного итератора
  * @return Копия константного итератора до инкремента
  */
-template <typename T>
-typename list<T>::ListConstIterator list<T>::ListConstIterator::operator++(
-    int) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator
+list<T, Allocator>::ListConstIterator::operator++(int) {
   ListConstIterator tmp = *this;
   node = node->next;
   return tmp;
@@ -148,8 +155,9 @@ typename list<T>::ListConstIterator list<T>::ListConstIterator::operator++(
  * @return Ссылка на текущий константный итератор
  * @throw std::out_of_range если итератор указывает на nullptr
  */
-template <typename T>
-typename list<T>::ListConstIterator& list<T>::ListConstIterator::operator--() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator&
+list<T, Allocator>::ListConstIterator::operator--() {
   if (node) {
     node = node->prev;
   } else {
@@ -163,8 +171,8 @@ typename list<T>::ListConstIterator& list<T>::ListConstIterator::operator--() {
  * @param other Другой константный итератор
  * @return true если итераторы равны, иначе false
  */
-template <typename T>
-bool list<T>::ListConstIterator::operator==(
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListConstIterator::operator==(
     const ListConstIterator& other) const noexcept {
   return node == other.node;
 }
@@ -174,8 +182,8 @@ bool list<T>::ListConstIterator::operator==(
  * @param other Другой константный итератор
  * @return true если итераторы не равны, иначе false
  */
-template <typename T>
-bool list<T>::ListConstIterator::operator!=(
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListConstIterator::operator!=(
     const ListConstIterator& other) const noexcept {
   return node != other.node;
 }
@@ -185,8 +193,8 @@ bool list<T>::ListConstIterator::operator!=(
  * @param list Список, для которого проверяется принадлежность
  * @return true, если итератор принадлежит списку, иначе false
  */
-template <typename T>
-bool list<T>::ListConstIterator::is_valid(const list& list) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListConstIterator::is_valid(const list& list) const {
   const ListNode* current = list.head;
   while (current) {
     if (current == node) return true;
@@ -199,8 +207,8 @@ bool list<T>::ListConstIterator::is_valid(const list& list) const {
  * @brief Возвращает итератор на начало списка
  * @return Итератор на первый элемент
  */
-template <typename T>
-typename list<T>::iterator list<T>::begin() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
   return iterator(head);
 }
 
@@ -208,8 +216,8 @@ typename list<T>::iterator list<T>::begin() {
  * @brief Возвращает итератор на конец списка
  * @return Итератор, указывающий на позицию после последнего элемента
  */
-template <typename T>
-typename list<T>::iterator list<T>::end() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
   return iterator(nullptr);
 }
 
@@ -217,8 +225,8 @@ typename list<T>::iterator list<T>::end() {
  * @brief Возвращает константный итератор на начало списка
  * @return Константный итератор на первый элемент
  */
-template <typename T>
-typename list<T>::const_iterator list<T>::begin() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::begin() const {
   return const_iterator(head);
 }
 
@@ -227,8 +235,8 @@ typename list<T>::const_iterator list<T>::begin() const {
  * @return Константный итератор, указывающий на позицию после последнего
  * элемента
  */
-template <typename T>
-typename list<T>::const_iterator list<T>::end() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::end() const {
   return const_iterator(nullptr);
 }
 
@@ -236,8 +244,8 @@ typename list<T>::const_iterator list<T>::end() const {
  * @brief Возвращает константный итератор на начало списка
  * @return Константный итератор на первый элемент
  */
-template <typename T>
-typename list<T>::const_iterator list<T>::cbegin() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const {
   return const_iterator(head);
 }
 
@@ -246,8 +254,8 @@ typename list<T>::const_iterator list<T>::cbegin() const {
  * @return Константный итератор, указывающий на позицию после последнего
  * элемента
  */
-template <typename T>
-typename list<T>::const_iterator list<T>::cend() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const {
   return const_iterator(nullptr);
 }
 
@@ -9,9 +9,9 @@ namespace s21 {
  * @brief Добавляет элемент в конец списка
  * @param value Значение для добавления
  */
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  ListNode* new_node = new ListNode(value, tail, nullptr);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  ListNode* new_node = createNode(tail, nullptr, value);
   if (tail) {
     tail->next = new_node;
   } else {
@@ -25,9 +25,9 @@ void list<T>::push_back(const_reference value) {
  * @brief Добавляет элемент в конец списка (с перемещением)
  * @param value Перемещаемое значение
  */
-template <typename T>
-void list<T>::push_back(value_type&& value) {
-  ListNode* new_node = new ListNode(std::move(value), tail, nullptr);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& value) {
+  ListNode* new_node = createNode(tail, nullptr, std::move(value));
   if (tail) {
     tail->next = new_node;
   } else {
@@ -41,8 +41,8 @@ void list<T>::push_back(value_type&& value) {
  * @brief Удаляет последний элемент
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (tail) {
     ListNode* to_delete = tail;
     tail = tail->prev;
@@ -51,7 +51,7 @@ void list<T>::pop_back() {
     } else {
       head = nullptr;
     }
-    delete to_delete;
+    destroyNode(to_delete);
     --size_;
   } else {
     throw std::out_of_range("List is empty");
@@ -62,9 +62,9 @@ void list<T>::pop_back() {
  * @brief Добавляет элемент в начало списка
  * @param value Значение для добавления
  */
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  ListNode* new_node = new ListNode(value, nullptr, head);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  ListNode* new_node = createNode(nullptr, head, value);
   if (head) {
     head->prev = new_node;
   }
@@ -76,8 +76,8 @@ void list<T>::push_front(const_reference value) {
  * @brief Удаляет первый элемент
  * @throw std::out_of_range если список пуст
  */
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (head) {
     ListNode* to_delete = head;
     head = head->next;
@@ -86,7 +86,7 @@ void list<T>::pop_front() {
     } else {
       tail = nullptr;
     }
-    delete to_delete;
+    destroyNode(to_delete);
     --size_;
   } else {
     throw std::out_of_range("List is empty");
@@ -100,9 +100,9 @@ void list<T>::pop_front() {
  * @return Итератор на вставленный элемент
  * @throw std::invalid_argument если итератор невалиден
  */
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, const_reference value) {
   if (!pos.is_valid(*this)) {
     throw std::invalid_argument(
         "Invalid iterator: does not belong to this list");
@@ -112,7 +112,7 @@ typename list<T>::iterator list<T>::insert(iterator pos,
     return begin();
   } else {
     ListNode* current = pos.node;
-    ListNode* new_node = new ListNode(value, current->prev, current);
+    ListNode* new_node = createNode(current->prev, current, value);
     current->prev->next = new_node;
     current->prev = new_node;
     ++size_;
@@ -125,8 +125,8 @@ typename list<T>::iterator list<T>::insert(iterator pos,
  * @param pos Итератор на удаляемый элемент
  * @throw std::invalid_argument если итератор невалиден
  */
-template <typename T>
-void list<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::erase(iterator pos) {
   if (!pos.is_valid(*this)) {
     throw std::invalid_argument(
         "Invalid iterator: does not belong to this list");
@@ -139,7 +139,7 @@ void list<T>::erase(iterator pos) {
     ListNode* current = pos.node;
     current->prev->next = current->next;
     current->next->prev = current->prev;
-    delete current;
+    destroyNode(current);
     --size_;
   }
 }
@@ -147,12 +147,12 @@ void list<T>::erase(iterator pos) {
 /**
  * @brief Очищает список
  */
-template <typename T>
-void list<T>::clear() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
   while (head) {
     ListNode* to_delete = head;
     head = head->next;
-    delete to_delete;
+    destroyNode(to_delete);
   }
   tail = nullptr;
   size_ = 0;
@@ -162,8 +162,12 @@ void list<T>::clear() {
  * @brief Обменивает содержимое с другим списком
  * @param other Список для обмена
  */
-template <typename T>
-void list<T>::swap(list& other) noexcept {
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) noexcept {
+  if constexpr (std::allocator_traits<
+                    Allocator>::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
   std::swap(head, other.head);
   std::swap(tail, other.tail);
   std::swap(size_, other.size_);
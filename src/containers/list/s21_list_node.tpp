@@ -6,23 +6,51 @@
 namespace s21 {
 
 /**
- * @brief Конструктор узла списка с копированием данных
- * @param data Данные для копирования
+ * @brief Конструктор узла списка
  * @param prev Указатель на предыдущий узел
  * @param next Указатель на следующий узел
+ *
+ * Данные узла не инициализируются, их создает list::createNode.
  */
-template <typename T>
-list<T>::ListNode::ListNode(const T& data, ListNode* prev, ListNode* next)
-    : data(data), prev(prev), next(next) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::ListNode::ListNode(ListNode* prev, ListNode* next) noexcept
+    : next(next), prev(prev) {}
 
 /**
- * @brief Конструктор узла списка с перемещением данных
- * @param data Данные для перемещения
+ * @brief Выделяет узел и создает в нем элемент через аллокатор
  * @param prev Указатель на предыдущий узел
  * @param next Указатель на следующий узел
+ * @param args Аргументы конструктора элемента
+ * @return Указатель на новый узел
  */
-template <typename T>
-list<T>::ListNode::ListNode(T&& data, ListNode* prev, ListNode* next)
-    : data(std::move(data)), prev(prev), next(next) {}
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::ListNode* list<T, Allocator>::createNode(
+    ListNode* prev, ListNode* next, Args&&... args) {
+  ListNode* node = new (node_traits::allocate(alloc_, 1)) ListNode(prev, next);
+  allocator_type alloc(alloc_);
+  try {
+    std::allocator_traits<allocator_type>::construct(
+        alloc, std::addressof(node->data), std::forward<Args>(args)...);
+  } catch (...) {
+    node->~ListNode();
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+/**
+ * @brief Разрушает элемент узла и возвращает память аллокатору
+ * @param node Удаляемый узел
+ */
+template <typename T, typename Allocator>
+void list<T, Allocator>::destroyNode(ListNode* node) noexcept {
+  allocator_type alloc(alloc_);
+  std::allocator_traits<allocator_type>::destroy(alloc,
+                                                 std::addressof(node->data));
+  node->~ListNode();
+  node_traits::deallocate(alloc_, node, 1);
+}
 
 }  // namespace s21
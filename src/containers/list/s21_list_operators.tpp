@@ -9,12 +9,27 @@ namespace s21 {
  * @brief Оператор присваивания копированием
  * @param other Копируемый список
  * @return Ссылка на текущий список
+ *
+ * Если аллокатор распространяется при копировании, список переходит на
+ * аллокатор other.
  */
-template <typename T>
-list<T>& list<T>::operator=(const list& other) {
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(const list& other) {
+  using traits = std::allocator_traits<Allocator>;
   if (this != &other) {
-    list temp(other);
-    swap(temp);
+    if constexpr (traits::propagate_on_container_copy_assignment::value) {
+      list temp(other.get_allocator());
+      for (const auto& value : other) temp.push_back(value);
+      clear();
+      alloc_ = temp.alloc_;
+      std::swap(head, temp.head);
+      std::swap(tail, temp.tail);
+      std::swap(size_, temp.size_);
+    } else {
+      list temp(get_allocator());
+      for (const auto& value : other) temp.push_back(value);
+      swap(temp);
+    }
   }
   return *this;
 }
@@ -23,19 +38,43 @@ list<T>& list<T>::operator=(const list& other) {
  * @brief Оператор присваивания перемещением
  * @param other Перемещаемый список
  * @return Ссылка на текущий список
+ *
+ * Узлы забираются у other, если аллокаторы совместимы. Иначе элементы
+ * перемещаются поштучно в узлы из собственного аллокатора.
  */
-template <typename T>
-list<T>& list<T>::operator=(list&& other) noexcept {
-  if (this != &other) {
-    clear();
-    head = other.head;
-    tail = other.tail;
-    size_ = other.size_;
-    other.head = nullptr;
-    other.tail = nullptr;
-    other.size_ = 0;
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::
+        value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+  using traits = std::allocator_traits<Allocator>;
+  if (this == &other) return *this;
+  clear();
+  if constexpr (!traits::propagate_on_container_move_assignment::value &&
+                !traits::is_always_equal::value) {
+    if (!(alloc_ == other.alloc_)) {
+      for (auto& value : other) push_back(std::move(value));
+      other.clear();
+      return *this;
+    }
+  }
+  if constexpr (traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(other.alloc_);
   }
+  head = std::exchange(other.head, nullptr);
+  tail = std::exchange(other.tail, nullptr);
+  size_ = std::exchange(other.size_, 0);
   return *this;
 }
 
+/**
+ * @brief Возвращает копию аллокатора списка
+ * @return Аллокатор элементов
+ */
+template <typename T, typename Allocator>
+typename list<T, Allocator>::allocator_type list<T, Allocator>::get_allocator()
+    const noexcept {
+  return allocator_type(alloc_);
+}
+
 }  // namespace s21
@@ -13,10 +13,19 @@ namespace s21 {
  * @brief Класс map, реализующий ассоциативный контейнер с уникальными ключами
  * @tparam Key Тип ключа
  * @tparam T Тип значения
+ * @tparam Compare Компаратор ключей (прозрачный компаратор включает поиск по
+ * сравнимым с Key типам)
+ * @tparam Allocator Аллокатор пар ключ-значение, для узлов он
+ * перепривязывается к типу узла
+ * @tparam Policy Политика дерева (DefaultTreePolicy или PooledTreePolicy)
  */
-template <typename Key, typename T>
-class map : public s21::RBTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          typename Policy = DefaultTreePolicy>
+class map : public s21::RBTree<Key, T, Compare, Allocator, Policy> {
  public:
+  /// Базовое дерево
+  using Base = s21::RBTree<Key, T, Compare, Allocator, Policy>;
   class MapIterator;
   class ConstMapIterator;
 
@@ -27,15 +36,36 @@ class map : public s21::RBTree<Key, T> {
   using const_reference = const value_type &;
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using node_type = typename Base::NodeHandle;
+  using insert_return_type = typename Base::template InsertReturn<iterator>;
 
-  using RBTree<Key, T>::findNode;
-  using RBTreeNode = typename RBTree<Key, T>::RBTreeNode;
+  using Base::findNode;
+  using RBTreeNode = typename Base::RBTreeNode;
 
   /**
    * @brief Конструктор по умолчанию
    */
-  map() : s21::RBTree<Key, T>() {};
+  map() : Base() {};
+
+  /**
+   * @brief Конструктор с аллокатором
+   * @param alloc Аллокатор, из которого выделяются узлы
+   */
+  explicit map(const allocator_type &alloc) : Base(alloc) {}
+
+  /**
+   * @brief Конструктор с компаратором
+   * @param comp Компаратор ключей
+   * @param alloc Аллокатор, из которого выделяются узлы
+   */
+  explicit map(const key_compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : Base(comp, alloc) {}
 
   /**
    * @brief Конструктор с инициализацией через список
@@ -43,24 +73,55 @@ class map : public s21::RBTree<Key, T> {
    */
   map(std::initializer_list<value_type> const &items);
 
+  /**
+   * @brief Конструктор из диапазона
+   * @details Отсортированный по ключам диапазон строится за O(n), иначе
+   * элементы сначала сортируются. Из одинаковых ключей остается первый
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   * @param comp Компаратор ключей
+   * @param alloc Аллокатор, из которого выделяются узлы
+   */
+  template <typename InputIt>
+  map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+      const allocator_type &alloc = allocator_type())
+      : Base(first, last, comp, alloc) {}
+
   /**
    * @brief Конструктор копирования
    * @param other Другой объект map для копирования
    */
-  map(const map &other) : s21::RBTree<Key, T>(other) {};
+  map(const map &other) : Base(other) {};
 
   /**
    * @brief Конструктор перемещения
    * @param other Другой объект map для перемещения
    */
-  map(map &&other) noexcept : s21::RBTree<Key, T>(std::move(other)) {};
+  map(map &&other) noexcept : Base(std::move(other)) {};
+
+  /**
+   * @brief Конструктор копирования с аллокатором
+   * @param other Другой объект map для копирования
+   * @param alloc Аллокатор, из которого выделяются узлы копии
+   */
+  map(const map &other, const allocator_type &alloc) : Base(other, alloc) {}
+
+  /**
+   * @brief Конструктор перемещения с аллокатором
+   * @details При разных аллокаторах элементы перемещаются в новые узлы
+   * @param other Другой объект map для перемещения
+   * @param alloc Аллокатор, из которого выделяются узлы
+   */
+  map(map &&other, const allocator_type &alloc)
+      : Base(std::move(other), alloc) {}
 
   /**
    * @brief Оператор присваивания перемещением
    * @param other Другой объект map для перемещения
    * @return Ссылка на текущий объект
    */
-  map &operator=(map &&other) noexcept;
+  map &operator=(map &&other) noexcept(
+      std::is_nothrow_move_assignable_v<Base>);
 
   /**
    * @brief Оператор присваивания копированием
@@ -86,6 +147,8 @@ class map : public s21::RBTree<Key, T> {
   /**
    * @brief Объединяет два контейнера
    * @param other Другой контейнер для объединения
+   * @details Узлы с новыми ключами переносятся без копирования элементов,
+   * элементы с совпавшими ключами остаются в other
    */
   void merge(map &other);
 
@@ -95,25 +158,113 @@ class map : public s21::RBTree<Key, T> {
    */
   void swap(map &other) noexcept;
 
+  /**
+   * @brief Разделяет словарь по ключу за O(log n)
+   * @details Элементы с ключом меньше key остаются в словаре
+   * @param key Граница разделения
+   * @return Словарь с ключами не меньше key
+   */
+  map split(const Key &key);
+
+  /**
+   * @brief Присоединяет словарь с большими ключами за O(log n)
+   * @param right Словарь, все ключи которого больше ключей текущего,
+   * становится пустым
+   * @throw std::invalid_argument Если диапазоны ключей пересекаются
+   */
+  void join(map &right);
+
+  /**
+   * @brief Присоединяет опорный элемент и словарь с большими ключами
+   * @param pivot Элемент, ключ которого больше ключей словаря и меньше
+   * ключей right
+   * @param right Словарь с большими ключами, становится пустым
+   * @throw std::invalid_argument Если ключи нарушают порядок
+   */
+  void join(const value_type &pivot, map &right);
+
+  /**
+   * @brief Объединяет словарь с другим за O(m log(n/m + 1))
+   * @details Отсутствующие ключи добавляются, для совпавших значение
+   * становится combine(наше, их). Рассчитано на вливание малой дельты в
+   * большой словарь: узлы словаря вдали от ключей дельты не посещаются
+   * @param other Добавляемый словарь (std::move избегает копирования)
+   * @param combine Функтор объединения значений, по умолчанию значение
+   * словаря сохраняется
+   */
+  template <typename Combine = KeepExistingValue>
+  void set_union(map other, Combine combine = Combine());
+
+  /**
+   * @brief Оставляет в словаре только ключи, которые есть в other
+   * @param other Словарь ключей, которые нужно оставить
+   * @param combine Функтор объединения значений совпавших ключей
+   */
+  template <typename Combine = KeepExistingValue>
+  void set_intersection(map other, Combine combine = Combine());
+
+  /**
+   * @brief Удаляет из словаря ключи, которые есть в other
+   * @param other Словарь удаляемых ключей
+   */
+  void set_difference(map other);
+
+  /**
+   * @brief Объединяет словарь с другим, используя пул потоков
+   * @details Ниже map::kParallelCutoff и для пула узлов работает как
+   * set_union
+   * @param other Добавляемый словарь
+   * @param pool Пул потоков
+   * @param combine Функтор объединения значений, вызывается из разных потоков
+   */
+  template <typename Combine = KeepExistingValue>
+  void parallel_union(map other, TaskPool &pool, Combine combine = Combine());
+
+  /**
+   * @brief Пересекает словарь с другим, используя пул потоков
+   * @param other Словарь ключей, которые нужно оставить
+   * @param pool Пул потоков
+   * @param combine Функтор объединения значений, вызывается из разных потоков
+   */
+  template <typename Combine = KeepExistingValue>
+  void parallel_intersection(map other, TaskPool &pool,
+                             Combine combine = Combine());
+
+  /**
+   * @brief Удаляет из словаря ключи другого словаря, используя пул потоков
+   * @param other Словарь удаляемых ключей
+   * @param pool Пул потоков
+   */
+  void parallel_difference(map other, TaskPool &pool);
+
+  /**
+   * @brief Вставляет диапазон пар, используя пул потоков
+   * @details Имеющиеся ключи не меняются, из повторов в диапазоне остается
+   * первый
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   * @param pool Пул потоков
+   */
+  template <typename InputIt>
+  void parallel_insert(InputIt first, InputIt last, TaskPool &pool);
+
   /**
    * @brief Класс итератора для map
    */
-  class MapIterator : public s21::RBTree<Key, T>::Iterator {
+  class MapIterator : public Base::Iterator {
    public:
     friend class map;
-    using RBTree = s21::RBTree<Key, T>;
+    using RBTree = Base;
     using RBTreeNode = typename RBTree::RBTreeNode;
-    MapIterator() : s21::RBTree<Key, T>::Iterator() {}
-    MapIterator(typename s21::RBTree<Key, T>::Iterator it)
-        : s21::RBTree<Key, T>::Iterator(it) {}
-    MapIterator(RBTreeNode *node, RBTreeNode *past_node)
-        : RBTree::Iterator(node, past_node) {}
+    MapIterator() : Base::Iterator() {}
+    MapIterator(typename Base::Iterator it) : Base::Iterator(it) {}
+    explicit MapIterator(RBTreeNode *node) : RBTree::Iterator(node) {}
 
     /**
      * @brief Оператор разыменования итератора
-     * @return Пара ключ-значение
+     * @return Ссылка на пару ключ-значение
      */
-    value_type operator*() const;
+    reference operator*() const;
 
     /**
      * @brief Оператор доступа к члену через указатель
@@ -133,6 +284,18 @@ class map : public s21::RBTree<Key, T> {
      */
     MapIterator operator++(int);
 
+    /**
+     * @brief Префиксный декремент итератора
+     * @return Ссылка на текущий итератор
+     */
+    MapIterator &operator--();
+
+    /**
+     * @brief Постфиксный декремент итератора
+     * @return Копия итератора до декремента
+     */
+    MapIterator operator--(int);
+
     /**
      * @brief Сравнение итераторов на неравенство
      * @param other Другой итератор
@@ -154,17 +317,51 @@ class map : public s21::RBTree<Key, T> {
   class ConstMapIterator : public MapIterator {
    public:
     friend class map;
-    using RBTree = s21::RBTree<Key, T>;
+    using RBTree = Base;
     using RBTreeNode = typename RBTree::RBTreeNode;
     ConstMapIterator() : MapIterator() {}
     ConstMapIterator(typename RBTree::ConstIterator it)
-        : MapIterator(it.iter_node_, it.past_node_) {}
+        : MapIterator(it.iter_node_) {}
+    ConstMapIterator(const MapIterator &it) : MapIterator(it) {}
+
+    using pointer = const value_type *;
+    using reference = const value_type &;
 
     /**
      * @brief Оператор разыменования константного итератора
-     * @return Пара ключ-значение
+     * @return Константная ссылка на пару ключ-значение в узле
+     */
+    const_reference operator*() const;
+
+    /**
+     * @brief Оператор доступа к члену через указатель
+     * @return Указатель на неизменяемую пару ключ-значение
+     */
+    const value_type *operator->() const;
+
+    /**
+     * @brief Префиксный инкремент константного итератора
+     * @return Ссылка на текущий итератор
      */
-    value_type operator*() const;
+    ConstMapIterator &operator++();
+
+    /**
+     * @brief Постфиксный инкремент константного итератора
+     * @return Копия итератора до инкремента
+     */
+    ConstMapIterator operator++(int);
+
+    /**
+     * @brief Префиксный декремент константного итератора
+     * @return Ссылка на текущий итератор
+     */
+    ConstMapIterator &operator--();
+
+    /**
+     * @brief Постфиксный декремент константного итератора
+     * @return Копия итератора до декремента
+     */
+    ConstMapIterator operator--(int);
 
     /**
      * @brief Сравнение константных итераторов на равенство
@@ -189,6 +386,13 @@ class map : public s21::RBTree<Key, T> {
    */
   T &operator[](const Key &key);
 
+  /**
+   * @brief Доступ к элементу по ключу
+   * @param key Ключ элемента (перемещается только при вставке)
+   * @return Ссылка на значение
+   */
+  T &operator[](Key &&key);
+
   /**
    * @brief Вставляет элемент
    * @param value Пара ключ-значение для вставки
@@ -196,6 +400,14 @@ class map : public s21::RBTree<Key, T> {
    */
   std::pair<iterator, bool> insert(const value_type &value);
 
+  /**
+   * @brief Вставляет элемент, перемещая его в узел
+   * @param value Пара ключ-значение для вставки
+   * @return Пара итератор и флаг успешности вставки
+   * @details Если ключ уже есть, value не изменяется
+   */
+  std::pair<iterator, bool> insert(value_type &&value);
+
   /**
    * @brief Вставляет элемент
    * @param key Ключ для вставки
@@ -204,13 +416,119 @@ class map : public s21::RBTree<Key, T> {
    */
   std::pair<iterator, bool> insert(const Key &key, const T &obj);
 
+  /**
+   * @brief Вставляет элемент, перемещая значение в узел
+   * @param key Ключ для вставки
+   * @param obj Значение для вставки (не изменяется, если ключ уже есть)
+   * @return Пара итератор и флаг успешности вставки
+   */
+  std::pair<iterator, bool> insert(const Key &key, T &&obj);
+
+  /**
+   * @brief Строит элемент прямо в узле
+   * @tparam Args Типы аргументов конструктора пары ключ-значение
+   * @param args Аргументы конструктора пары ключ-значение
+   * @return Пара итератор и флаг успешности вставки
+   * @details Ключ известен только после построения пары, поэтому при
+   * повторном ключе построенный узел удаляется. Если ключ известен заранее,
+   * дешевле try_emplace
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  /**
+   * @brief Строит значение в узле, только если ключа еще нет
+   * @tparam Args Типы аргументов конструктора значения
+   * @param key Ключ элемента
+   * @param args Аргументы конструктора значения
+   * @return Пара итератор и флаг успешности вставки
+   * @details При повторном ключе args не используются
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+
+  /**
+   * @brief Строит значение в узле, только если ключа еще нет
+   * @tparam Args Типы аргументов конструктора значения
+   * @param key Ключ элемента (перемещается только при вставке)
+   * @param args Аргументы конструктора значения
+   * @return Пара итератор и флаг успешности вставки
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+  /**
+   * @brief Строит значение по подсказке, только если ключа еще нет
+   * @tparam Args Типы аргументов конструктора значения
+   * @param hint Итератор, перед которым ожидается элемент
+   * @param key Ключ элемента
+   * @param args Аргументы конструктора значения
+   * @return Итератор на вставленный элемент или элемент с тем же ключом
+   */
+  template <typename... Args>
+  iterator try_emplace(const_iterator hint, const Key &key, Args &&...args);
+
+  /**
+   * @brief Строит значение по подсказке, только если ключа еще нет
+   * @tparam Args Типы аргументов конструктора значения
+   * @param hint Итератор, перед которым ожидается элемент
+   * @param key Ключ элемента (перемещается только при вставке)
+   * @param args Аргументы конструктора значения
+   * @return Итератор на вставленный элемент или элемент с тем же ключом
+   */
+  template <typename... Args>
+  iterator try_emplace(const_iterator hint, Key &&key, Args &&...args);
+
+  /**
+   * @brief Вставляет элемент по подсказке
+   * @details Если элемент должен стоять прямо перед hint, место находится
+   * без спуска от корня: вставка возрастающих ключей с hint = end()
+   * выполняется за амортизированное O(1)
+   * @param hint Итератор, перед которым ожидается элемент
+   * @param value Пара ключ-значение для вставки
+   * @return Итератор на вставленный элемент или элемент с тем же ключом
+   */
+  iterator insert(const_iterator hint, const value_type &value);
+
+  /**
+   * @brief Вставляет элемент по подсказке, перемещая его в узел
+   * @param hint Итератор, перед которым ожидается элемент
+   * @param value Пара ключ-значение для вставки
+   * @return Итератор на вставленный элемент или элемент с тем же ключом
+   */
+  iterator insert(const_iterator hint, value_type &&value);
+
+  /**
+   * @brief Строит элемент на месте и вставляет его по подсказке
+   * @tparam Args Типы аргументов конструктора пары ключ-значение
+   * @param hint Итератор, перед которым ожидается элемент
+   * @param args Аргументы конструктора пары ключ-значение
+   * @return Итератор на вставленный элемент или элемент с тем же ключом
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
+
   /**
    * @brief Вставляет элемент или обновляет существующий
+   * @details Один спуск от корня: существующему значению присваивается obj,
+   * иначе значение строится из obj прямо в новом узле
+   * @tparam M Тип значения, присваиваемого T
    * @param key Ключ для вставки/обновления
    * @param obj Значение для вставки/обновления
    * @return Пара итератор и флаг успешности вставки
    */
-  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj);
+
+  /**
+   * @brief Вставляет элемент или обновляет существующий
+   * @tparam M Тип значения, присваиваемого T
+   * @param key Ключ (перемещается только при вставке)
+   * @param obj Значение для вставки/обновления
+   * @return Пара итератор и флаг успешности вставки
+   */
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj);
 
   /**
    * @brief Вставляет несколько элементов
@@ -227,6 +545,27 @@ class map : public s21::RBTree<Key, T> {
    */
   void erase(iterator pos);
 
+  /**
+   * @brief Извлекает узел без копирования элемента
+   * @param pos Итератор на извлекаемый элемент
+   * @return Дескриптор узла (пустой для end())
+   */
+  node_type extract(iterator pos);
+
+  /**
+   * @brief Извлекает узел по ключу
+   * @param key Ключ извлекаемого элемента
+   * @return Дескриптор узла (пустой, если ключа нет)
+   */
+  node_type extract(const Key &key);
+
+  /**
+   * @brief Вставляет извлеченный узел
+   * @param node Дескриптор узла
+   * @return Позиция, флаг вставки и узел, если ключ уже есть
+   */
+  insert_return_type insert(node_type &&node);
+
   /**
    * @brief Находит элемент по ключу
    * @param key Ключ для поиска
@@ -241,6 +580,129 @@ class map : public s21::RBTree<Key, T> {
    */
   const_iterator find(const Key &key) const;
 
+  /**
+   * @brief Находит элемент по значению, сравнимому с ключом
+   * @details Доступно только при прозрачном компараторе, временный Key не
+   * строится
+   * @param key Значение для поиска (например, std::string_view)
+   * @return Итератор на найденный элемент
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
+  /**
+   * @brief Находит элемент по значению, сравнимому с ключом (константная
+   * версия)
+   * @param key Значение для поиска
+   * @return Константный итератор на найденный элемент
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const;
+
+  /**
+   * @brief Находит первый элемент с ключом не меньше key
+   * @details Спуск от корня за O(log n)
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  iterator lower_bound(const Key &key);
+
+  /**
+   * @brief Находит первый элемент с ключом не меньше key (константная версия)
+   * @param key Ключ
+   * @return Константный итератор на элемент или end()
+   */
+  const_iterator lower_bound(const Key &key) const;
+
+  /**
+   * @brief Находит первый элемент с ключом больше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  iterator upper_bound(const Key &key);
+
+  /**
+   * @brief Находит первый элемент с ключом больше key (константная версия)
+   * @param key Ключ
+   * @return Константный итератор на элемент или end()
+   */
+  const_iterator upper_bound(const Key &key) const;
+
+  /**
+   * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+   * @param key Ключ
+   * @return Пара lower_bound(key) и upper_bound(key)
+   */
+  std::pair<iterator, iterator> equal_range(const Key &key);
+
+  /**
+   * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+   * (константная версия)
+   * @param key Ключ
+   * @return Пара lower_bound(key) и upper_bound(key)
+   */
+  std::pair<const_iterator, const_iterator> equal_range(const Key &key) const;
+
+  /**
+   * @brief Находит первый элемент с ключом не меньше key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключом
+   * @return Итератор на элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+
+  /**
+   * @brief Находит первый элемент с ключом не меньше key (константная версия)
+   * @param key Значение, сравнимое с ключом
+   * @return Константный итератор на элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const;
+
+  /**
+   * @brief Находит первый элемент с ключом больше key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключом
+   * @return Итератор на элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+
+  /**
+   * @brief Находит первый элемент с ключом больше key (константная версия)
+   * @param key Значение, сравнимое с ключом
+   * @return Константный итератор на элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const;
+
+  /**
+   * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключом
+   * @return Пара lower_bound(key) и upper_bound(key)
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key);
+
+  /**
+   * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+   * (константная версия)
+   * @param key Значение, сравнимое с ключом
+   * @return Пара lower_bound(key) и upper_bound(key)
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+
   /**
    * @brief Возвращает константный итератор на начало контейнера
    * @return Константный итератор на первый элемент
@@ -253,6 +715,58 @@ class map : public s21::RBTree<Key, T> {
    */
   const_iterator end() const;
 
+  /**
+   * @brief Возвращает константный итератор на начало контейнера
+   * @return Константный итератор на первый элемент
+   */
+  const_iterator cbegin() const { return begin(); }
+
+  /**
+   * @brief Возвращает константный итератор на конец контейнера
+   * @return Константный итератор на элемент после последнего
+   */
+  const_iterator cend() const { return end(); }
+
+  /**
+   * @brief Возвращает обратный итератор на последний элемент
+   * @return Обратный итератор, обход от большего ключа к меньшему
+   */
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+  /**
+   * @brief Возвращает обратный итератор за первым элементом
+   * @return Обратный итератор конца обратного обхода
+   */
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  /**
+   * @brief Возвращает константный обратный итератор на последний элемент
+   * @return Константный обратный итератор
+   */
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+
+  /**
+   * @brief Возвращает константный обратный итератор за первым элементом
+   * @return Константный обратный итератор
+   */
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  /**
+   * @brief Возвращает константный обратный итератор на последний элемент
+   * @return Константный обратный итератор
+   */
+  const_reverse_iterator crbegin() const { return rbegin(); }
+
+  /**
+   * @brief Возвращает константный обратный итератор за первым элементом
+   * @return Константный обратный итератор
+   */
+  const_reverse_iterator crend() const { return rend(); }
+
   /**
    * @brief Проверяет, пуст ли контейнер
    * @return true, если контейнер пуст, иначе false
@@ -283,8 +797,86 @@ class map : public s21::RBTree<Key, T> {
    * @return true, если элемент найден, иначе false
    */
   bool contains(const Key &key) const;
+
+  /**
+   * @brief Проверяет наличие элемента с ключом, эквивалентным key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение для проверки
+   * @return true, если элемент найден, иначе false
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Находит элементы для последовательности ключей
+   * @details Спуски идут группами с prefetch следующего узла (см.
+   * RBTree::find_many), результаты пишутся в порядке ключей
+   * @param first Начало последовательности ключей
+   * @param last Конец последовательности ключей
+   * @param out Начало вывода: итератор на элемент или end() для каждого ключа
+   * @return Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  /**
+   * @brief Проверяет наличие последовательности ключей
+   * @param first Начало последовательности ключей
+   * @param last Конец последовательности ключей
+   * @param out Начало вывода bool для каждого ключа
+   * @return Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  /**
+   * @brief Создает неизменяемый снимок словаря для быстрого поиска
+   * @details Ключи раскладываются в порядке Эйтцингера за O(n), значения
+   * копируются в отдельный массив. Дальнейшие изменения словаря на снимок
+   * не влияют
+   * @return Снимок словаря
+   */
+  frozen_map<Key, T, Compare> freeze() const;
+
+  /**
+   * @brief Находит k-й по порядку ключей элемент
+   * @details Требует политики с порядковой статистикой
+   * (OrderStatisticTreePolicy), работает за O(log n)
+   * @param k Номер элемента, начиная с 0
+   * @return Итератор на элемент или end(), если k >= size()
+   */
+  iterator nth(size_type k);
+
+  /**
+   * @brief Находит k-й по порядку ключей элемент (константная версия)
+   * @param k Номер элемента, начиная с 0
+   * @return Константный итератор на элемент или end()
+   */
+  const_iterator nth(size_type k) const;
+
+  /**
+   * @brief Возвращает количество элементов с ключом меньше key
+   * @details Требует политики с порядковой статистикой, работает за O(log n)
+   * @param key Ключ
+   * @return Позиция, которую занял бы key в порядке обхода
+   */
+  size_type rank(const Key &key) const;
 };
 
+namespace pmr {
+
+/// Словарь, выделяющий узлы из std::pmr::memory_resource
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Policy = DefaultTreePolicy>
+using map = s21::map<Key, T, Compare,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>,
+                     Policy>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 // clang-format off
@@ -11,26 +11,37 @@ namespace s21 {
  * @return Ссылка на значение
  * @throw std::out_of_range Если ключ не найден
  */
-template <typename Key, typename T>
-typename s21::map<Key, T>::mapped_type& s21::map<Key, T>::at(const Key& key) {
-  typename RBTree<Key, T>::RBTreeNode* node = findNode(key);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename s21::map<Key, T, Compare, Allocator, Policy>::mapped_type&
+s21::map<Key, T, Compare, Allocator, Policy>::at(const Key& key) {
+  typename Base::RBTreeNode* node = findNode(key);
   if (!node) throw std::out_of_range("Key not found");
-  return node->value;
+  return node->value();
 }
 
 /**
  * @brief Доступ к элементу по ключу, добавляет элемент, если ключ не найден
  * @param key Ключ элемента
  * @return Ссылка на значение
+ * @details Один спуск от корня, новое значение инициализируется прямо в
+ * узле без временного T
  */
-template <typename Key, typename T>
-T& map<Key, T>::operator[](const Key& key) {
-  auto it = find(key);
-  if (it == end()) {
-    auto [inserted_it, success] = insert({key, T()});
-    return inserted_it.iter_node_->value;
-  }
-  return it.iter_node_->value;
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+T& map<Key, T, Compare, Allocator, Policy>::operator[](const Key& key) {
+  return (*try_emplace(key).first).second;
+}
+
+/**
+ * @brief Доступ к элементу по ключу, добавляет элемент, если ключ не найден
+ * @param key Ключ элемента (перемещается в узел только при вставке)
+ * @return Ссылка на значение
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+T& map<Key, T, Compare, Allocator, Policy>::operator[](Key&& key) {
+  return (*try_emplace(std::move(key)).first).second;
 }
 
 }  // namespace s21
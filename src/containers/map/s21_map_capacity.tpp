@@ -9,18 +9,21 @@ namespace s21 {
  * @brief Проверяет, пуст ли контейнер
  * @return true, если контейнер пуст, иначе false
  */
-template <typename Key, typename T>
-bool map<Key, T>::empty() const noexcept {
-  return RBTree<Key, T>::empty();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::empty() const noexcept {
+  return Base::empty();
 }
 
 /**
  * @brief Возвращает количество элементов в контейнере
  * @return Количество элементов
  */
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::size() const noexcept {
-  return RBTree<Key, T>::size();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type
+map<Key, T, Compare, Allocator, Policy>::size() const noexcept {
+  return Base::size();
 }
 
 /**
@@ -28,9 +31,11 @@ typename map<Key, T>::size_type map<Key, T>::size() const noexcept {
  * контейнер
  * @return Максимальное количество элементов
  */
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::max_size() const noexcept {
-  return RBTree<Key, T>::max_size();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type
+map<Key, T, Compare, Allocator, Policy>::max_size() const noexcept {
+  return Base::max_size();
 }
 
 }  // namespace s21
@@ -8,24 +8,26 @@ namespace s21 {
 /**
  * @brief Конструктор с инициализацией через список
  * @param items Список элементов для инициализации
+ * @details Дерево строится за O(n), если ключи в списке упорядочены
  */
-template <typename Key, typename T>
-map<Key, T>::map(const std::initializer_list<value_type> &items)
-    : s21::RBTree<Key, T>() {
-  for (const auto &item : items) {
-    insert(item);
-  }
-}
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+map<Key, T, Compare, Allocator, Policy>::map(
+    const std::initializer_list<value_type> &items)
+    : Base(items.begin(), items.end()) {}
 
 /**
  * @brief Оператор присваивания перемещением
  * @param other Другой объект map для перемещения
  * @return Ссылка на текущий объект
  */
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(map &&other) noexcept {
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+map<Key, T, Compare, Allocator, Policy> &
+map<Key, T, Compare, Allocator, Policy>::operator=(
+    map &&other) noexcept(std::is_nothrow_move_assignable_v<Base>) {
   if (this != &other) {
-    s21::RBTree<Key, T>::operator=(std::move(other));
+    Base::operator=(std::move(other));
   }
   return *this;
 }
@@ -35,10 +37,12 @@ map<Key, T> &map<Key, T>::operator=(map &&other) noexcept {
  * @param other Другой объект map для копирования
  * @return Ссылка на текущий объект
  */
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(const map &other) {
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+map<Key, T, Compare, Allocator, Policy> &
+map<Key, T, Compare, Allocator, Policy>::operator=(const map &other) {
   if (this != &other) {
-    s21::RBTree<Key, T>::operator=(other);
+    Base::operator=(other);
   }
   return *this;
 }
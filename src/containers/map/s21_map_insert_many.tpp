@@ -11,10 +11,12 @@ namespace s21 {
  * @param args Аргументы для вставки
  * @return Вектор пар итератор и флаг успешности вставки
  */
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
 template <class... Args>
-s21::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args &&...args) {
+s21::vector<
+    std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>>
+map<Key, T, Compare, Allocator, Policy>::insert_many(Args &&...args) {
   static_assert((std::is_constructible_v<value_type, Args> && ...),
                 "All arguments must be convertible to value_type");
   s21::vector<std::pair<iterator, bool>> vec;
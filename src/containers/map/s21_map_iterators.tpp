@@ -9,38 +9,44 @@ namespace s21 {
  * @brief Возвращает итератор на начало контейнера
  * @return Итератор на первый элемент
  */
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
-  return iterator(typename s21::RBTree<Key, T>::Iterator(
-      s21::RBTree<Key, T>::GetMin(s21::RBTree<Key, T>::GetRoot())));
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::begin() {
+  return iterator(Base::begin());
 }
 
 /**
  * @brief Возвращает итератор на конец контейнера
  * @return Итератор на элемент после последнего
  */
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
-  return iterator(typename s21::RBTree<Key, T>::Iterator(nullptr));
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::end() {
+  return iterator(Base::end());
 }
 
 /**
  * @brief Оператор разыменования итератора
- * @return Пара ключ-значение
+ * @return Ссылка на пару ключ-значение, хранящуюся в узле
  */
-template <typename Key, typename T>
-typename map<Key, T>::value_type map<Key, T>::MapIterator::operator*() const {
-  return std::make_pair(const_cast<const Key &>(this->iter_node_->key),
-                        this->iter_node_->value);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::reference
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator*() const {
+  return this->iter_node_->data;
 }
 
 /**
  * @brief Префиксный инкремент итератора
  * @return Ссылка на текущий итератор
  */
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator &map<Key, T>::MapIterator::operator++() {
-  s21::RBTree<Key, T>::Iterator::operator++();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::MapIterator &
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator++() {
+  Base::Iterator::operator++();
   return *this;
 }
 
@@ -48,20 +54,49 @@ typename map<Key, T>::MapIterator &map<Key, T>::MapIterator::operator++() {
  * @brief Постфиксный инкремент итератора
  * @return Копия итератора до инкремента
  */
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator map<Key, T>::MapIterator::operator++(int) {
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::MapIterator
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator++(int) {
   MapIterator temp = *this;
   ++(*this);
   return temp;
 }
 
+/**
+ * @brief Префиксный декремент итератора
+ * @return Ссылка на текущий итератор
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::MapIterator &
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator--() {
+  Base::Iterator::operator--();
+  return *this;
+}
+
+/**
+ * @brief Постфиксный декремент итератора
+ * @return Копия итератора до декремента
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::MapIterator
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator--(int) {
+  MapIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
 /**
  * @brief Сравнение итераторов на неравенство
  * @param other Другой итератор
  * @return true, если итераторы не равны, иначе false
  */
-template <typename Key, typename T>
-bool map<Key, T>::MapIterator::operator!=(const MapIterator &other) const {
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::MapIterator::operator!=(
+    const MapIterator &other) const {
   return this->iter_node_ != other.iter_node_;
 }
 
@@ -70,19 +105,84 @@ bool map<Key, T>::MapIterator::operator!=(const MapIterator &other) const {
  * @param other Другой итератор
  * @return true, если итераторы равны, иначе false
  */
-template <typename Key, typename T>
-bool map<Key, T>::MapIterator::operator==(const MapIterator &other) const {
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::MapIterator::operator==(
+    const MapIterator &other) const {
   return this->iter_node_ == other.iter_node_;
 }
 
 /**
  * @brief Оператор разыменования константного итератора
- * @return Пара ключ-значение
+ * @return Константная ссылка на пару ключ-значение в узле
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename s21::map<Key, T, Compare, Allocator, Policy>::const_reference
+s21::map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator*()
+    const {
+  return this->iter_node_->data;
+}
+
+/**
+ * @brief Оператор доступа к члену через константный итератор
+ * @return Указатель на неизменяемую пару ключ-значение
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+const typename map<Key, T, Compare, Allocator, Policy>::value_type *
+map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator->() const {
+  return &(this->iter_node_->data);
+}
+
+/**
+ * @brief Префиксный инкремент константного итератора
+ * @return Ссылка на текущий итератор
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::ConstMapIterator &
+map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator++() {
+  MapIterator::operator++();
+  return *this;
+}
+
+/**
+ * @brief Постфиксный инкремент константного итератора
+ * @return Копия итератора до инкремента
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::ConstMapIterator
+map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator++(int) {
+  ConstMapIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+/**
+ * @brief Префиксный декремент константного итератора
+ * @return Ссылка на текущий итератор
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::ConstMapIterator &
+map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator--() {
+  MapIterator::operator--();
+  return *this;
+}
+
+/**
+ * @brief Постфиксный декремент константного итератора
+ * @return Копия итератора до декремента
  */
-template <typename Key, typename T>
-typename s21::map<Key, T>::value_type
-s21::map<Key, T>::ConstMapIterator::operator*() const {
-  return {this->iter_node_->key, this->iter_node_->value};
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::ConstMapIterator
+map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator--(int) {
+  ConstMapIterator temp = *this;
+  --(*this);
+  return temp;
 }
 
 /**
@@ -90,8 +190,9 @@ s21::map<Key, T>::ConstMapIterator::operator*() const {
  * @param other Другой итератор
  * @return true, если итераторы равны, иначе false
  */
-template <typename Key, typename T>
-bool map<Key, T>::ConstMapIterator::operator==(
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::ConstMapIterator::operator==(
     const ConstMapIterator &other) const {
   return this->iter_node_ == other.iter_node_;
 }
@@ -100,9 +201,11 @@ bool map<Key, T>::ConstMapIterator::operator==(
  * @brief Оператор доступа к члену через указатель
  * @return Указатель на пару ключ-значение
  */
-template <typename Key, typename T>
-typename map<Key, T>::value_type *map<Key, T>::MapIterator::operator->() const {
-  return &(this->iter_node_->pair);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::value_type *
+map<Key, T, Compare, Allocator, Policy>::MapIterator::operator->() const {
+  return &(this->iter_node_->data);
 }
 
 }  // namespace s21
@@ -10,10 +10,12 @@ namespace s21 {
  * @param key Ключ для поиска
  * @return Итератор на найденный элемент или end(), если элемент не найден
  */
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
-  auto node = RBTree<Key, T>::find(key);
-  return node != RBTree<Key, T>::end() ? iterator(node) : this->end();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::find(const Key &key) {
+  auto node = Base::find(key);
+  return node != Base::end() ? iterator(node) : this->end();
 }
 
 /**
@@ -22,10 +24,12 @@ typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
  * @return Константный итератор на найденный элемент или end(), если элемент не
  * найден
  */
-template <typename Key, typename T>
-typename map<Key, T>::const_iterator map<Key, T>::find(const Key &key) const {
-  auto node = RBTree<Key, T>::find(key);
-  return node != RBTree<Key, T>::end() ? const_iterator(node) : this->end();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::find(const Key &key) const {
+  auto node = Base::find(key);
+  return node != Base::end() ? const_iterator(node) : this->end();
 }
 
 /**
@@ -33,9 +37,310 @@ typename map<Key, T>::const_iterator map<Key, T>::find(const Key &key) const {
  * @param key Ключ для проверки
  * @return true, если элемент найден, иначе false
  */
-template <typename Key, typename T>
-bool map<Key, T>::contains(const Key &key) const {
-  return RBTree<Key, T>::contains(key);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::contains(const Key &key) const {
+  return Base::contains(key);
+}
+
+/**
+ * @brief Находит элемент по значению, сравнимому с ключом
+ * @param key Значение для поиска
+ * @return Итератор на найденный элемент или end(), если элемент не найден
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::find(const K &key) {
+  auto node = Base::find(key);
+  return node != Base::end() ? iterator(node) : this->end();
+}
+
+/**
+ * @brief Находит элемент по значению, сравнимому с ключом (константная версия)
+ * @param key Значение для поиска
+ * @return Константный итератор на найденный элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::find(const K &key) const {
+  auto node = Base::find(key);
+  return node != Base::end() ? const_iterator(node) : this->end();
+}
+
+/**
+ * @brief Проверяет наличие элемента с ключом, эквивалентным key
+ * @param key Значение для проверки
+ * @return true, если элемент найден, иначе false
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+bool map<Key, T, Compare, Allocator, Policy>::contains(const K &key) const {
+  return Base::contains(key);
+}
+
+/**
+ * @brief Находит элементы для последовательности ключей
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода итераторов
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt map<Key, T, Compare, Allocator, Policy>::find_many(ForwardIt first,
+                                                            ForwardIt last,
+                                                            OutputIt out) {
+  Base::findNodes(first, last, [&](RBTreeNode *node) {
+    *out++ = node ? iterator(node) : this->end();
+  });
+  return out;
+}
+
+/**
+ * @brief Находит элементы для последовательности ключей (константная версия)
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода константных итераторов
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt map<Key, T, Compare, Allocator, Policy>::find_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  Base::findNodes(first, last, [&](RBTreeNode *node) {
+    *out++ = node ? const_iterator(iterator(node)) : this->end();
+  });
+  return out;
+}
+
+/**
+ * @brief Проверяет наличие последовательности ключей
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода bool
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt map<Key, T, Compare, Allocator, Policy>::contains_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  return Base::contains_many(first, last, out);
+}
+
+/**
+ * @brief Создает неизменяемый снимок словаря
+ * @return Снимок словаря
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+frozen_map<Key, T, Compare> map<Key, T, Compare, Allocator, Policy>::freeze()
+    const {
+  return frozen_map<Key, T, Compare>(this->begin(), this->end(),
+                                     this->key_comp());
+}
+
+/**
+ * @brief Находит первый элемент с ключом не меньше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::lower_bound(const Key &key) {
+  return iterator(Base::lower_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом не меньше key (константная версия)
+ * @param key Ключ
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::lower_bound(const Key &key) const {
+  return const_iterator(Base::lower_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом больше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::upper_bound(const Key &key) {
+  return iterator(Base::upper_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом больше key (константная версия)
+ * @param key Ключ
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::upper_bound(const Key &key) const {
+  return const_iterator(Base::upper_bound(key));
+}
+
+/**
+ * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+ * @param key Ключ
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator,
+          typename map<Key, T, Compare, Allocator, Policy>::iterator>
+map<Key, T, Compare, Allocator, Policy>::equal_range(const Key &key) {
+  auto range = Base::equal_range(key);
+  return {iterator(range.first), iterator(range.second)};
+}
+
+/**
+ * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+ * (константная версия)
+ * @param key Ключ
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::const_iterator,
+          typename map<Key, T, Compare, Allocator, Policy>::const_iterator>
+map<Key, T, Compare, Allocator, Policy>::equal_range(const Key &key) const {
+  auto range = Base::equal_range(key);
+  return {const_iterator(range.first), const_iterator(range.second)};
+}
+
+/**
+ * @brief Находит первый элемент с ключом не меньше key
+ * @param key Значение, сравнимое с ключом
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::lower_bound(const K &key) {
+  return iterator(Base::lower_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом не меньше key (константная версия)
+ * @param key Значение, сравнимое с ключом
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::lower_bound(const K &key) const {
+  return const_iterator(Base::lower_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом больше key
+ * @param key Значение, сравнимое с ключом
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::upper_bound(const K &key) {
+  return iterator(Base::upper_bound(key));
+}
+
+/**
+ * @brief Находит первый элемент с ключом больше key (константная версия)
+ * @param key Значение, сравнимое с ключом
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::upper_bound(const K &key) const {
+  return const_iterator(Base::upper_bound(key));
+}
+
+/**
+ * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+ * @param key Значение, сравнимое с ключом
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator,
+          typename map<Key, T, Compare, Allocator, Policy>::iterator>
+map<Key, T, Compare, Allocator, Policy>::equal_range(const K &key) {
+  auto range = Base::equal_range(key);
+  return {iterator(range.first), iterator(range.second)};
+}
+
+/**
+ * @brief Возвращает диапазон элементов с ключом, эквивалентным key
+ * (константная версия)
+ * @param key Значение, сравнимое с ключом
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::const_iterator,
+          typename map<Key, T, Compare, Allocator, Policy>::const_iterator>
+map<Key, T, Compare, Allocator, Policy>::equal_range(const K &key) const {
+  auto range = Base::equal_range(key);
+  return {const_iterator(range.first), const_iterator(range.second)};
+}
+
+/**
+ * @brief Находит k-й по порядку ключей элемент
+ * @param k Номер элемента, начиная с 0
+ * @return Итератор на элемент или end(), если k >= size()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::nth(size_type k) {
+  return iterator(Base::nth(k));
+}
+
+/**
+ * @brief Находит k-й по порядку ключей элемент (константная версия)
+ * @param k Номер элемента, начиная с 0
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::nth(size_type k) const {
+  return const_iterator(Base::nth(k));
+}
+
+/**
+ * @brief Возвращает количество элементов с ключом меньше key
+ * @param key Ключ
+ * @return Позиция, которую занял бы key в порядке обхода
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type
+map<Key, T, Compare, Allocator, Policy>::rank(const Key &key) const {
+  return Base::rank(key);
 }
 
 }  // namespace s21
@@ -10,14 +10,12 @@ namespace s21 {
  * @param value Пара ключ-значение для вставки
  * @return Пара итератор и флаг успешности вставки
  */
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type &value) {
-  bool success = !this->contains(value.first);
-  if (success) {
-    s21::RBTree<Key, T>::insert(value.first, value.second);
-  }
-  return {find(value.first), success};
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert(const value_type &value) {
+  auto [node, success] = Base::insertUnique(value.first, value);
+  return {iterator(node), success};
 }
 
 /**
@@ -26,14 +24,185 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
  * @param obj Значение для вставки
  * @return Пара итератор и флаг успешности вставки
  */
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  bool success = !this->contains(key);
-  if (success) {
-    s21::RBTree<Key, T>::insert(key, obj);
-  }
-  return {find(key), success};
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert(const Key &key, const T &obj) {
+  auto [node, success] = Base::insertUnique(key, key, obj);
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Вставляет элемент, перемещая его в узел
+ * @param value Пара ключ-значение для вставки
+ * @return Пара итератор и флаг успешности вставки
+ * @details Место ищется по ключу внутри value, перемещение выполняется
+ * только после поиска
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert(value_type &&value) {
+  auto [node, success] = Base::insertUnique(value.first, std::move(value));
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Вставляет элемент, перемещая значение в узел
+ * @param key Ключ для вставки
+ * @param obj Значение для вставки
+ * @return Пара итератор и флаг успешности вставки
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert(const Key &key, T &&obj) {
+  auto [node, success] = Base::insertUnique(key, key, std::move(obj));
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Строит элемент прямо в узле
+ * @param args Аргументы конструктора пары ключ-значение
+ * @return Пара итератор и флаг успешности вставки
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::emplace(Args &&...args) {
+  auto [node, success] =
+      Base::emplaceUniqueHint(nullptr, std::forward<Args>(args)...);
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Строит значение в узле, только если ключа еще нет
+ * @param key Ключ элемента
+ * @param args Аргументы конструктора значения
+ * @return Пара итератор и флаг успешности вставки
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::try_emplace(const Key &key,
+                                                     Args &&...args) {
+  auto [node, success] = Base::insertUnique(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Строит значение в узле, только если ключа еще нет
+ * @param key Ключ элемента (перемещается только при вставке)
+ * @param args Аргументы конструктора значения
+ * @return Пара итератор и флаг успешности вставки
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::try_emplace(Key &&key,
+                                                     Args &&...args) {
+  auto [node, success] = Base::insertUnique(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Строит значение по подсказке, только если ключа еще нет
+ * @param hint Итератор, перед которым ожидается элемент
+ * @param key Ключ элемента
+ * @param args Аргументы конструктора значения
+ * @return Итератор на вставленный элемент или элемент с тем же ключом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::try_emplace(const_iterator hint,
+                                                     const Key &key,
+                                                     Args &&...args) {
+  RBTreeNode *node =
+      Base::insertUniqueHint(hint.iter_node_, key, std::piecewise_construct,
+                             std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<Args>(args)...))
+          .first;
+  return iterator(node);
+}
+
+/**
+ * @brief Строит значение по подсказке, только если ключа еще нет
+ * @param hint Итератор, перед которым ожидается элемент
+ * @param key Ключ элемента (перемещается только при вставке)
+ * @param args Аргументы конструктора значения
+ * @return Итератор на вставленный элемент или элемент с тем же ключом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::try_emplace(const_iterator hint,
+                                                     Key &&key,
+                                                     Args &&...args) {
+  RBTreeNode *node =
+      Base::insertUniqueHint(hint.iter_node_, key, std::piecewise_construct,
+                             std::forward_as_tuple(std::move(key)),
+                             std::forward_as_tuple(std::forward<Args>(args)...))
+          .first;
+  return iterator(node);
+}
+
+/**
+ * @brief Вставляет элемент по подсказке
+ * @param hint Итератор, перед которым ожидается элемент
+ * @param value Пара ключ-значение для вставки
+ * @return Итератор на вставленный элемент или элемент с тем же ключом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::insert(const_iterator hint,
+                                                const value_type &value) {
+  return iterator(
+      Base::insertUniqueHint(hint.iter_node_, value.first, value).first);
+}
+
+/**
+ * @brief Вставляет элемент по подсказке, перемещая его в узел
+ * @param hint Итератор, перед которым ожидается элемент
+ * @param value Пара ключ-значение для вставки
+ * @return Итератор на вставленный элемент или элемент с тем же ключом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::insert(const_iterator hint,
+                                                value_type &&value) {
+  RBTreeNode *node =
+      Base::insertUniqueHint(hint.iter_node_, value.first, std::move(value))
+          .first;
+  return iterator(node);
+}
+
+/**
+ * @brief Строит элемент на месте и вставляет его по подсказке
+ * @param hint Итератор, перед которым ожидается элемент
+ * @param args Аргументы конструктора пары ключ-значение
+ * @return Итератор на вставленный элемент или элемент с тем же ключом
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+typename map<Key, T, Compare, Allocator, Policy>::iterator
+map<Key, T, Compare, Allocator, Policy>::emplace_hint(const_iterator hint,
+                                                      Args &&...args) {
+  return iterator(
+      Base::emplaceUniqueHint(hint.iter_node_, std::forward<Args>(args)...)
+          .first);
 }
 
 /**
@@ -41,86 +210,266 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
  * @param key Ключ для вставки/обновления
  * @param obj Значение для вставки/обновления
  * @return Пара итератор и флаг успешности вставки
+ * @details obj передается в insertUnique по ссылке и используется, только
+ * если узел создан, поэтому при найденном ключе его еще можно присвоить
  */
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
-  auto it = find(key);
-  if (it != this->end()) {
-    erase(it);
-    auto pr = insert(key, obj);
-    pr.second = false;
-    return pr;
-  }
-  return insert(key, obj);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename M>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert_or_assign(const Key &key,
+                                                          M &&obj) {
+  auto [node, inserted] = Base::insertUnique(key, key, std::forward<M>(obj));
+  if (!inserted) node->value() = std::forward<M>(obj);
+  return {iterator(node), inserted};
+}
+
+/**
+ * @brief Вставляет элемент или обновляет существующий
+ * @param key Ключ (перемещается только при вставке)
+ * @param obj Значение для вставки/обновления
+ * @return Пара итератор и флаг успешности вставки
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename M>
+std::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool>
+map<Key, T, Compare, Allocator, Policy>::insert_or_assign(Key &&key,
+                                                          M &&obj) {
+  auto [node, inserted] =
+      Base::insertUnique(key, std::move(key), std::forward<M>(obj));
+  if (!inserted) node->value() = std::forward<M>(obj);
+  return {iterator(node), inserted};
 }
 
 /**
  * @brief Объединяет два контейнера
  * @param other Другой контейнер для объединения
  */
-template <typename Key, typename T>
-void map<Key, T>::merge(map &other) {
-  if (this != &other) {
-    auto it = other.begin();
-    while (it != other.end()) {
-      if (!this->contains((*it).first)) {
-        this->insert(*it);
-        auto current = it;
-        ++it;
-        other.erase(current);
-      } else {
-        ++it;
-      }
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::merge(map &other) {
+  Base::merge(other);
+}
+
+/**
+ * @brief Разделяет словарь по ключу
+ * @param key Граница разделения
+ * @return Словарь с ключами не меньше key
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+map<Key, T, Compare, Allocator, Policy>
+map<Key, T, Compare, Allocator, Policy>::split(const Key &key) {
+  map right(this->key_comp(), this->get_allocator());
+  Base::splitInto(key, right);
+  return right;
+}
+
+/**
+ * @brief Присоединяет словарь с большими ключами
+ * @param right Словарь с большими ключами
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::join(map &right) {
+  Base::join(right);
+}
+
+/**
+ * @brief Присоединяет опорный элемент и словарь с большими ключами
+ * @param pivot Опорный элемент
+ * @param right Словарь с большими ключами
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::join(const value_type &pivot,
+                                                   map &right) {
+  Base::join(pivot, right);
+}
+
+/**
+ * @brief Объединяет словарь с другим
+ * @param other Добавляемый словарь
+ * @param combine Функтор объединения значений
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void map<Key, T, Compare, Allocator, Policy>::set_union(map other,
+                                                        Combine combine) {
+  Base::set_union(std::move(other), std::move(combine));
+}
+
+/**
+ * @brief Оставляет в словаре только ключи, которые есть в other
+ * @param other Словарь ключей, которые нужно оставить
+ * @param combine Функтор объединения значений
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void map<Key, T, Compare, Allocator, Policy>::set_intersection(
+    map other, Combine combine) {
+  Base::set_intersection(std::move(other), std::move(combine));
+}
+
+/**
+ * @brief Удаляет из словаря ключи, которые есть в other
+ * @param other Словарь удаляемых ключей
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::set_difference(map other) {
+  Base::set_difference(std::move(other));
+}
+
+/**
+ * @brief Объединяет словарь с другим, используя пул потоков
+ * @param other Добавляемый словарь
+ * @param pool Пул потоков
+ * @param combine Функтор объединения значений
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void map<Key, T, Compare, Allocator, Policy>::parallel_union(map other,
+                                                             TaskPool &pool,
+                                                             Combine combine) {
+  Base::parallel_union(std::move(other), pool, std::move(combine));
+}
+
+/**
+ * @brief Пересекает словарь с другим, используя пул потоков
+ * @param other Словарь ключей, которые нужно оставить
+ * @param pool Пул потоков
+ * @param combine Функтор объединения значений
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void map<Key, T, Compare, Allocator, Policy>::parallel_intersection(
+    map other, TaskPool &pool, Combine combine) {
+  Base::parallel_intersection(std::move(other), pool, std::move(combine));
+}
+
+/**
+ * @brief Удаляет из словаря ключи другого словаря, используя пул потоков
+ * @param other Словарь удаляемых ключей
+ * @param pool Пул потоков
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::parallel_difference(
+    map other, TaskPool &pool) {
+  Base::parallel_difference(std::move(other), pool);
+}
+
+/**
+ * @brief Вставляет диапазон пар, используя пул потоков
+ * @param first Начало диапазона
+ * @param last Конец диапазона
+ * @param pool Пул потоков
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+template <typename InputIt>
+void map<Key, T, Compare, Allocator, Policy>::parallel_insert(InputIt first,
+                                                              InputIt last,
+                                                              TaskPool &pool) {
+  Base::parallel_insert(first, last, pool);
 }
 
 /**
  * @brief Удаляет элемент по итератору
  * @param pos Итератор на удаляемый элемент
  */
-template <typename Key, typename T>
-void map<Key, T>::erase(iterator pos) {
-  if (pos.iter_node_ == nullptr) {
-    throw std::invalid_argument("Invalid iterator: null pointer");
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::erase(iterator pos) {
+  if (pos.iter_node_ == nullptr || pos == end()) {
+    throw std::invalid_argument("Invalid iterator");
   }
-  RBTree<Key, T>::remove(pos.iter_node_->key);
+  Base::eraseNode(pos.iter_node_);
+}
+
+/**
+ * @brief Извлекает узел без копирования элемента
+ * @param pos Итератор на извлекаемый элемент
+ * @return Дескриптор узла (пустой для end())
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::node_type
+map<Key, T, Compare, Allocator, Policy>::extract(iterator pos) {
+  return Base::extract(typename Base::Iterator(pos.iter_node_));
+}
+
+/**
+ * @brief Извлекает узел по ключу
+ * @param key Ключ извлекаемого элемента
+ * @return Дескриптор узла (пустой, если ключа нет)
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::node_type
+map<Key, T, Compare, Allocator, Policy>::extract(const Key &key) {
+  return Base::extract(key);
+}
+
+/**
+ * @brief Вставляет извлеченный узел
+ * @param node Дескриптор узла
+ * @return Позиция, флаг вставки и узел, если ключ уже есть
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::insert_return_type
+map<Key, T, Compare, Allocator, Policy>::insert(node_type &&node) {
+  auto result = Base::insert(std::move(node));
+  return {iterator(result.position.iter_node_), result.inserted,
+          std::move(result.node)};
 }
 
 /**
  * @brief Обменивает содержимое двух контейнеров
  * @param other Другой контейнер для обмена
  */
-template <typename Key, typename T>
-void map<Key, T>::swap(map &other) noexcept {
-  s21::RBTree<Key, T>::swap(other);
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::swap(map &other) noexcept {
+  Base::swap(other);
 }
 
 /**
  * @brief Очищает контейнер
  */
-template <typename Key, typename T>
-void map<Key, T>::clear() noexcept {
-  RBTree<Key, T>::clear();
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::clear() noexcept {
+  Base::clear();
 }
 
 /**
  * @brief Возвращает константный итератор на начало контейнера
  * @return Константный итератор на первый элемент
  */
-template <typename Key, typename T>
-typename map<Key, T>::const_iterator map<Key, T>::begin() const {
-  return const_iterator(RBTree<Key, T>::cbegin());
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::begin() const {
+  return const_iterator(Base::cbegin());
 }
 
 /**
  * @brief Возвращает константный итератор на конец контейнера
  * @return Константный итератор на элемент после последнего
  */
-template <typename Key, typename T>
-typename map<Key, T>::const_iterator map<Key, T>::end() const {
-  return const_iterator(typename RBTree<Key, T>::ConstIterator(nullptr));
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator
+map<Key, T, Compare, Allocator, Policy>::end() const {
+  return const_iterator(Base::cend());
 }
 
 }  // namespace s21
@@ -0,0 +1,353 @@
+/**
+ * @file s21_persistent_map.h
+ * @brief Заголовочный файл для persistent_map - словаря на персистентном
+ * красно-черном дереве с копированием пути и снимками за O(1)
+ */
+
+#ifndef S21_PERSISTENT_MAP_H
+#define S21_PERSISTENT_MAP_H
+
+namespace s21 {
+
+/**
+ * @brief Персистентное красно-черное дерево: общая часть словаря и снимка
+ * @details Узлы не меняются, пока доступны из нескольких версий, и
+ * разделяются между версиями через атомарный счетчик ссылок. Ссылок на
+ * родителя нет, поэтому одно поддерево может входить в любое число версий,
+ * а копирование дерева копирует только корень. Версию можно читать из
+ * любого потока, пока жив ее объект
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename T, typename Compare>
+class PersistentTree {
+ protected:
+  struct Node;
+
+  /**
+   * @brief Владеющая ссылка на узел со счетчиком ссылок
+   * @details Освобождение последней ссылки удаляет узел и отпускает его
+   * потомков. Глубина этой рекурсии не больше высоты дерева, то есть
+   * 2 log2(n + 1): дерево всегда сбалансировано
+   */
+  class NodePtr {
+   public:
+    NodePtr() = default;
+    /// @brief Принять узел с уже учтенной ссылкой
+    explicit NodePtr(Node* node) noexcept : node_(node) {}
+    NodePtr(const NodePtr& other) noexcept;
+    NodePtr(NodePtr&& other) noexcept : node_(other.node_) {
+      other.node_ = nullptr;
+    }
+    NodePtr& operator=(NodePtr other) noexcept {
+      std::swap(node_, other.node_);
+      return *this;
+    }
+    ~NodePtr();
+
+    Node* get() const noexcept { return node_; }
+    Node* operator->() const noexcept { return node_; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+
+    /**
+     * @brief Единственная ли это ссылка на узел
+     * @details Только такой узел можно менять на месте: ни одна другая
+     * версия его не видит
+     */
+    bool unique() const noexcept;
+
+   private:
+    Node* node_ = nullptr;  ///< Узел или nullptr
+  };
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  /**
+   * @brief Константный прямой итератор по порядку ключей
+   * @details Хранит путь от корня до текущего узла, поэтому копирование
+   * итератора стоит O(log n). Действителен, пока жива версия, из которой
+   * получен: у словаря - до следующего изменения
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PersistentTree::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() = default;
+
+    reference operator*() const { return path_.back()->data; }
+    pointer operator->() const { return &path_.back()->data; }
+    const_iterator& operator++();
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+    bool operator==(const const_iterator& other) const {
+      return current() == other.current();
+    }
+    bool operator!=(const const_iterator& other) const {
+      return current() != other.current();
+    }
+
+   private:
+    friend class PersistentTree;
+
+    /// @brief Текущий узел или nullptr для end()
+    const Node* current() const noexcept {
+      return path_.empty() ? nullptr : path_.back();
+    }
+    /// @brief Спуститься по левым ссылкам, запоминая путь
+    void descendLeft(const Node* node);
+
+    /// @brief Узлы, в левом поддереве которых находится обход, и текущий
+    std::vector<const Node*> path_;
+  };
+  using iterator = const_iterator;
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  key_compare key_comp() const { return comp_; }
+
+  const_iterator begin() const;
+  const_iterator end() const { return const_iterator(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  /**
+   * @brief Значение по ключу
+   * @param key Ключ
+   * @return Константная ссылка на значение
+   * @throw std::out_of_range Если ключа нет
+   */
+  const T& at(const Key& key) const;
+  bool contains(const Key& key) const;
+
+  /**
+   * @brief Найти элемент по ключу
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  const_iterator find(const Key& key) const;
+
+  /**
+   * @brief Найти первый элемент с ключом не меньше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  const_iterator lower_bound(const Key& key) const;
+
+ protected:
+  /**
+   * @brief Узел персистентного дерева
+   * @details Цвет меняется на месте только у узла с единственной ссылкой
+   */
+  struct Node {
+    value_type data;              ///< Пара ключ-значение
+    NodePtr left;                 ///< Левое поддерево
+    NodePtr right;                ///< Правое поддерево
+    Color color;                  ///< Цвет узла
+    std::atomic<size_type> refs;  ///< Ссылки из узлов и корней версий
+
+    Node(Color c, NodePtr l, const value_type& value, NodePtr r)
+        : data(value),
+          left(std::move(l)),
+          right(std::move(r)),
+          color(c),
+          refs(1) {}
+  };
+
+  PersistentTree() = default;
+  explicit PersistentTree(const Compare& comp) : comp_(comp) {}
+  PersistentTree(const PersistentTree& other) = default;
+  PersistentTree(PersistentTree&& other) noexcept
+      : root_(std::move(other.root_)),
+        size_(std::exchange(other.size_, 0)),
+        comp_(other.comp_) {}
+  PersistentTree& operator=(const PersistentTree& other) = default;
+  PersistentTree& operator=(PersistentTree&& other) noexcept {
+    root_ = std::move(other.root_);
+    size_ = std::exchange(other.size_, 0);
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  /**
+   * @brief Найти узел по ключу
+   * @param key Ключ
+   * @return Узел или nullptr
+   */
+  const Node* findNode(const Key& key) const;
+
+  NodePtr root_;       ///< Корень версии
+  size_type size_ = 0;  ///< Число элементов
+  Compare comp_;       ///< Компаратор ключей
+};
+
+template <typename Key, typename T, typename Compare>
+class persistent_map;
+
+/**
+ * @brief Снимок persistent_map только для чтения
+ * @details Разделяет узлы со словарем, из которого получен, и не меняется
+ * при его последующих изменениях. Узлы, нужные только снимку, живут, пока
+ * жив снимок
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map_snapshot : public PersistentTree<Key, T, Compare> {
+ public:
+  /**
+   * @brief Пустой снимок
+   */
+  persistent_map_snapshot() = default;
+
+ private:
+  friend class persistent_map<Key, T, Compare>;
+
+  /**
+   * @brief Снимок версии словаря
+   * @param tree Версия словаря
+   */
+  explicit persistent_map_snapshot(const PersistentTree<Key, T, Compare>& tree)
+      : PersistentTree<Key, T, Compare>(tree) {}
+};
+
+/**
+ * @brief Словарь на персистентном красно-черном дереве
+ * @details Вставка и удаление строят новую версию, копируя только узлы на
+ * пути от корня к изменяемому ключу и узлы, задетые балансировкой, то есть
+ * O(log n) узлов; остальные поддеревья общие со старой версией. Только что
+ * созданные узлы перекрашиваются на месте, без повторного копирования.
+ * Поэтому snapshot() и копирование словаря работают за O(1), а каждое
+ * изменение после снимка удерживает O(log n) новых узлов. Используются
+ * функциональные вставка и удаление Карса (S. Kahrs, Red-black trees with
+ * types). Изменять словарь может один поток, снимки читаются из любых
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Compare Компаратор ключей
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map : public PersistentTree<Key, T, Compare> {
+ protected:
+  using Tree = PersistentTree<Key, T, Compare>;
+  using typename Tree::Node;
+  using typename Tree::NodePtr;
+
+ public:
+  using value_type = typename Tree::value_type;
+  using size_type = typename Tree::size_type;
+  using snapshot_type = persistent_map_snapshot<Key, T, Compare>;
+
+  persistent_map() = default;
+  explicit persistent_map(const Compare& comp) : Tree(comp) {}
+
+  /**
+   * @brief Конструктор списком инициализации
+   * @param items Пары ключ-значение, из повторов остается первая
+   */
+  persistent_map(std::initializer_list<value_type> items);
+
+  /**
+   * @brief Вставить пару, если ключа еще нет
+   * @param value Пара ключ-значение
+   * @return true, если пара вставлена
+   */
+  bool insert(const value_type& value);
+  bool insert(const Key& key, const T& obj);
+
+  /**
+   * @brief Вставить пару или заменить значение имеющегося ключа
+   * @param key Ключ
+   * @param obj Значение
+   * @return true, если ключ вставлен, false, если значение заменено
+   */
+  bool insert_or_assign(const Key& key, const T& obj);
+
+  /**
+   * @brief Удалить элемент по ключу
+   * @param key Ключ
+   * @return Число удаленных элементов (0 или 1)
+   */
+  size_type erase(const Key& key);
+
+  /**
+   * @brief Удалить все элементы
+   * @details Узлы, на которые ссылаются снимки, остаются им
+   */
+  void clear() noexcept;
+
+  void swap(persistent_map& other) noexcept;
+
+  /**
+   * @brief Снимок текущей версии за O(1)
+   * @return Снимок, не зависящий от последующих изменений словаря
+   */
+  snapshot_type snapshot() const noexcept { return snapshot_type(*this); }
+
+ private:
+  /**
+   * @brief Вставить пару в поддерево
+   * @param tree Поддерево
+   * @param value Пара ключ-значение
+   * @param assign Заменять ли значение имеющегося ключа
+   * @param inserted Устанавливается, если ключ добавлен
+   * @return Новое поддерево или tree, если ничего не изменилось
+   */
+  NodePtr insertNode(const NodePtr& tree, const value_type& value,
+                     bool assign, bool& inserted);
+
+  /**
+   * @brief Удалить ключ, который точно есть в поддереве
+   * @param tree Поддерево
+   * @param key Ключ
+   * @return Новое поддерево
+   */
+  NodePtr eraseNode(const NodePtr& tree, const Key& key);
+
+  /// @brief Новый узел, потомки передаются во владение
+  static NodePtr makeNode(Color color, NodePtr left, const value_type& data,
+                          NodePtr right);
+  /// @brief Узел того же содержания с другим цветом
+  static NodePtr recolor(NodePtr node, Color color);
+  /// @brief Красный ли узел (пустое поддерево черное)
+  static bool isRed(const NodePtr& node) noexcept {
+    return node && node->color == RED;
+  }
+  /// @brief Черный непустой узел
+  static bool isBlackNode(const NodePtr& node) noexcept {
+    return node && node->color == BLACK;
+  }
+
+  /// @brief Собрать черный узел, устранив два красных подряд под ним
+  static NodePtr balance(NodePtr left, const value_type& data, NodePtr right);
+  /// @brief Собрать узел, левое поддерево которого стало ниже на 1
+  static NodePtr balanceLeft(NodePtr left, const value_type& data,
+                             NodePtr right);
+  /// @brief Собрать узел, правое поддерево которого стало ниже на 1
+  static NodePtr balanceRight(NodePtr left, const value_type& data,
+                              NodePtr right);
+  /// @brief Соединить поддеревья удаленного узла
+  static NodePtr append(NodePtr left, NodePtr right);
+};
+
+}  // namespace s21
+
+// clang-format off
+#include "./s21_persistent_tree.tpp"
+#include "./s21_persistent_map.tpp"
+// clang-format on
+
+#endif  // S21_PERSISTENT_MAP_H
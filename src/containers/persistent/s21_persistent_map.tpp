@@ -0,0 +1,335 @@
+/**
+ * @file s21_persistent_map.tpp
+ * @brief Реализация изменяющих операций persistent_map
+ */
+
+namespace s21 {
+
+/**
+ * @brief Конструктор списком инициализации
+ * @param items Пары ключ-значение, из повторов остается первая
+ */
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(
+    std::initializer_list<value_type> items) {
+  for (const auto& item : items) insert(item);
+}
+
+/**
+ * @brief Вставить пару, если ключа еще нет
+ * @param value Пара ключ-значение
+ * @return true, если пара вставлена
+ */
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::insert(const value_type& value) {
+  bool inserted = false;
+  NodePtr root = insertNode(this->root_, value, false, inserted);
+  if (!inserted) return false;
+  this->root_ = recolor(std::move(root), BLACK);
+  ++this->size_;
+  return true;
+}
+
+/**
+ * @brief Вставить пару ключ-значение, если ключа еще нет
+ * @param key Ключ
+ * @param obj Значение
+ * @return true, если пара вставлена
+ */
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::insert(const Key& key, const T& obj) {
+  return insert(value_type(key, obj));
+}
+
+/**
+ * @brief Вставить пару или заменить значение имеющегося ключа
+ * @param key Ключ
+ * @param obj Значение
+ * @return true, если ключ вставлен
+ */
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::insert_or_assign(const Key& key,
+                                                       const T& obj) {
+  bool inserted = false;
+  NodePtr root = insertNode(this->root_, value_type(key, obj), true, inserted);
+  this->root_ = recolor(std::move(root), BLACK);
+  if (inserted) ++this->size_;
+  return inserted;
+}
+
+/**
+ * @brief Удалить элемент по ключу
+ * @param key Ключ
+ * @return Число удаленных элементов (0 или 1)
+ * @details Удаление Карса рассчитано на ключ, который есть в дереве,
+ * поэтому сначала выполняется поиск: отсутствующий ключ не копирует путь
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::erase(const Key& key) {
+  if (!this->findNode(key)) return 0;
+  NodePtr root = eraseNode(this->root_, key);
+  this->root_ = root ? recolor(std::move(root), BLACK) : NodePtr();
+  --this->size_;
+  return 1;
+}
+
+/**
+ * @brief Удалить все элементы
+ */
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::clear() noexcept {
+  this->root_ = NodePtr();
+  this->size_ = 0;
+}
+
+/**
+ * @brief Обменять содержимое с другим словарем
+ * @param other Другой словарь
+ */
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::swap(persistent_map& other) noexcept {
+  std::swap(this->root_, other.root_);
+  std::swap(this->size_, other.size_);
+  std::swap(this->comp_, other.comp_);
+}
+
+/**
+ * @brief Вставить пару в поддерево
+ * @param tree Поддерево
+ * @param value Пара ключ-значение
+ * @param assign Заменять ли значение имеющегося ключа
+ * @param inserted Устанавливается, если ключ добавлен
+ * @return Новое поддерево или tree, если ничего не изменилось
+ * @details Новый узел красный. Под черным узлом два красных подряд
+ * устраняет balance, под красным они остаются до черного предка или корня
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::insertNode(const NodePtr& tree,
+                                            const value_type& value,
+                                            bool assign, bool& inserted) {
+  if (!tree) {
+    inserted = true;
+    return makeNode(RED, NodePtr(), value, NodePtr());
+  }
+  if (this->comp_(value.first, tree->data.first)) {
+    NodePtr left = insertNode(tree->left, value, assign, inserted);
+    if (left.get() == tree->left.get()) return tree;
+    if (tree->color == BLACK) {
+      return balance(std::move(left), tree->data, tree->right);
+    }
+    return makeNode(RED, std::move(left), tree->data, tree->right);
+  }
+  if (this->comp_(tree->data.first, value.first)) {
+    NodePtr right = insertNode(tree->right, value, assign, inserted);
+    if (right.get() == tree->right.get()) return tree;
+    if (tree->color == BLACK) {
+      return balance(tree->left, tree->data, std::move(right));
+    }
+    return makeNode(RED, tree->left, tree->data, std::move(right));
+  }
+  if (!assign) return tree;
+  return makeNode(tree->color, tree->left, value, tree->right);
+}
+
+/**
+ * @brief Удалить ключ, который точно есть в поддереве
+ * @param tree Поддерево
+ * @param key Ключ
+ * @return Новое поддерево
+ * @details Если ключ ушел из черного поддерева, оно стало ниже на 1, и
+ * узел собирается через balanceLeft или balanceRight
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::eraseNode(const NodePtr& tree,
+                                           const Key& key) {
+  if (this->comp_(key, tree->data.first)) {
+    if (isBlackNode(tree->left)) {
+      return balanceLeft(eraseNode(tree->left, key), tree->data, tree->right);
+    }
+    return makeNode(RED, eraseNode(tree->left, key), tree->data, tree->right);
+  }
+  if (this->comp_(tree->data.first, key)) {
+    if (isBlackNode(tree->right)) {
+      return balanceRight(tree->left, tree->data,
+                          eraseNode(tree->right, key));
+    }
+    return makeNode(RED, tree->left, tree->data, eraseNode(tree->right, key));
+  }
+  return append(tree->left, tree->right);
+}
+
+/**
+ * @brief Новый узел
+ * @param color Цвет
+ * @param left Левое поддерево
+ * @param data Пара ключ-значение, копируется
+ * @param right Правое поддерево
+ * @return Ссылка на узел
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::makeNode(Color color, NodePtr left,
+                                          const value_type& data,
+                                          NodePtr right) {
+  return NodePtr(new Node(color, std::move(left), data, std::move(right)));
+}
+
+/**
+ * @brief Узел того же содержания с другим цветом
+ * @param node Непустой узел
+ * @param color Цвет
+ * @return Сам узел, если цвет совпадает или ссылка единственная, иначе копия
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::recolor(NodePtr node, Color color) {
+  if (node->color == color) return node;
+  if (node.unique()) {
+    node->color = color;
+    return node;
+  }
+  return makeNode(color, node->left, node->data, node->right);
+}
+
+/**
+ * @brief Собрать черный узел, устранив два красных подряд под ним
+ * @param left Левое поддерево
+ * @param data Пара ключ-значение узла
+ * @param right Правое поддерево
+ * @return Новое поддерево той же черной высоты
+ * @details Четыре случая Окасаки и случай двух красных потомков, который
+ * нужен удалению: красный узел с двумя черными потомками
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::balance(NodePtr left, const value_type& data,
+                                         NodePtr right) {
+  if (isRed(left) && isRed(right)) {
+    return makeNode(RED, recolor(std::move(left), BLACK), data,
+                    recolor(std::move(right), BLACK));
+  }
+  if (isRed(left) && isRed(left->left)) {
+    return makeNode(RED, recolor(left->left, BLACK), left->data,
+                    makeNode(BLACK, left->right, data, std::move(right)));
+  }
+  if (isRed(left) && isRed(left->right)) {
+    const NodePtr& middle = left->right;
+    return makeNode(RED,
+                    makeNode(BLACK, left->left, left->data, middle->left),
+                    middle->data,
+                    makeNode(BLACK, middle->right, data, std::move(right)));
+  }
+  if (isRed(right) && isRed(right->right)) {
+    return makeNode(RED, makeNode(BLACK, std::move(left), data, right->left),
+                    right->data, recolor(right->right, BLACK));
+  }
+  if (isRed(right) && isRed(right->left)) {
+    const NodePtr& middle = right->left;
+    return makeNode(RED, makeNode(BLACK, std::move(left), data, middle->left),
+                    middle->data,
+                    makeNode(BLACK, middle->right, right->data, right->right));
+  }
+  return makeNode(BLACK, std::move(left), data, std::move(right));
+}
+
+/**
+ * @brief Собрать узел, левое поддерево которого стало ниже на 1
+ * @param left Укороченное левое поддерево
+ * @param data Пара ключ-значение узла
+ * @param right Правое поддерево
+ * @return Поддерево исходной черной высоты или ниже на 1 с красным корнем
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::balanceLeft(NodePtr left,
+                                             const value_type& data,
+                                             NodePtr right) {
+  if (isRed(left)) {
+    return makeNode(RED, recolor(std::move(left), BLACK), data,
+                    std::move(right));
+  }
+  if (isBlackNode(right)) {
+    return balance(std::move(left), data, recolor(std::move(right), RED));
+  }
+  // Правый потомок красный, его левый потомок черный
+  const NodePtr& middle = right->left;
+  return makeNode(RED, makeNode(BLACK, std::move(left), data, middle->left),
+                  middle->data,
+                  balance(middle->right, right->data,
+                          recolor(right->right, RED)));
+}
+
+/**
+ * @brief Собрать узел, правое поддерево которого стало ниже на 1
+ * @param left Левое поддерево
+ * @param data Пара ключ-значение узла
+ * @param right Укороченное правое поддерево
+ * @return Поддерево исходной черной высоты или ниже на 1 с красным корнем
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::balanceRight(NodePtr left,
+                                              const value_type& data,
+                                              NodePtr right) {
+  if (isRed(right)) {
+    return makeNode(RED, std::move(left), data,
+                    recolor(std::move(right), BLACK));
+  }
+  if (isBlackNode(left)) {
+    return balance(recolor(std::move(left), RED), data, std::move(right));
+  }
+  // Левый потомок красный, его правый потомок черный
+  const NodePtr& middle = left->right;
+  return makeNode(RED,
+                  balance(recolor(left->left, RED), left->data, middle->left),
+                  middle->data,
+                  makeNode(BLACK, middle->right, data, std::move(right)));
+}
+
+/**
+ * @brief Соединить поддеревья удаленного узла
+ * @param left Левое поддерево
+ * @param right Правое поддерево, все его ключи больше ключей left
+ * @return Поддерево из всех узлов left и right
+ */
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::NodePtr
+persistent_map<Key, T, Compare>::append(NodePtr left, NodePtr right) {
+  if (!left) return right;
+  if (!right) return left;
+  if (isRed(left) && isRed(right)) {
+    NodePtr inner = append(left->right, right->left);
+    if (isRed(inner)) {
+      return makeNode(
+          RED, makeNode(RED, left->left, left->data, inner->left),
+          inner->data,
+          makeNode(RED, inner->right, right->data, right->right));
+    }
+    return makeNode(RED, left->left, left->data,
+                    makeNode(RED, std::move(inner), right->data,
+                             right->right));
+  }
+  if (!isRed(left) && !isRed(right)) {
+    NodePtr inner = append(left->right, right->left);
+    if (isRed(inner)) {
+      return makeNode(
+          RED, makeNode(BLACK, left->left, left->data, inner->left),
+          inner->data,
+          makeNode(BLACK, inner->right, right->data, right->right));
+    }
+    return balanceLeft(left->left, left->data,
+                       makeNode(BLACK, std::move(inner), right->data,
+                                right->right));
+  }
+  if (isRed(right)) {
+    return makeNode(RED, append(std::move(left), right->left), right->data,
+                    right->right);
+  }
+  return makeNode(RED, left->left, left->data,
+                  append(left->right, std::move(right)));
+}
+
+}  // namespace s21
@@ -0,0 +1,158 @@
+/**
+ * @file s21_persistent_tree.tpp
+ * @brief Реализация счетчика ссылок, итератора и поиска для PersistentTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Копировать ссылку, увеличив счетчик узла
+ * @param other Копируемая ссылка
+ * @details Новая ссылка появляется только от существующей, поэтому
+ * достаточно упорядочения relaxed
+ */
+template <typename Key, typename T, typename Compare>
+PersistentTree<Key, T, Compare>::NodePtr::NodePtr(
+    const NodePtr& other) noexcept
+    : node_(other.node_) {
+  if (node_) node_->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Отпустить ссылку и удалить узел, если она была последней
+ * @details acq_rel: удаляющий поток видит все чтения узла другими
+ * версиями, завершенные до их освобождения
+ */
+template <typename Key, typename T, typename Compare>
+PersistentTree<Key, T, Compare>::NodePtr::~NodePtr() {
+  if (node_ && node_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete node_;
+  }
+}
+
+/**
+ * @brief Единственная ли это ссылка на узел
+ * @return true, если узел можно менять на месте
+ */
+template <typename Key, typename T, typename Compare>
+bool PersistentTree<Key, T, Compare>::NodePtr::unique() const noexcept {
+  return node_ && node_->refs.load(std::memory_order_acquire) == 1;
+}
+
+/**
+ * @brief Перейти к следующему по порядку элементу
+ * @return Ссылка на итератор
+ * @details Следующий узел - минимум правого поддерева, иначе ближайший
+ * предок на пути, в левом поддереве которого был текущий узел
+ */
+template <typename Key, typename T, typename Compare>
+typename PersistentTree<Key, T, Compare>::const_iterator&
+PersistentTree<Key, T, Compare>::const_iterator::operator++() {
+  const Node* node = path_.back();
+  path_.pop_back();
+  if (node->right) descendLeft(node->right.get());
+  return *this;
+}
+
+/**
+ * @brief Спуститься по левым ссылкам, запоминая путь
+ * @param node Начальный узел (nullptr допустим)
+ */
+template <typename Key, typename T, typename Compare>
+void PersistentTree<Key, T, Compare>::const_iterator::descendLeft(
+    const Node* node) {
+  for (; node != nullptr; node = node->left.get()) path_.push_back(node);
+}
+
+/**
+ * @brief Итератор на элемент с наименьшим ключом
+ * @return Итератор или end() для пустого дерева
+ */
+template <typename Key, typename T, typename Compare>
+typename PersistentTree<Key, T, Compare>::const_iterator
+PersistentTree<Key, T, Compare>::begin() const {
+  const_iterator it;
+  it.descendLeft(root_.get());
+  return it;
+}
+
+/**
+ * @brief Значение по ключу
+ * @param key Ключ
+ * @return Константная ссылка на значение
+ * @throw std::out_of_range Если ключа нет
+ */
+template <typename Key, typename T, typename Compare>
+const T& PersistentTree<Key, T, Compare>::at(const Key& key) const {
+  const Node* node = findNode(key);
+  if (!node) throw std::out_of_range("Key not found");
+  return node->data.second;
+}
+
+/**
+ * @brief Проверить наличие ключа
+ * @param key Ключ
+ * @return true, если ключ есть в версии
+ */
+template <typename Key, typename T, typename Compare>
+bool PersistentTree<Key, T, Compare>::contains(const Key& key) const {
+  return findNode(key) != nullptr;
+}
+
+/**
+ * @brief Найти элемент по ключу
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename T, typename Compare>
+typename PersistentTree<Key, T, Compare>::const_iterator
+PersistentTree<Key, T, Compare>::find(const Key& key) const {
+  const_iterator it = lower_bound(key);
+  if (it != end() && comp_(key, it->first)) return end();
+  return it;
+}
+
+/**
+ * @brief Найти первый элемент с ключом не меньше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ * @details В путь итератора попадают узлы, из которых спуск пошел влево:
+ * последний из них - ответ, остальные обход посетит после него
+ */
+template <typename Key, typename T, typename Compare>
+typename PersistentTree<Key, T, Compare>::const_iterator
+PersistentTree<Key, T, Compare>::lower_bound(const Key& key) const {
+  const_iterator it;
+  for (const Node* node = root_.get(); node != nullptr;) {
+    if (comp_(node->data.first, key)) {
+      node = node->right.get();
+    } else {
+      it.path_.push_back(node);
+      node = node->left.get();
+    }
+  }
+  return it;
+}
+
+/**
+ * @brief Найти узел по ключу
+ * @param key Ключ
+ * @return Узел или nullptr
+ */
+template <typename Key, typename T, typename Compare>
+const typename PersistentTree<Key, T, Compare>::Node*
+PersistentTree<Key, T, Compare>::findNode(const Key& key) const {
+  const Node* node = root_.get();
+  while (node != nullptr) {
+    if (comp_(key, node->data.first)) {
+      node = node->left.get();
+    } else if (comp_(node->data.first, key)) {
+      node = node->right.get();
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace s21
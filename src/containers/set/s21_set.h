@@ -12,24 +12,54 @@ namespace s21 {
  * @brief Класс множества, реализованный на основе красно-черного дерева.
  *
  * @tparam Key Тип ключа.
+ * @tparam Compare Компаратор ключей (прозрачный компаратор включает поиск по
+ * сравнимым с Key типам).
+ * @tparam Allocator Аллокатор ключей, для узлов он перепривязывается к типу
+ * узла.
+ * @tparam Policy Политика дерева (DefaultTreePolicy или PooledTreePolicy).
  */
-template <typename Key>
-class set : public s21::RBTree<Key, Key> {
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>,
+          typename Policy = DefaultTreePolicy>
+class set : public s21::RBTree<Key, void, Compare, Allocator, Policy> {
  public:
-  using Base = s21::RBTree<Key, Key>;
+  using Base = s21::RBTree<Key, void, Compare, Allocator, Policy>;
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const value_type &;
   using iterator = typename Base::SetIterator;
   using const_iterator = typename Base::SetConstIterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using node_type = typename Base::NodeHandle;
+  using insert_return_type = typename Base::template InsertReturn<iterator>;
 
   /**
    * @brief Конструктор по умолчанию.
    */
   set() : Base() {}
 
+  /**
+   * @brief Конструктор с аллокатором.
+   *
+   * @param alloc Аллокатор, из которого выделяются узлы.
+   */
+  explicit set(const allocator_type &alloc) : Base(alloc) {}
+
+  /**
+   * @brief Конструктор с компаратором.
+   *
+   * @param comp Компаратор ключей.
+   * @param alloc Аллокатор, из которого выделяются узлы.
+   */
+  explicit set(const key_compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : Base(comp, alloc) {}
+
   /**
    * @brief Конструктор из списка инициализации.
    *
@@ -37,6 +67,22 @@ class set : public s21::RBTree<Key, Key> {
    */
   set(std::initializer_list<value_type> const &items);
 
+  /**
+   * @brief Конструктор из диапазона.
+   *
+   * Отсортированный диапазон строится за O(n), иначе элементы сначала
+   * сортируются. Из одинаковых ключей остается первый.
+   *
+   * @param first Начало диапазона.
+   * @param last Конец диапазона.
+   * @param comp Компаратор ключей.
+   * @param alloc Аллокатор, из которого выделяются узлы.
+   */
+  template <typename InputIt>
+  set(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+      const allocator_type &alloc = allocator_type())
+      : Base(first, last, comp, alloc) {}
+
   /**
    * @brief Конструктор копирования.
    *
@@ -51,13 +97,33 @@ class set : public s21::RBTree<Key, Key> {
    */
   set(set &&other) noexcept : Base(std::move(other)) {}
 
+  /**
+   * @brief Конструктор копирования с аллокатором.
+   *
+   * @param other Другое множество для копирования.
+   * @param alloc Аллокатор, из которого выделяются узлы копии.
+   */
+  set(const set &other, const allocator_type &alloc) : Base(other, alloc) {}
+
+  /**
+   * @brief Конструктор перемещения с аллокатором.
+   *
+   * При разных аллокаторах элементы перемещаются в новые узлы.
+   *
+   * @param other Другое множество для перемещения.
+   * @param alloc Аллокатор, из которого выделяются узлы.
+   */
+  set(set &&other, const allocator_type &alloc)
+      : Base(std::move(other), alloc) {}
+
   /**
    * @brief Оператор перемещающего присваивания.
    *
    * @param other Другое множество для перемещения.
    * @return Ссылка на текущее множество.
    */
-  set &operator=(set &&other) noexcept;
+  set &operator=(set &&other) noexcept(
+      std::is_nothrow_move_assignable_v<Base>);
 
   /**
    * @brief Оператор копирующего присваивания.
@@ -100,9 +166,72 @@ class set : public s21::RBTree<Key, Key> {
    */
   const_iterator cend() const;
 
+  /**
+   * @brief Возвращает константный итератор на начало множества.
+   *
+   * @return Константный итератор на начало.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Возвращает константный итератор на конец множества.
+   *
+   * @return Константный итератор на конец.
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Возвращает обратный итератор на наибольший элемент.
+   *
+   * @return Обратный итератор на начало обратного обхода.
+   */
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+  /**
+   * @brief Возвращает обратный итератор за наименьшим элементом.
+   *
+   * @return Обратный итератор на конец обратного обхода.
+   */
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  /**
+   * @brief Возвращает константный обратный итератор на наибольший элемент.
+   *
+   * @return Константный обратный итератор на начало обратного обхода.
+   */
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+
+  /**
+   * @brief Возвращает константный обратный итератор за наименьшим элементом.
+   *
+   * @return Константный обратный итератор на конец обратного обхода.
+   */
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  /**
+   * @brief Возвращает константный обратный итератор на наибольший элемент.
+   *
+   * @return Константный обратный итератор на начало обратного обхода.
+   */
+  const_reverse_iterator crbegin() const { return rbegin(); }
+
+  /**
+   * @brief Возвращает константный обратный итератор за наименьшим элементом.
+   *
+   * @return Константный обратный итератор на конец обратного обхода.
+   */
+  const_reverse_iterator crend() const { return rend(); }
+
   /**
    * @brief Объединяет текущее множество с другим.
    *
+   * Узлы с новыми ключами переносятся без копирования, совпавшие ключи
+   * остаются в other.
+   *
    * @param other Другое множество для объединения.
    */
   void merge(set &other);
@@ -114,6 +243,94 @@ class set : public s21::RBTree<Key, Key> {
    */
   void swap(set &other) noexcept;
 
+  /**
+   * @brief Разделяет множество по ключу за O(log n).
+   *
+   * Элементы меньше key остаются в множестве.
+   *
+   * @param key Граница разделения.
+   * @return Множество элементов не меньше key.
+   */
+  set split(const Key &key);
+
+  /**
+   * @brief Присоединяет множество с большими элементами за O(log n).
+   *
+   * @param right Множество, все элементы которого больше элементов текущего.
+   * После операции становится пустым.
+   * @throw std::invalid_argument Если диапазоны элементов пересекаются.
+   */
+  void join(set &right);
+
+  /**
+   * @brief Присоединяет опорный элемент и множество с большими элементами.
+   *
+   * @param pivot Элемент больше элементов множества и меньше элементов right.
+   * @param right Множество с большими элементами, становится пустым.
+   * @throw std::invalid_argument Если элементы нарушают порядок.
+   */
+  void join(const value_type &pivot, set &right);
+
+  /**
+   * @brief Объединяет множество с другим за O(m log(n/m + 1)).
+   *
+   * Рассчитано на вливание малой дельты в большое множество: узлы вдали от
+   * элементов дельты не посещаются.
+   *
+   * @param other Добавляемое множество (std::move избегает копирования).
+   */
+  void set_union(set other);
+
+  /**
+   * @brief Оставляет в множестве только элементы, которые есть в other.
+   *
+   * @param other Множество элементов, которые нужно оставить.
+   */
+  void set_intersection(set other);
+
+  /**
+   * @brief Удаляет из множества элементы, которые есть в other.
+   *
+   * @param other Множество удаляемых элементов.
+   */
+  void set_difference(set other);
+
+  /**
+   * @brief Объединяет множество с другим, используя пул потоков.
+   *
+   * Ниже set::kParallelCutoff и для пула узлов работает как set_union.
+   *
+   * @param other Добавляемое множество.
+   * @param pool Пул потоков.
+   */
+  void parallel_union(set other, TaskPool &pool);
+
+  /**
+   * @brief Пересекает множество с другим, используя пул потоков.
+   *
+   * @param other Множество элементов, которые нужно оставить.
+   * @param pool Пул потоков.
+   */
+  void parallel_intersection(set other, TaskPool &pool);
+
+  /**
+   * @brief Удаляет из множества элементы другого, используя пул потоков.
+   *
+   * @param other Множество удаляемых элементов.
+   * @param pool Пул потоков.
+   */
+  void parallel_difference(set other, TaskPool &pool);
+
+  /**
+   * @brief Вставляет диапазон элементов, используя пул потоков.
+   *
+   * @param first Начало диапазона.
+   * @param last Конец диапазона.
+   * @param pool Пул потоков.
+   */
+  template <typename InputIt>
+  void parallel_insert(InputIt first, InputIt last, TaskPool &pool);
+
   /**
    * @brief Вставляет элемент в множество.
    *
@@ -122,6 +339,59 @@ class set : public s21::RBTree<Key, Key> {
    */
   std::pair<iterator, bool> insert(const value_type &value);
 
+  /**
+   * @brief Вставляет элемент, перемещая его в узел.
+   *
+   * @param value Значение для вставки (не изменяется, если оно уже есть).
+   * @return Пара из итератора на элемент и флага успешности.
+   */
+  std::pair<iterator, bool> insert(value_type &&value);
+
+  /**
+   * @brief Строит элемент прямо в узле.
+   *
+   * При повторном ключе построенный узел удаляется.
+   *
+   * @tparam Args Типы аргументов конструктора элемента.
+   * @param args Аргументы конструктора элемента.
+   * @return Пара из итератора на элемент и флага успешности.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  /**
+   * @brief Вставляет элемент по подсказке.
+   *
+   * Если элемент должен стоять прямо перед hint, место находится без спуска
+   * от корня: вставка возрастающих ключей с hint = end() выполняется за
+   * амортизированное O(1).
+   *
+   * @param hint Итератор, перед которым ожидается элемент.
+   * @param value Значение для вставки.
+   * @return Итератор на вставленный элемент или равный ему.
+   */
+  iterator insert(const_iterator hint, const value_type &value);
+
+  /**
+   * @brief Вставляет элемент по подсказке, перемещая его в узел.
+   *
+   * @param hint Итератор, перед которым ожидается элемент.
+   * @param value Значение для вставки.
+   * @return Итератор на вставленный элемент или равный ему.
+   */
+  iterator insert(const_iterator hint, value_type &&value);
+
+  /**
+   * @brief Строит элемент на месте и вставляет его по подсказке.
+   *
+   * @tparam Args Типы аргументов конструктора элемента.
+   * @param hint Итератор, перед которым ожидается элемент.
+   * @param args Аргументы конструктора элемента.
+   * @return Итератор на вставленный элемент или равный ему.
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
+
   /**
    * @brief Вставляет несколько элементов в множество.
    *
@@ -140,6 +410,30 @@ class set : public s21::RBTree<Key, Key> {
    */
   void erase(iterator pos);
 
+  /**
+   * @brief Извлекает узел из множества без копирования ключа.
+   *
+   * @param pos Итератор на извлекаемый элемент.
+   * @return Дескриптор узла (пустой для end()).
+   */
+  node_type extract(iterator pos);
+
+  /**
+   * @brief Извлекает узел по ключу.
+   *
+   * @param key Ключ извлекаемого элемента.
+   * @return Дескриптор узла (пустой, если ключа нет).
+   */
+  node_type extract(const Key &key);
+
+  /**
+   * @brief Вставляет извлеченный узел.
+   *
+   * @param node Дескриптор узла.
+   * @return Позиция, флаг вставки и узел, если ключ уже есть.
+   */
+  insert_return_type insert(node_type &&node);
+
   /**
    * @brief Ищет элемент в множестве.
    *
@@ -148,6 +442,18 @@ class set : public s21::RBTree<Key, Key> {
    */
   iterator find(const Key &key);
 
+  /**
+   * @brief Ищет элемент, эквивалентный значению сравнимого с ключом типа.
+   *
+   * Доступно только при прозрачном компараторе, временный Key не строится.
+   *
+   * @param key Значение для поиска.
+   * @return Итератор на найденный элемент или на конец.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
   /**
    * @brief Проверяет, содержится ли элемент в множестве.
    *
@@ -156,6 +462,194 @@ class set : public s21::RBTree<Key, Key> {
    */
   bool contains(const Key &key) const;
 
+  /**
+   * @brief Проверяет, содержится ли элемент, эквивалентный key.
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key Значение для проверки.
+   * @return true, если элемент содержится в множестве, иначе false.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Ищет элементы для последовательности ключей.
+   *
+   * Спуски идут группами с prefetch следующего узла (см.
+   * RBTree::find_many), результаты пишутся в порядке ключей.
+   *
+   * @param first Начало последовательности ключей.
+   * @param last Конец последовательности ключей.
+   * @param out Начало вывода: итератор на элемент или на конец.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  /**
+   * @brief Проверяет, содержатся ли элементы последовательности.
+   *
+   * @param first Начало последовательности ключей.
+   * @param last Конец последовательности ключей.
+   * @param out Начало вывода bool для каждого ключа.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  /**
+   * @brief Создает неизменяемый снимок множества для быстрого поиска.
+   *
+   * Ключи раскладываются в порядке Эйтцингера за O(n). Дальнейшие
+   * изменения множества на снимок не влияют.
+   *
+   * @return Снимок множества.
+   */
+  frozen_set<Key, Compare> freeze() const;
+
+  /**
+   * @brief Ищет первый элемент не меньше key.
+   *
+   * Спуск от корня за O(log n).
+   *
+   * @param key Ключ.
+   * @return Итератор на элемент или на конец.
+   */
+  iterator lower_bound(const Key &key);
+
+  /**
+   * @brief Ищет первый элемент не меньше key (константная версия).
+   *
+   * @param key Ключ.
+   * @return Итератор на элемент или на конец.
+   */
+  const_iterator lower_bound(const Key &key) const;
+
+  /**
+   * @brief Ищет первый элемент больше key.
+   *
+   * @param key Ключ.
+   * @return Итератор на элемент или на конец.
+   */
+  iterator upper_bound(const Key &key);
+
+  /**
+   * @brief Ищет первый элемент больше key (константная версия).
+   *
+   * @param key Ключ.
+   * @return Итератор на элемент или на конец.
+   */
+  const_iterator upper_bound(const Key &key) const;
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key.
+   *
+   * @param key Ключ.
+   * @return Пара lower_bound(key) и upper_bound(key).
+   */
+  std::pair<iterator, iterator> equal_range(const Key &key);
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key (константная
+   * версия).
+   *
+   * @param key Ключ.
+   * @return Пара lower_bound(key) и upper_bound(key).
+   */
+  std::pair<const_iterator, const_iterator> equal_range(const Key &key) const;
+
+  /**
+   * @brief Ищет первый элемент не меньше key.
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Итератор на элемент или на конец.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+
+  /**
+   * @brief Ищет первый элемент не меньше key (константная версия).
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Итератор на элемент или на конец.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const;
+
+  /**
+   * @brief Ищет первый элемент больше key.
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Итератор на элемент или на конец.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+
+  /**
+   * @brief Ищет первый элемент больше key (константная версия).
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Итератор на элемент или на конец.
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const;
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key.
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Пара lower_bound(key) и upper_bound(key).
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key);
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key (константная
+   * версия).
+   *
+   * @param key Значение, сравнимое с ключом.
+   * @return Пара lower_bound(key) и upper_bound(key).
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+
+  /**
+   * @brief Находит k-й по порядку элемент множества.
+   *
+   * Требует политики с порядковой статистикой (OrderStatisticTreePolicy),
+   * работает за O(log n).
+   *
+   * @param k Номер элемента, начиная с 0.
+   * @return Итератор на элемент или end(), если k >= size().
+   */
+  iterator nth(size_type k);
+
+  /**
+   * @brief Возвращает количество элементов меньше key.
+   *
+   * Требует политики с порядковой статистикой, работает за O(log n).
+   *
+   * @param key Ключ.
+   * @return Позиция, которую занял бы key в порядке обхода.
+   */
+  size_type rank(const Key &key) const;
+
   /**
    * @brief Возвращает максимальный возможный размер множества.
    *
@@ -183,6 +677,16 @@ class set : public s21::RBTree<Key, Key> {
   void clear();
 };
 
+namespace pmr {
+
+/// Множество, выделяющее узлы из std::pmr::memory_resource
+template <typename Key, typename Compare = std::less<Key>,
+          typename Policy = DefaultTreePolicy>
+using set =
+    s21::set<Key, Compare, std::pmr::polymorphic_allocator<Key>, Policy>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 // clang-format off
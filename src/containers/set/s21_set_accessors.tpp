@@ -11,8 +11,9 @@ namespace s21 {
  * @tparam Key Тип ключа.
  * @return Итератор на начало.
  */
-template <typename Key>
-typename set<Key>::iterator set<Key>::begin() {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::begin() {
   return Base::set_begin();
 }
 
@@ -22,8 +23,9 @@ typename set<Key>::iterator set<Key>::begin() {
  * @tparam Key Тип ключа.
  * @return Итератор на конец.
  */
-template <typename Key>
-typename set<Key>::iterator set<Key>::end() {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::end() {
   return Base::set_end();
 }
 
@@ -33,8 +35,9 @@ typename set<Key>::iterator set<Key>::end() {
  * @tparam Key Тип ключа.
  * @return Константный итератор на начало.
  */
-template <typename Key>
-typename set<Key>::const_iterator set<Key>::cbegin() const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::cbegin() const {
   return Base::set_cbegin();
 }
 
@@ -44,8 +47,33 @@ typename set<Key>::const_iterator set<Key>::cbegin() const {
  * @tparam Key Тип ключа.
  * @return Константный итератор на конец.
  */
-template <typename Key>
-typename set<Key>::const_iterator set<Key>::cend() const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::cend() const {
+  return Base::set_cend();
+}
+
+/**
+ * @brief Возвращает константный итератор на начало множества.
+ *
+ * @tparam Key Тип ключа.
+ * @return Константный итератор на начало.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::begin() const {
+  return Base::set_cbegin();
+}
+
+/**
+ * @brief Возвращает константный итератор на конец множества.
+ *
+ * @tparam Key Тип ключа.
+ * @return Константный итератор на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::end() const {
   return Base::set_cend();
 }
 
@@ -55,8 +83,9 @@ typename set<Key>::const_iterator set<Key>::cend() const {
  * @tparam Key Тип ключа.
  * @param other Другое множество для объединения.
  */
-template <typename Key>
-void set<Key>::merge(set<Key> &other) {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::merge(
+    set<Key, Compare, Allocator, Policy> &other) {
   Base::merge(other);
 }
 
@@ -66,11 +95,139 @@ void set<Key>::merge(set<Key> &other) {
  * @tparam Key Тип ключа.
  * @param other Другое множество для обмена.
  */
-template <typename Key>
-void set<Key>::swap(set<Key> &other) noexcept {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::swap(
+    set<Key, Compare, Allocator, Policy> &other) noexcept {
   Base::swap(other);
 }
 
+/**
+ * @brief Разделяет множество по ключу.
+ *
+ * @tparam Key Тип ключа.
+ * @param key Граница разделения.
+ * @return Множество элементов не меньше key.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+set<Key, Compare, Allocator, Policy>
+set<Key, Compare, Allocator, Policy>::split(const Key &key) {
+  set right(this->key_comp(), this->get_allocator());
+  Base::splitInto(key, right);
+  return right;
+}
+
+/**
+ * @brief Присоединяет множество с большими элементами.
+ *
+ * @tparam Key Тип ключа.
+ * @param right Множество с большими элементами.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::join(set &right) {
+  Base::join(right);
+}
+
+/**
+ * @brief Присоединяет опорный элемент и множество с большими элементами.
+ *
+ * @tparam Key Тип ключа.
+ * @param pivot Опорный элемент.
+ * @param right Множество с большими элементами.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::join(const value_type &pivot,
+                                                set &right) {
+  Base::join(pivot, right);
+}
+
+/**
+ * @brief Объединяет множество с другим.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Добавляемое множество.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::set_union(set other) {
+  Base::set_union(std::move(other));
+}
+
+/**
+ * @brief Оставляет в множестве только элементы, которые есть в other.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Множество элементов, которые нужно оставить.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::set_intersection(set other) {
+  Base::set_intersection(std::move(other));
+}
+
+/**
+ * @brief Удаляет из множества элементы, которые есть в other.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Множество удаляемых элементов.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::set_difference(set other) {
+  Base::set_difference(std::move(other));
+}
+
+/**
+ * @brief Объединяет множество с другим, используя пул потоков.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Добавляемое множество.
+ * @param pool Пул потоков.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::parallel_union(set other,
+                                                          TaskPool &pool) {
+  Base::parallel_union(std::move(other), pool);
+}
+
+/**
+ * @brief Пересекает множество с другим, используя пул потоков.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Множество элементов, которые нужно оставить.
+ * @param pool Пул потоков.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::parallel_intersection(
+    set other, TaskPool &pool) {
+  Base::parallel_intersection(std::move(other), pool);
+}
+
+/**
+ * @brief Удаляет из множества элементы другого, используя пул потоков.
+ *
+ * @tparam Key Тип ключа.
+ * @param other Множество удаляемых элементов.
+ * @param pool Пул потоков.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::parallel_difference(
+    set other, TaskPool &pool) {
+  Base::parallel_difference(std::move(other), pool);
+}
+
+/**
+ * @brief Вставляет диапазон элементов, используя пул потоков.
+ *
+ * @tparam Key Тип ключа.
+ * @param first Начало диапазона.
+ * @param last Конец диапазона.
+ * @param pool Пул потоков.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename InputIt>
+void set<Key, Compare, Allocator, Policy>::parallel_insert(InputIt first,
+                                                           InputIt last,
+                                                           TaskPool &pool) {
+  Base::parallel_insert(first, last, pool);
+}
+
 /**
  * @brief Ищет элемент в множестве.
  *
@@ -78,8 +235,9 @@ void set<Key>::swap(set<Key> &other) noexcept {
  * @param key Ключ для поиска.
  * @return Итератор на найденный элемент или на конец, если элемент не найден.
  */
-template <typename Key>
-typename set<Key>::iterator set<Key>::find(const Key &key) {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::find(const Key &key) {
   return Base::set_find(key);
 }
 
@@ -90,19 +248,310 @@ typename set<Key>::iterator set<Key>::find(const Key &key) {
  * @param key Ключ для проверки.
  * @return true, если элемент содержится в множестве, иначе false.
  */
-template <typename Key>
-bool set<Key>::contains(const Key &key) const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+bool set<Key, Compare, Allocator, Policy>::contains(const Key &key) const {
   return Base::contains(key);
 }
 
+/**
+ * @brief Ищет элемент, эквивалентный значению сравнимого с ключом типа.
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение для поиска.
+ * @return Итератор на найденный элемент или на конец, если элемент не найден.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::find(const K &key) {
+  return Base::set_find(key);
+}
+
+/**
+ * @brief Проверяет, содержится ли элемент, эквивалентный key.
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение для проверки.
+ * @return true, если элемент содержится в множестве, иначе false.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+bool set<Key, Compare, Allocator, Policy>::contains(const K &key) const {
+  return Base::contains(key);
+}
+
+/**
+ * @brief Ищет элементы для последовательности ключей.
+ *
+ * @param first Начало последовательности ключей.
+ * @param last Конец последовательности ключей.
+ * @param out Начало вывода итераторов.
+ * @return Итератор вывода за последним записанным результатом.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt set<Key, Compare, Allocator, Policy>::find_many(ForwardIt first,
+                                                         ForwardIt last,
+                                                         OutputIt out) {
+  Base::findNodes(first, last, [&](typename Base::RBTreeNode *node) {
+    *out++ = node ? iterator(node) : this->end();
+  });
+  return out;
+}
+
+/**
+ * @brief Ищет элементы для последовательности ключей (константная версия).
+ *
+ * @param first Начало последовательности ключей.
+ * @param last Конец последовательности ключей.
+ * @param out Начало вывода константных итераторов.
+ * @return Итератор вывода за последним записанным результатом.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt set<Key, Compare, Allocator, Policy>::find_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  Base::findNodes(first, last, [&](typename Base::RBTreeNode *node) {
+    *out++ = node ? const_iterator(node) : this->end();
+  });
+  return out;
+}
+
+/**
+ * @brief Проверяет, содержатся ли элементы последовательности.
+ *
+ * @param first Начало последовательности ключей.
+ * @param last Конец последовательности ключей.
+ * @param out Начало вывода bool.
+ * @return Итератор вывода за последним записанным результатом.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt set<Key, Compare, Allocator, Policy>::contains_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  return Base::contains_many(first, last, out);
+}
+
+/**
+ * @brief Создает неизменяемый снимок множества.
+ *
+ * @return Снимок множества.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+frozen_set<Key, Compare> set<Key, Compare, Allocator, Policy>::freeze() const {
+  return frozen_set<Key, Compare>(this->begin(), this->end(),
+                                  this->key_comp());
+}
+
+/**
+ * @brief Ищет первый элемент не меньше key.
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::lower_bound(const Key &key) {
+  return iterator(Base::lower_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент не меньше key (константная версия).
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::lower_bound(const Key &key) const {
+  return const_iterator(Base::lower_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент больше key.
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::upper_bound(const Key &key) {
+  return iterator(Base::upper_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент больше key (константная версия).
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::upper_bound(const Key &key) const {
+  return const_iterator(Base::upper_bound(key).iter_node_);
+}
+
+/**
+ * @brief Возвращает диапазон элементов, эквивалентных key.
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Пара lower_bound(key) и upper_bound(key).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+std::pair<typename set<Key, Compare, Allocator, Policy>::iterator,
+          typename set<Key, Compare, Allocator, Policy>::iterator>
+set<Key, Compare, Allocator, Policy>::equal_range(const Key &key) {
+  auto range = Base::equal_range(key);
+  return {iterator(range.first.iter_node_),
+          iterator(range.second.iter_node_)};
+}
+
+/**
+ * @brief Возвращает диапазон элементов, эквивалентных key (константная версия).
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Пара lower_bound(key) и upper_bound(key).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+std::pair<typename set<Key, Compare, Allocator, Policy>::const_iterator,
+          typename set<Key, Compare, Allocator, Policy>::const_iterator>
+set<Key, Compare, Allocator, Policy>::equal_range(const Key &key) const {
+  auto range = Base::equal_range(key);
+  return {const_iterator(range.first.iter_node_),
+          const_iterator(range.second.iter_node_)};
+}
+
+/**
+ * @brief Ищет первый элемент не меньше key.
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::lower_bound(const K &key) {
+  return iterator(Base::lower_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент не меньше key (константная версия).
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::lower_bound(const K &key) const {
+  return const_iterator(Base::lower_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент больше key.
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::upper_bound(const K &key) {
+  return iterator(Base::upper_bound(key).iter_node_);
+}
+
+/**
+ * @brief Ищет первый элемент больше key (константная версия).
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Итератор на элемент или на конец.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator, Policy>::const_iterator
+set<Key, Compare, Allocator, Policy>::upper_bound(const K &key) const {
+  return const_iterator(Base::upper_bound(key).iter_node_);
+}
+
+/**
+ * @brief Возвращает диапазон элементов, эквивалентных key.
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Пара lower_bound(key) и upper_bound(key).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename set<Key, Compare, Allocator, Policy>::iterator,
+          typename set<Key, Compare, Allocator, Policy>::iterator>
+set<Key, Compare, Allocator, Policy>::equal_range(const K &key) {
+  auto range = Base::equal_range(key);
+  return {iterator(range.first.iter_node_),
+          iterator(range.second.iter_node_)};
+}
+
+/**
+ * @brief Возвращает диапазон элементов, эквивалентных key (константная версия).
+ *
+ * @tparam K Тип, сравнимый с Key прозрачным компаратором.
+ * @param key Значение, сравнимое с ключом.
+ * @return Пара lower_bound(key) и upper_bound(key).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename set<Key, Compare, Allocator, Policy>::const_iterator,
+          typename set<Key, Compare, Allocator, Policy>::const_iterator>
+set<Key, Compare, Allocator, Policy>::equal_range(const K &key) const {
+  auto range = Base::equal_range(key);
+  return {const_iterator(range.first.iter_node_),
+          const_iterator(range.second.iter_node_)};
+}
+
+/**
+ * @brief Находит k-й по порядку элемент множества.
+ *
+ * @tparam Key Тип ключа.
+ * @param k Номер элемента, начиная с 0.
+ * @return Итератор на элемент или на конец, если k >= size().
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::nth(size_type k) {
+  return iterator(Base::nth(k).iter_node_);
+}
+
+/**
+ * @brief Возвращает количество элементов меньше key.
+ *
+ * @tparam Key Тип ключа.
+ * @param key Ключ.
+ * @return Позиция, которую занял бы key в порядке обхода.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::size_type
+set<Key, Compare, Allocator, Policy>::rank(const Key &key) const {
+  return Base::rank(key);
+}
+
 /**
  * @brief Возвращает максимальный возможный размер множества.
  *
  * @tparam Key Тип ключа.
  * @return Максимальный размер.
  */
-template <typename Key>
-typename set<Key>::size_type set<Key>::max_size() const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::size_type
+set<Key, Compare, Allocator, Policy>::max_size() const {
   return Base::max_size();
 }
 
@@ -112,8 +561,8 @@ typename set<Key>::size_type set<Key>::max_size() const {
  * @tparam Key Тип ключа.
  * @return true, если множество пусто, иначе false.
  */
-template <typename Key>
-bool set<Key>::empty() const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+bool set<Key, Compare, Allocator, Policy>::empty() const {
   return Base::empty();
 }
 
@@ -123,8 +572,9 @@ bool set<Key>::empty() const {
  * @tparam Key Тип ключа.
  * @return Количество элементов.
  */
-template <typename Key>
-typename set<Key>::size_type set<Key>::size() const {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::size_type
+set<Key, Compare, Allocator, Policy>::size() const {
   return Base::size();
 }
 
@@ -133,8 +583,8 @@ typename set<Key>::size_type set<Key>::size() const {
  *
  * @tparam Key Тип ключа.
  */
-template <typename Key>
-void set<Key>::clear() {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::clear() {
   Base::clear();
 }
 
@@ -8,15 +8,15 @@ namespace s21 {
 /**
  * @brief Конструктор множества из списка инициализации.
  *
+ * Дерево строится за O(n), если ключи в списке упорядочены.
+ *
  * @tparam Key Тип ключа.
  * @param items Список инициализации.
  */
-template <typename Key>
-set<Key>::set(const std::initializer_list<Key> &items) : Base() {
-  for (const auto &item : items) {
-    insert(item);
-  }
-}
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+set<Key, Compare, Allocator, Policy>::set(
+    const std::initializer_list<Key> &items)
+    : Base(items.begin(), items.end()) {}
 
 /**
  * @brief Оператор перемещающего присваивания.
@@ -25,8 +25,11 @@ set<Key>::set(const std::initializer_list<Key> &items) : Base() {
  * @param other Другое множество для перемещения.
  * @return Ссылка на текущее множество.
  */
-template <typename Key>
-set<Key> &set<Key>::operator=(set<Key> &&other) noexcept {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+set<Key, Compare, Allocator, Policy> &
+set<Key, Compare, Allocator, Policy>::operator=(
+    set<Key, Compare, Allocator, Policy> &&other) noexcept(
+    std::is_nothrow_move_assignable_v<Base>) {
   if (this != &other) {
     Base::operator=(std::move(other));
   }
@@ -40,8 +43,10 @@ set<Key> &set<Key>::operator=(set<Key> &&other) noexcept {
  * @param other Другое множество для копирования.
  * @return Ссылка на текущее множество.
  */
-template <typename Key>
-set<Key> &set<Key>::operator=(const set<Key> &other) {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+set<Key, Compare, Allocator, Policy> &
+set<Key, Compare, Allocator, Policy>::operator=(
+    const set<Key, Compare, Allocator, Policy> &other) {
   if (this != &other) {
     Base::operator=(other);
   }
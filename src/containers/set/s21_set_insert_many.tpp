@@ -13,10 +13,11 @@ namespace s21 {
  * @param args Аргументы для вставки.
  * @return Вектор пар из итераторов на вставленные элементы и флагов успешности.
  */
-template <typename Key>
+template <typename Key, typename Compare, typename Allocator, typename Policy>
 template <typename... Args>
-s21::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args&&... args) {
+s21::vector<
+    std::pair<typename set<Key, Compare, Allocator, Policy>::iterator, bool>>
+set<Key, Compare, Allocator, Policy>::insert_many(Args&&... args) {
   s21::vector<std::pair<iterator, bool>> results;
   (results.push_back(this->insert(std::forward<Args>(args))), ...);
   return results;
@@ -12,14 +12,89 @@ namespace s21 {
  * @param value Значение для вставки.
  * @return Пара из итератора на вставленный элемент и флага успешности.
  */
-template <typename Key>
-std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
-    const Key &value) {
-  bool success = !this->contains(value);
-  if (success) {
-    s21::RBTree<Key, Key>::insert(value, value);
-  }
-  return {find(value), success};
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+std::pair<typename set<Key, Compare, Allocator, Policy>::iterator, bool>
+set<Key, Compare, Allocator, Policy>::insert(const Key &value) {
+  auto [node, success] = Base::insertUnique(value, value);
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Вставляет элемент, перемещая его в узел.
+ *
+ * Место ищется до перемещения, поэтому value служит и ключом поиска.
+ *
+ * @param value Значение для вставки.
+ * @return Пара из итератора на элемент и флага успешности.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+std::pair<typename set<Key, Compare, Allocator, Policy>::iterator, bool>
+set<Key, Compare, Allocator, Policy>::insert(value_type &&value) {
+  auto [node, success] = Base::insertUnique(value, std::move(value));
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Строит элемент прямо в узле.
+ *
+ * @param args Аргументы конструктора элемента.
+ * @return Пара из итератора на элемент и флага успешности.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename... Args>
+std::pair<typename set<Key, Compare, Allocator, Policy>::iterator, bool>
+set<Key, Compare, Allocator, Policy>::emplace(Args &&...args) {
+  auto [node, success] =
+      Base::emplaceUniqueHint(nullptr, std::forward<Args>(args)...);
+  return {iterator(node), success};
+}
+
+/**
+ * @brief Вставляет элемент по подсказке.
+ *
+ * @param hint Итератор, перед которым ожидается элемент.
+ * @param value Значение для вставки.
+ * @return Итератор на вставленный элемент или равный ему.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::insert(const_iterator hint,
+                                             const value_type &value) {
+  return iterator(
+      Base::insertUniqueHint(Base::nodeOf(hint), value, value).first);
+}
+
+/**
+ * @brief Вставляет элемент по подсказке, перемещая его в узел.
+ *
+ * @param hint Итератор, перед которым ожидается элемент.
+ * @param value Значение для вставки.
+ * @return Итератор на вставленный элемент или равный ему.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::insert(const_iterator hint,
+                                             value_type &&value) {
+  return iterator(
+      Base::insertUniqueHint(Base::nodeOf(hint), value, std::move(value))
+          .first);
+}
+
+/**
+ * @brief Строит элемент на месте и вставляет его по подсказке.
+ *
+ * @param hint Итератор, перед которым ожидается элемент.
+ * @param args Аргументы конструктора элемента.
+ * @return Итератор на вставленный элемент или равный ему.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+template <typename... Args>
+typename set<Key, Compare, Allocator, Policy>::iterator
+set<Key, Compare, Allocator, Policy>::emplace_hint(const_iterator hint,
+                                                   Args &&...args) {
+  return iterator(
+      Base::emplaceUniqueHint(Base::nodeOf(hint), std::forward<Args>(args)...)
+          .first);
 }
 
 /**
@@ -30,12 +105,50 @@ std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
  * @throws std::invalid_argument Если итератор указывает на конец или является
  * недействительным.
  */
-template <typename Key>
-void set<Key>::erase(iterator pos) {
-  if (pos == end()) {
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+void set<Key, Compare, Allocator, Policy>::erase(iterator pos) {
+  if (pos == iterator() || pos == end()) {
     throw std::invalid_argument("Invalid iterator");
   }
   Base::remove(*pos);
 }
 
+/**
+ * @brief Извлекает узел из множества без копирования ключа.
+ *
+ * @param pos Итератор на извлекаемый элемент.
+ * @return Дескриптор узла (пустой для end()).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::node_type
+set<Key, Compare, Allocator, Policy>::extract(iterator pos) {
+  return Base::extract(typename Base::Iterator(Base::nodeOf(pos)));
+}
+
+/**
+ * @brief Извлекает узел по ключу.
+ *
+ * @param key Ключ извлекаемого элемента.
+ * @return Дескриптор узла (пустой, если ключа нет).
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::node_type
+set<Key, Compare, Allocator, Policy>::extract(const Key &key) {
+  return Base::extract(key);
+}
+
+/**
+ * @brief Вставляет извлеченный узел.
+ *
+ * @param node Дескриптор узла.
+ * @return Позиция, флаг вставки и узел, если ключ уже есть.
+ */
+template <typename Key, typename Compare, typename Allocator, typename Policy>
+typename set<Key, Compare, Allocator, Policy>::insert_return_type
+set<Key, Compare, Allocator, Policy>::insert(node_type &&node) {
+  auto result = Base::insert(std::move(node));
+  return {iterator(result.position.iter_node_), result.inserted,
+          std::move(result.node)};
+}
+
 }  // namespace s21
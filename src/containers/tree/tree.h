@@ -6,13 +6,215 @@
 #ifndef TREE_H
 #define TREE_H
 
+#include "tree_pool.h"
+
 namespace s21 {
 
+class TaskPool;  ///< Пул потоков параллельных операций (tree_parallel.h)
+
 /**
  * @brief Перечисление для цвета узла в красно-черном дереве
  */
 enum Color { RED, BLACK };
 
+/**
+ * @brief Свойства элемента, хранимого в узле дерева
+ * @details Узел словаря хранит одну пару ключ-значение, ключ читается из first
+ * @tparam Key Тип ключа
+ * @tparam Value Тип значения
+ */
+template <typename Key, typename Value>
+struct RBTreeValueTraits {
+  using value_type = std::pair<const Key, Value>;  ///< Хранимый элемент
+  using mapped_type = Value;                       ///< Тип значения
+
+  /// @brief Ключ элемента
+  static const Key& key(const value_type& v) noexcept { return v.first; }
+  /// @brief Значение элемента
+  static mapped_type& mapped(value_type& v) noexcept { return v.second; }
+  /// @brief Значение элемента (константная версия)
+  static const mapped_type& mapped(const value_type& v) noexcept {
+    return v.second;
+  }
+};
+
+/**
+ * @brief Свойства элемента дерева без значения (используется set)
+ * @details Узел хранит только ключ, значением считается сам ключ
+ * @tparam Key Тип ключа
+ */
+template <typename Key>
+struct RBTreeValueTraits<Key, void> {
+  using value_type = Key;   ///< Хранимый элемент
+  using mapped_type = Key;  ///< Тип значения
+
+  /// @brief Ключ элемента
+  static const Key& key(const value_type& v) noexcept { return v; }
+  /// @brief Значение элемента (совпадает с ключом)
+  static mapped_type& mapped(value_type& v) noexcept { return v; }
+  /// @brief Значение элемента (константная версия)
+  static const mapped_type& mapped(const value_type& v) noexcept { return v; }
+};
+
+/**
+ * @brief Политика дерева по умолчанию
+ * @details Каждый узел выделяется в общей куче отдельно, размеры поддеревьев
+ * не хранятся
+ */
+struct DefaultTreePolicy {
+  static constexpr bool pooled_nodes = false;  ///< Узлы выделяются из пула
+  static constexpr bool order_statistics = false;  ///< Веса поддеревьев
+  static constexpr bool unit_weights = true;  ///< Каждый элемент весит 1
+  static constexpr bool threaded = false;  ///< Ссылки на соседние узлы
+  static constexpr bool compact_nodes = false;  ///< Цвет в бите родителя
+
+  /**
+   * @brief Вес элемента в порядковой статистике
+   * @details Для map и set каждый элемент весит 1, multiset переопределяет вес
+   * числом копий
+   * @return Вес элемента
+   */
+  template <typename V>
+  static constexpr size_t element_weight(const V&) noexcept {
+    return 1;
+  }
+};
+
+/**
+ * @brief Политика дерева с пулом узлов
+ * @details Узлы выделяются из слэбов NodePool, clear() освобождает все слэбы
+ * разом
+ */
+struct PooledTreePolicy : DefaultTreePolicy {
+  static constexpr bool pooled_nodes = true;  ///< Узлы выделяются из пула
+};
+
+/**
+ * @brief Политика дерева с порядковой статистикой
+ * @details Каждый узел хранит суммарный вес своего поддерева, что дает nth(),
+ * rank() и разность итераторов за O(log n). Вставка и удаление дополнительно
+ * обновляют веса на пути до корня. Пул и статистика сочетаются
+ * наследованием от PooledTreePolicy с order_statistics = true
+ */
+struct OrderStatisticTreePolicy : DefaultTreePolicy {
+  static constexpr bool order_statistics = true;  ///< Веса поддеревьев
+};
+
+/**
+ * @brief Политика дерева с прошитыми узлами
+ * @details Каждый узел хранит ссылки на предыдущий и следующий узел в порядке
+ * ключей, поэтому шаг итератора - одно чтение указателя, а не подъем по
+ * родителям за O(log n) в худшем случае. Узел растет на два указателя,
+ * вставка и удаление перевязывают соседей за O(1), соединение поддеревьев в
+ * split, join и операциях над множествами дополнительно ищет крайние узлы
+ * за O(log n)
+ */
+struct ThreadedTreePolicy : DefaultTreePolicy {
+  static constexpr bool threaded = true;  ///< Ссылки на соседние узлы
+};
+
+/**
+ * @brief Политика дерева с компактными узлами
+ * @details Цвет хранится в младшем бите указателя на родителя: узлы
+ * выровнены как минимум по указателю, поэтому бит всегда свободен. Узел
+ * теряет поле цвета вместе с выравниванием, для map<int, int> это 32 байта
+ * вместо 40. Чтение родителя стоит одну маску
+ */
+struct CompactTreePolicy : DefaultTreePolicy {
+  static constexpr bool compact_nodes = true;  ///< Цвет в бите родителя
+};
+
+/**
+ * @brief Вес поддерева, хранимый в узле
+ * @details Без порядковой статистики поле отсутствует и узел не растет
+ * @tparam Enabled Хранить ли вес
+ */
+template <bool Enabled>
+struct RBTreeNodeWeight {};
+
+/**
+ * @brief Вес поддерева, хранимый в узле (порядковая статистика включена)
+ */
+template <>
+struct RBTreeNodeWeight<true> {
+  size_t subtree_weight = 0;  ///< Суммарный вес элементов поддерева
+};
+
+/**
+ * @brief Ссылки на соседей узла в порядке ключей
+ * @details Без прошивки поля отсутствуют и узел не растет
+ * @tparam Enabled Хранить ли ссылки
+ * @tparam Node Тип узла
+ */
+template <bool Enabled, typename Node>
+struct RBTreeNodeThreads {};
+
+/**
+ * @brief Ссылки на соседей узла в порядке ключей (прошивка включена)
+ * @details Узлы вместе с заголовком образуют кольцо: у минимального узла
+ * предыдущий - заголовок, у максимального следующий - заголовок
+ */
+template <typename Node>
+struct RBTreeNodeThreads<true, Node> {
+  Node* prev = nullptr;  ///< Предыдущий узел или заголовок
+  Node* next = nullptr;  ///< Следующий узел или заголовок
+};
+
+/**
+ * @brief Цвет узла и указатель на родителя в отдельных полях
+ * @tparam Compact Хранить ли цвет в бите указателя на родителя
+ * @tparam Node Тип узла
+ */
+template <bool Compact, typename Node>
+struct RBTreeNodeParent {
+  Color color = RED;      ///< Цвет узла (RED или BLACK)
+  Node* parent = nullptr;  ///< Указатель на родительский узел
+
+  Color getColor() const noexcept { return color; }
+  void setColor(Color c) noexcept { color = c; }
+  Node* getParent() const noexcept { return parent; }
+  void setParent(Node* node) noexcept { parent = node; }
+};
+
+/**
+ * @brief Цвет узла в младшем бите указателя на родителя
+ * @details RED равен 0, поэтому у красного узла слово совпадает с адресом
+ * родителя
+ */
+template <typename Node>
+struct RBTreeNodeParent<true, Node> {
+  Color getColor() const noexcept {
+    return static_cast<Color>(parent_and_color_ & kColorBit);
+  }
+  void setColor(Color c) noexcept {
+    parent_and_color_ = (parent_and_color_ & ~kColorBit) |
+                        static_cast<std::uintptr_t>(c);
+  }
+  Node* getParent() const noexcept {
+    return reinterpret_cast<Node*>(parent_and_color_ & ~kColorBit);
+  }
+  void setParent(Node* node) noexcept {
+    parent_and_color_ = reinterpret_cast<std::uintptr_t>(node) |
+                        (parent_and_color_ & kColorBit);
+  }
+
+ private:
+  static constexpr std::uintptr_t kColorBit = 1;  ///< Бит цвета
+  std::uintptr_t parent_and_color_ = 0;  ///< Адрес родителя и цвет
+};
+
+/**
+ * @brief Функтор объединения значений по умолчанию: остается значение дерева
+ * @details При совпадении ключей в set_union и set_intersection значение
+ * дерева не меняется, как при обычном merge
+ */
+struct KeepExistingValue {
+  template <typename T>
+  const T& operator()(const T& ours, const T&) const noexcept {
+    return ours;
+  }
+};
+
 /**
  * @brief Класс реализующий красно-черное дерево
  * @details Красно-черное дерево - это сбалансированное бинарное дерево поиска,
@@ -24,40 +226,83 @@ enum Color { RED, BLACK };
  * 4. Все пути от корня до листьев содержат одинаковое количество черных узлов
  *
  * @tparam Key Тип ключа в дереве
- * @tparam Value Тип значения, хранимого в дереве
+ * @tparam Value Тип значения, хранимого в дереве (void - дерево хранит только
+ * ключи)
+ * @tparam Compare Строгий слабый порядок на ключах (по умолчанию std::less).
+ * Если в нем объявлен is_transparent, поиск принимает ключи любого сравнимого
+ * типа без построения временного Key
+ * @tparam Allocator Аллокатор элементов, для узлов он перепривязывается к
+ * типу узла
+ * @tparam Policy Политика дерева (DefaultTreePolicy, PooledTreePolicy,
+ * OrderStatisticTreePolicy, ThreadedTreePolicy или CompactTreePolicy)
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<
+              typename RBTreeValueTraits<Key, Value>::value_type>,
+          typename Policy = DefaultTreePolicy>
 class RBTree {
  public:
-  using value_type = std::pair<const Key, Value>;  ///< Тип пары ключ-значение
-  using reference = value_type&;  ///< Ссылка на пару ключ-значение
-  using const_reference =
-      const value_type&;     ///< Константная ссылка на пару ключ-значение
-  using size_type = size_t;  ///< Тип для размера дерева
+  using Traits = RBTreeValueTraits<Key, Value>;  ///< Свойства элемента
+  using value_type = typename Traits::value_type;  ///< Тип хранимого элемента
+  using mapped_type = typename Traits::mapped_type;  ///< Тип значения
+  using reference = value_type&;  ///< Ссылка на элемент
+  using const_reference = const value_type&;  ///< Константная ссылка на элемент
+  using size_type = size_t;                   ///< Тип для размера дерева
+  using key_compare = Compare;                ///< Тип компаратора ключей
+  using allocator_type = Allocator;           ///< Тип аллокатора элементов
 
   /**
    * @brief Структура узла красно-черного дерева
-   * @details Каждый узел содержит ключ, значение, цвет и указатели на родителя
-   * и потомков
-   */
-  struct RBTreeNode {
-    Key key;             ///< Ключ узла
-    Value value;         ///< Значение узла
-    value_type pair;     ///< Пара ключ-значение
-    Color color;         ///< Цвет узла (RED или BLACK)
-    RBTreeNode* left;    ///< Указатель на левого потомка
-    RBTreeNode* right;   ///< Указатель на правого потомка
-    RBTreeNode* parent;  ///< Указатель на родительский узел
+   * @details Каждый узел хранит элемент ровно один раз (пару ключ-значение или
+   * только ключ), цвет и указатели на родителя и потомков. Элемент лежит в
+   * анонимном объединении: его создает и разрушает аллокатор дерева, а не
+   * конструктор узла. Цвет и родитель читаются и пишутся через getColor,
+   * setColor, getParent и setParent, так как компактный узел хранит их в
+   * одном слове
+   */
+  struct RBTreeNode
+      : RBTreeNodeWeight<Policy::order_statistics>,
+        RBTreeNodeThreads<Policy::threaded, RBTreeNode>,
+        RBTreeNodeParent<Policy::compact_nodes, RBTreeNode> {
+    union {
+      value_type data;  ///< Элемент узла
+    };
+    RBTreeNode* left;   ///< Указатель на левого потомка
+    RBTreeNode* right;  ///< Указатель на правого потомка
 
     /**
      * @brief Конструктор узла
-     * @param k Ключ узла
-     * @param v Значение узла
-     * @param c Цвет узла (по умолчанию RED)
+     * @details Элемент не создается, его строит RBTree::createNode
+     * @param c Цвет узла
+     */
+    explicit RBTreeNode(Color c) noexcept;
+
+    /**
+     * @brief Деструктор узла
+     * @details Элемент не разрушается, его разрушает RBTree::destroyNode
+     */
+    ~RBTreeNode() {}
+
+    /**
+     * @brief Ключ узла
+     * @return Константная ссылка на ключ элемента
+     */
+    const Key& key() const noexcept { return Traits::key(data); }
+
+    /**
+     * @brief Значение узла
+     * @return Ссылка на значение элемента
      */
-    RBTreeNode(Key k, Value v, Color c = Color::RED);
+    mapped_type& value() noexcept { return Traits::mapped(data); }
+    const mapped_type& value() const noexcept { return Traits::mapped(data); }
   };
 
+  /// @brief Хранилище памяти узлов, выбранное политикой
+  using NodeStorage =
+      std::conditional_t<Policy::pooled_nodes,
+                         NodePool<RBTreeNode, Allocator>,
+                         HeapNodeStorage<RBTreeNode, Allocator>>;
+
   RBTreeNode* root;  ///< Корневой узел дерева
 
   // === Конструкторы и деструктор ===
@@ -68,12 +313,39 @@ class RBTree {
    */
   RBTree();
 
+  /**
+   * @brief Конструктор с аллокатором
+   * @param alloc Аллокатор, из которого выделяются узлы дерева
+   */
+  explicit RBTree(const allocator_type& alloc);
+
+  /**
+   * @brief Конструктор с компаратором
+   * @param comp Компаратор ключей
+   * @param alloc Аллокатор, из которого выделяются узлы дерева
+   */
+  explicit RBTree(const key_compare& comp,
+                  const allocator_type& alloc = allocator_type());
+
   /**
    * @brief Конструктор с инициализатором списка
    * @param items Список пар ключ-значение для инициализации дерева
    */
   RBTree(std::initializer_list<value_type> const& items);
 
+  /**
+   * @brief Конструктор из диапазона
+   * @details Отсортированный диапазон превращается в дерево за O(n), иначе
+   * элементы сначала сортируются. Из эквивалентных ключей остается первый
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   * @param comp Компаратор ключей
+   * @param alloc Аллокатор, из которого выделяются узлы дерева
+   */
+  template <typename InputIt>
+  RBTree(InputIt first, InputIt last, const key_compare& comp = key_compare(),
+         const allocator_type& alloc = allocator_type());
+
   /**
    * @brief Конструктор копирования
    * @param t Дерево для копирования
@@ -86,6 +358,20 @@ class RBTree {
    */
   RBTree(RBTree&& t) noexcept;
 
+  /**
+   * @brief Конструктор копирования с аллокатором
+   * @param t Дерево для копирования
+   * @param alloc Аллокатор, из которого выделяются узлы копии
+   */
+  RBTree(const RBTree& t, const allocator_type& alloc);
+
+  /**
+   * @brief Конструктор перемещения с аллокатором
+   * @param t Дерево для перемещения, становится пустым
+   * @param alloc Аллокатор, из которого выделяются узлы дерева
+   */
+  RBTree(RBTree&& t, const allocator_type& alloc);
+
   /**
    * @brief Виртуальный деструктор
    * @details Освобождает всю память, занятую деревом
@@ -99,7 +385,10 @@ class RBTree {
    * @param t Дерево для перемещения
    * @return Ссылка на текущее дерево
    */
-  RBTree& operator=(RBTree&& t) noexcept;
+  RBTree& operator=(RBTree&& t) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
 
   /**
    * @brief Оператор присваивания копированием
@@ -116,46 +405,74 @@ class RBTree {
    */
   class Iterator {
    public:
-    using value_type = std::pair<const Key, Value>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename RBTree::value_type;
+    using difference_type = std::ptrdiff_t;
     using pointer = value_type*;
     using reference = value_type&;
 
     Iterator();
-    Iterator(RBTreeNode* node, RBTreeNode* past = nullptr);
+    Iterator(RBTreeNode* node);
 
-    RBTreeNode* iter_node_;  ///< Текущий узел
-    RBTreeNode* past_node_;  ///< Предыдущий узел
+    RBTreeNode* iter_node_;  ///< Текущий узел (заголовок дерева для end())
 
     Iterator& operator++();
     Iterator operator++(int);
+    Iterator& operator--();
+    Iterator operator--(int);
     bool operator!=(const Iterator& other) const;
     bool operator==(const Iterator& other) const;
     reference operator*() const;
     pointer operator->() const;
+
+    /**
+     * @brief Расстояние между итераторами
+     * @details Требует порядковой статистики, работает за O(log n) независимо
+     * от расстояния
+     * @param other Итератор того же дерева
+     * @return Разность позиций текущего итератора и other
+     */
+    difference_type operator-(const Iterator& other) const;
   };
 
   /**
    * @brief Класс константного итератора
-   * @details Позволяет обходить дерево без возможности изменения элементов
+   * @details Позволяет обходить дерево без возможности изменения элементов.
+   * Разыменование возвращает ссылку на элемент в узле, без копирования
    */
   class ConstIterator : public Iterator {
    public:
+    using pointer = const value_type*;    ///< Указатель на элемент
+    using reference = const value_type&;  ///< Ссылка на элемент
+
     ConstIterator();
     explicit ConstIterator(RBTreeNode* node);
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+    ConstIterator& operator--();
+    ConstIterator operator--(int);
     bool operator==(const ConstIterator& other) const;
-    const std::pair<Key, Value> operator*() const;
+    reference operator*() const;
+    pointer operator->() const;
   };
 
+  /// @brief Обратный итератор (от наибольшего ключа к наименьшему)
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  /// @brief Константный обратный итератор
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
   // === Методы для работы с итераторами ===
 
   /**
    * @brief Получить итератор на начало дерева
+   * @details Минимальный узел хранится в заголовке, поэтому работает за O(1)
    * @return Итератор, указывающий на узел с минимальным ключом
    */
   Iterator begin();
 
   /**
    * @brief Получить итератор на конец дерева
+   * @details Итератор указывает на заголовок, --end() дает последний элемент
    * @return Итератор, указывающий на позицию после последнего элемента
    */
   Iterator end();
@@ -186,16 +503,55 @@ class RBTree {
    */
   ConstIterator cend() const;
 
+  /**
+   * @brief Получить обратный итератор на наибольший элемент
+   * @return Обратный итератор, построенный из end()
+   */
+  ReverseIterator rbegin() { return ReverseIterator(end()); }
+
+  /**
+   * @brief Получить обратный итератор на позицию перед наименьшим элементом
+   * @return Обратный итератор, построенный из begin()
+   */
+  ReverseIterator rend() { return ReverseIterator(begin()); }
+
+  /**
+   * @brief Получить константный обратный итератор на наибольший элемент
+   * @return Константный обратный итератор
+   */
+  ConstReverseIterator crbegin() const { return ConstReverseIterator(end()); }
+
+  /**
+   * @brief Получить константный обратный итератор на конец обхода
+   * @return Константный обратный итератор
+   */
+  ConstReverseIterator crend() const { return ConstReverseIterator(begin()); }
+
   // === Методы модификации дерева ===
 
   /**
    * @brief Вставить элемент в дерево
    * @param key Ключ для вставки
-   * @param value Значение для вставки
+   * @param args Значение для вставки (отсутствует для дерева без значений)
+   * @return Пара из итератора на элемент с ключом key и флага успешной
+   * вставки
    * @details Если элемент с таким ключом уже существует, вставка не
    * производится
    */
-  void insert(const Key& key, const Value& value);
+  template <typename... Args>
+  std::pair<Iterator, bool> insert(const Key& key, Args&&... args);
+
+  /**
+   * @brief Заменить содержимое дерева элементами диапазона
+   * @details Узлы создаются в порядке диапазона и связываются в идеально
+   * сбалансированное дерево за O(n), перекраска и повороты не нужны. Если
+   * диапазон не отсортирован по Compare, узлы сначала сортируются за
+   * O(n log n). Из эквивалентных ключей остается первый
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
 
   /**
    * @brief Удалить элемент из дерева
@@ -213,17 +569,61 @@ class RBTree {
   /**
    * @brief Обменять содержимое с другим деревом
    * @param other Дерево для обмена
-   * @details Обменивает корни и размеры деревьев
+   * @details Обменивает корни, размеры и память узлов деревьев
    */
   void swap(RBTree& other) noexcept;
 
   /**
    * @brief Объединить с другим деревом
    * @param other Дерево для объединения
-   * @details Переносит все элементы из другого дерева в текущее
+   * @details Переносит из other элементы, ключей которых нет в дереве, а
+   * элементы с совпавшими ключами остаются в other. Если хранилища узлов
+   * совместимы, узлы перевешиваются без выделения памяти и копирования
+   * элементов, иначе элемент перемещается в новый узел
    */
   void merge(RBTree& other);
 
+  // === Извлечение и вставка узлов ===
+
+  class NodeHandle;
+
+  /**
+   * @brief Результат вставки узла
+   * @tparam It Тип итератора контейнера
+   */
+  template <typename It>
+  struct InsertReturn {
+    It position;      ///< Вставленный узел или узел с тем же ключом
+    bool inserted;    ///< Был ли узел вставлен
+    NodeHandle node;  ///< Невставленный узел (пустой при успехе)
+  };
+
+  /**
+   * @brief Извлечь узел из дерева без освобождения памяти
+   * @details Узел отвязывается от дерева за O(log n), элемент не копируется.
+   * Узлы пула (PooledTreePolicy) принадлежат дереву, поэтому для него
+   * элемент перемещается в отдельно выделенный узел
+   * @param pos Итератор на извлекаемый элемент
+   * @return Владеющий узлом дескриптор (пустой для end())
+   */
+  NodeHandle extract(Iterator pos);
+
+  /**
+   * @brief Извлечь узел по ключу
+   * @param key Ключ извлекаемого элемента
+   * @return Владеющий узлом дескриптор (пустой, если ключа нет)
+   */
+  NodeHandle extract(const Key& key);
+
+  /**
+   * @brief Вставить извлеченный узел
+   * @details При равных аллокаторах узел подвешивается к дереву без
+   * выделения памяти, иначе элемент перемещается в новый узел
+   * @param node Дескриптор узла
+   * @return Позиция, флаг вставки и дескриптор, если ключ уже был в дереве
+   */
+  InsertReturn<Iterator> insert(NodeHandle&& node);
+
   // === Методы доступа к элементам ===
 
   const_reference get(const Key& key) const;
@@ -231,12 +631,304 @@ class RBTree {
   Iterator find(const Key& key);
   ConstIterator find(const Key& key) const;
 
+  /**
+   * @brief Проверить наличие ключа, сравнимого с key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами дерева
+   * @return true, если найден эквивалентный ключ
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+
+  /**
+   * @brief Найти элемент по ключу, сравнимому с key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами дерева
+   * @return Итератор на найденный элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator find(const K& key);
+
+  /**
+   * @brief Найти элемент по ключу, сравнимому с key (константный)
+   * @param key Значение, сравнимое с ключами дерева
+   * @return Константный итератор на найденный элемент или cend()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  ConstIterator find(const K& key) const;
+
+  // === Поиск границ за O(log n) ===
+
+  /**
+   * @brief Найти первый элемент с ключом не меньше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  Iterator lower_bound(const Key& key);
+  ConstIterator lower_bound(const Key& key) const;
+
+  /**
+   * @brief Найти первый элемент с ключом больше key
+   * @param key Ключ
+   * @return Итератор на элемент или end()
+   */
+  Iterator upper_bound(const Key& key);
+  ConstIterator upper_bound(const Key& key) const;
+
+  /**
+   * @brief Найти диапазон элементов с ключом, эквивалентным key
+   * @details Ключи уникальны, поэтому хватает одного спуска: диапазон
+   * содержит найденный узел или пуст
+   * @param key Ключ
+   * @return Пара lower_bound(key) и upper_bound(key)
+   */
+  std::pair<Iterator, Iterator> equal_range(const Key& key);
+  std::pair<ConstIterator, ConstIterator> equal_range(const Key& key) const;
+
+  /**
+   * @brief Границы для ключа, сравнимого с key
+   * @details Доступны только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами дерева
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator lower_bound(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  ConstIterator lower_bound(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator upper_bound(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  ConstIterator upper_bound(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<Iterator, Iterator> equal_range(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<ConstIterator, ConstIterator> equal_range(const K& key) const;
+
+  // === Пакетный поиск ===
+
+  /// @brief Число поисков, которые пакетный поиск ведет одновременно
+  static constexpr size_type kLookupBatch = 16;
+
+  /**
+   * @brief Найти элементы для последовательности ключей
+   * @details Ключи берутся группами по kLookupBatch, и спуски группы
+   * делают шаг по очереди: следующий узел каждого спуска запрашивается
+   * prefetch, пока выполняются сравнения в остальных. Промахи кеша
+   * разных спусков перекрываются, что на деревьях больше кеша дает
+   * выигрыш по сравнению с циклом find. Результаты пишутся в порядке ключей
+   * @tparam ForwardIt Итератор ключей (Key или тип, сравнимый с Key)
+   * @tparam OutputIt Итератор вывода, принимающий Iterator
+   * @param first Начало последовательности ключей
+   * @param last Конец последовательности ключей
+   * @param out Начало вывода: итератор на элемент или end() для каждого ключа
+   * @return Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  /**
+   * @brief Проверить наличие последовательности ключей
+   * @details Тот же пакетный спуск, что в find_many
+   * @param first Начало последовательности ключей
+   * @param last Конец последовательности ключей
+   * @param out Начало вывода bool для каждого ключа
+   * @return Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) const;
+
+  // === Порядковая статистика (Policy::order_statistics) ===
+
+  /**
+   * @brief Найти k-й по порядку элемент
+   * @details Спуск по весам поддеревьев за O(log n). Если элементы имеют вес
+   * больше 1, итератор указывает на узел, содержащий k-й элемент
+   * @param k Номер элемента, начиная с 0
+   * @return Итератор на элемент или end(), если k не меньше суммарного веса
+   */
+  Iterator nth(size_type k);
+
+  /**
+   * @brief Найти k-й по порядку элемент (константный)
+   * @param k Номер элемента, начиная с 0
+   * @return Константный итератор на элемент или end()
+   */
+  ConstIterator nth(size_type k) const;
+
+  /**
+   * @brief Количество элементов с ключом меньше key
+   * @details Один спуск от корня за O(log n)
+   * @param key Ключ
+   * @return Суммарный вес элементов, строго меньших key
+   */
+  size_type rank(const Key& key) const;
+
+  /**
+   * @brief Пересчитать веса после изменения веса элемента
+   * @details Нужен, когда вес элемента зависит от его значения (multiset
+   * хранит число копий) и значение изменилось на месте. Без порядковой
+   * статистики ничего не делает
+   * @param pos Итератор на измененный элемент
+   */
+  void update_weight(Iterator pos) noexcept;
+
+  // === Разделение и соединение деревьев ===
+
+  /**
+   * @brief Разделить дерево по ключу
+   * @details Элементы с ключом меньше key остаются в дереве, остальные
+   * переходят в результат. Узлы не копируются: путь поиска key разбирается
+   * снизу вверх и его узлы соединяются join за O(log n). Размеры частей
+   * считаются за O(log n) при порядковой статистике, иначе обходом меньшей
+   * части. Узлы из пула (PooledTreePolicy) принадлежат пулу исходного
+   * дерева, поэтому перешедшая часть копируется в пул результата
+   * @param key Граница разделения
+   * @return Дерево с ключами не меньше key
+   */
+  RBTree split(const Key& key);
+
+  /**
+   * @brief Присоединить дерево с большими ключами
+   * @details Все ключи right должны быть больше ключей дерева. Максимальный
+   * узел дерева становится опорным и соединяет деревья по черной высоте за
+   * O(log n). Если узлы right нельзя забрать (пул или неравные аллокаторы),
+   * они сначала копируются за O(m)
+   * @param right Дерево с большими ключами, становится пустым
+   * @throw std::invalid_argument Если диапазоны ключей пересекаются
+   */
+  void join(RBTree& right);
+
+  /**
+   * @brief Присоединить опорный элемент и дерево с большими ключами
+   * @details Ключи дерева должны быть меньше ключа pivot, а ключи right -
+   * больше. Работает за O(log n)
+   * @param pivot Элемент, разделяющий деревья
+   * @param right Дерево с большими ключами, становится пустым
+   * @throw std::invalid_argument Если ключи нарушают порядок
+   */
+  void join(const value_type& pivot, RBTree& right);
+
+  // === Теоретико-множественные операции ===
+
+  /**
+   * @brief Объединить дерево с другим
+   * @details Рекурсивный алгоритм на split и join: корень дерева делит other
+   * по своему ключу, половины объединяются с поддеревьями корня и снова
+   * соединяются через корень. Работает за O(m log(n/m + 1)), где m - размер
+   * меньшего дерева, поэтому малая дельта вливается в большое дерево без
+   * обхода всех его узлов. Узлы other переходят в дерево без копирования,
+   * если хранилища совместимы
+   * @param other Добавляемое дерево (передается по значению: std::move
+   * избегает копирования)
+   * @param combine Функтор combine(ours, theirs), возвращающий новое значение
+   * для совпавшего ключа. Не должен бросать исключений
+   */
+  template <typename Combine = KeepExistingValue>
+  void set_union(RBTree other, Combine combine = Combine());
+
+  /**
+   * @brief Оставить в дереве только ключи, которые есть в other
+   * @details Тот же рекурсивный алгоритм за O(m log(n/m + 1))
+   * @param other Дерево ключей, которые нужно оставить
+   * @param combine Функтор combine(ours, theirs), возвращающий новое значение
+   * для совпавшего ключа. Не должен бросать исключений
+   */
+  template <typename Combine = KeepExistingValue>
+  void set_intersection(RBTree other, Combine combine = Combine());
+
+  /**
+   * @brief Удалить из дерева ключи, которые есть в other
+   * @details Корень other делит дерево по своему ключу, разность считается
+   * для половин, а половины соединяются без опорного узла. Работает за
+   * O(m log(n/m + 1))
+   * @param other Дерево удаляемых ключей
+   */
+  void set_difference(RBTree other);
+
+  // === Параллельные операции над множествами (tree_parallel.h) ===
+
+  /// @brief Суммарный размер, ниже которого параллельные операции выполняются
+  /// последовательно
+  static constexpr size_type kParallelCutoff = 32768;
+  /// @brief Черная высота, начиная с которой подзадача отдается пулу (в
+  /// поддереве такой высоты не меньше 1023 узлов)
+  static constexpr size_type kParallelForkHeight = 10;
+
+  /**
+   * @brief Объединить дерево с другим, используя пул потоков
+   * @details Та же рекурсия, что в set_union, но объединение правых половин
+   * отдается пулу, пока оба поддерева не ниже kParallelForkHeight. Половины
+   * обрабатываются во временных деревьях-исполнителях с общим аллокатором и
+   * соединяются через корень. Для пула узлов и аллокаторов с состоянием, а
+   * также ниже kParallelCutoff, выполняется последовательный set_union
+   * @param other Добавляемое дерево
+   * @param pool Пул потоков
+   * @param combine Функтор объединения значений, вызывается из разных
+   * потоков. Не должен бросать исключений
+   */
+  template <typename Combine = KeepExistingValue>
+  void parallel_union(RBTree other, TaskPool& pool,
+                      Combine combine = Combine());
+
+  /**
+   * @brief Пересечь дерево с другим, используя пул потоков
+   * @param other Дерево ключей, которые нужно оставить
+   * @param pool Пул потоков
+   * @param combine Функтор объединения значений, вызывается из разных
+   * потоков. Не должен бросать исключений
+   */
+  template <typename Combine = KeepExistingValue>
+  void parallel_intersection(RBTree other, TaskPool& pool,
+                             Combine combine = Combine());
+
+  /**
+   * @brief Удалить из дерева ключи другого дерева, используя пул потоков
+   * @param other Дерево удаляемых ключей
+   * @param pool Пул потоков
+   */
+  void parallel_difference(RBTree other, TaskPool& pool);
+
+  /**
+   * @brief Вставить диапазон элементов, используя пул потоков
+   * @details Диапазон делится пополам до kParallelCutoff, части строятся
+   * параллельно через assign_sorted и попарно объединяются parallel_union.
+   * Как и при insert, ключи, уже имеющиеся в дереве, не меняются, а из
+   * повторов внутри диапазона остается первый
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   * @param pool Пул потоков
+   */
+  template <typename InputIt>
+  void parallel_insert(InputIt first, InputIt last, TaskPool& pool);
+
   // === Информационные методы ===
 
   bool empty() const noexcept;
   size_type size() const noexcept;
   size_type max_size() const noexcept;
 
+  /**
+   * @brief Получить аллокатор дерева
+   * @return Копия аллокатора элементов
+   */
+  allocator_type get_allocator() const noexcept;
+
+  /**
+   * @brief Получить компаратор ключей
+   * @return Копия компаратора
+   */
+  key_compare key_comp() const;
+
   // === Специальные итераторы для множества ===
 
   /**
@@ -245,19 +937,28 @@ class RBTree {
    */
   class SetIterator {
    public:
-    using pointer = RBTreeNode*;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Key*;
     using reference = Key&;
 
-    explicit SetIterator(pointer node = nullptr);
+    explicit SetIterator(RBTreeNode* node = nullptr);
     SetIterator(const SetIterator& other);
+    SetIterator& operator=(const SetIterator& other) = default;
 
     reference operator*() const;
+    pointer operator->() const { return &node_->data; }
     SetIterator& operator++();
+    SetIterator operator++(int);
+    SetIterator& operator--();
+    SetIterator operator--(int);
     bool operator==(const SetIterator& other) const;
     bool operator!=(const SetIterator& other) const;
+    std::ptrdiff_t operator-(const SetIterator& other) const;
 
    private:
-    pointer node_;
+    RBTreeNode* node_;
     friend class RBTree;
   };
 
@@ -266,20 +967,112 @@ class RBTree {
    */
   class SetConstIterator {
    public:
-    using pointer = const RBTreeNode*;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
     using reference = const Key&;
 
-    explicit SetConstIterator(pointer node = nullptr);
+    explicit SetConstIterator(const RBTreeNode* node = nullptr);
     SetConstIterator(const SetIterator& other);
 
     reference operator*() const;
+    pointer operator->() const { return &node_->data; }
     SetConstIterator& operator++();
+    SetConstIterator operator++(int);
+    SetConstIterator& operator--();
+    SetConstIterator operator--(int);
     bool operator==(const SetConstIterator& other) const;
     bool operator!=(const SetConstIterator& other) const;
+    std::ptrdiff_t operator-(const SetConstIterator& other) const;
+
+   private:
+    const RBTreeNode* node_;
+    friend class RBTree;
+  };
+
+  /**
+   * @brief Дескриптор извлеченного узла (аналог node_type из C++17)
+   * @details Владеет узлом, выделенным через аллокатор контейнера, и
+   * освобождает его в деструкторе. Ключ доступен только для чтения
+   */
+  class NodeHandle {
+   public:
+    using key_type = Key;                              ///< Тип ключа
+    using mapped_type = typename Traits::mapped_type;  ///< Тип значения
+    using value_type = typename Traits::value_type;    ///< Тип элемента
+    using allocator_type = Allocator;                  ///< Тип аллокатора
+
+    NodeHandle() noexcept = default;
+    NodeHandle(NodeHandle&& other) noexcept;
+    NodeHandle& operator=(NodeHandle&& other) noexcept;
+    ~NodeHandle() { reset(); }
+
+    /**
+     * @brief Пуст ли дескриптор
+     * @return true, если дескриптор не владеет узлом
+     */
+    bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+
+    /**
+     * @brief Аллокатор узла (дескриптор не должен быть пустым)
+     * @return Копия аллокатора
+     */
+    allocator_type get_allocator() const { return *alloc_; }
+
+    /**
+     * @brief Ключ элемента (дескриптор не должен быть пустым)
+     * @return Ссылка на ключ
+     */
+    const key_type& key() const noexcept { return node_->key(); }
+
+    /**
+     * @brief Значение элемента словаря (дескриптор не должен быть пустым)
+     * @return Ссылка на значение
+     */
+    template <typename V = Value,
+              typename = std::enable_if_t<!std::is_void_v<V>>>
+    mapped_type& mapped() const noexcept {
+      return node_->value();
+    }
+
+    /**
+     * @brief Элемент узла (дескриптор не должен быть пустым)
+     * @return Ссылка на элемент
+     */
+    value_type& value() const noexcept { return node_->data; }
+
+    /**
+     * @brief Обменять дескрипторы
+     * @param other Другой дескриптор
+     */
+    void swap(NodeHandle& other) noexcept;
 
    private:
-    pointer node_;
     friend class RBTree;
+
+    /**
+     * @brief Конструктор из отвязанного узла
+     * @param node Узел, выделенный через HeapNodeStorage
+     * @param alloc Аллокатор, которым выделен узел
+     */
+    NodeHandle(RBTreeNode* node, const allocator_type& alloc)
+        : node_(node), alloc_(alloc) {}
+
+    /**
+     * @brief Разрушить узел, если дескриптор им владеет
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Отказаться от владения узлом
+     * @return Узел
+     */
+    RBTreeNode* release() noexcept;
+
+    RBTreeNode* node_ = nullptr;           ///< Извлеченный узел
+    std::optional<allocator_type> alloc_;  ///< Аллокатор узла
   };
 
   // === Методы для работы с множеством ===
@@ -319,8 +1112,30 @@ class RBTree {
    */
   SetIterator set_find(const Key& key);
 
+  /**
+   * @brief Найти элемент множества по ключу, сравнимому с key
+   * @details Доступно только при прозрачном компараторе
+   * @param key Значение, сравнимое с ключами дерева
+   * @return Итератор множества на найденный элемент или set_end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SetIterator set_find(const K& key);
+
  protected:
   size_type tree_size;  ///< Количество узлов в дереве
+  key_compare comp_;    ///< Компаратор ключей
+  NodeStorage nodes_;   ///< Память узлов дерева
+
+  /**
+   * @brief Заголовок дерева, служит позицией end()
+   * @details parent указывает на корень, left и right - на минимальный и
+   * максимальный узлы, а родитель корня - сам заголовок. В пустом дереве left
+   * и right указывают на заголовок, поэтому begin() == end(). Заголовок
+   * красный: так декремент отличает его от всегда черного корня. Элемент
+   * заголовка никогда не создается
+   */
+  RBTreeNode header_{RED};
 
   // === Вспомогательные методы ===
 
@@ -339,21 +1154,84 @@ class RBTree {
   /**
    * @brief Исправить нарушения свойств красно-черного дерева после вставки
    * @param node Узел, с которого начинается исправление
+   * @return true, если черная высота дерева выросла на 1
+   */
+  bool insertFixup(RBTreeNode* node);
+
+  /**
+   * @brief Создать узел в памяти хранилища
+   * @param c Цвет узла
+   * @param args Аргументы, из которых элемент строится прямо в узле
+   * @return Указатель на новый узел
+   */
+  template <typename... Args>
+  RBTreeNode* createNode(Color c, Args&&... args);
+
+  /**
+   * @brief Разрушить узел и вернуть его память хранилищу
+   * @param node Удаляемый узел
+   */
+  void destroyNode(RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Элемент узла для построения нового узла
+   * @tparam Node RBTreeNode или const RBTreeNode
+   * @param node Узел: элемент константного копируется, изменяемого
+   * перемещается
    */
-  void insertFixup(RBTreeNode* node);
+  template <typename Node>
+  static decltype(auto) nodeData(Node* node) noexcept;
 
   /**
    * @brief Копировать узлы из одного дерева в другое
+   * @tparam Node const RBTreeNode для копирования элементов, RBTreeNode для
+   * их перемещения
    * @param dest Узел назначения
    * @param src Исходный узел
    */
-  void copyNodes(RBTreeNode* dest, RBTreeNode* src);
+  template <typename Node>
+  void copyNodes(RBTreeNode* dest, Node* src);
+
+  /**
+   * @brief Создать копию поддерева в хранилище текущего дерева
+   * @param src Корень копируемого поддерева (не nullptr)
+   * @return Корень копии, еще не подвешенный к заголовку
+   */
+  RBTreeNode* copySubtree(const RBTreeNode* src);
+
+  /**
+   * @brief Перенести элементы поддерева в новые узлы текущего дерева
+   * @param src Корень поддерева (не nullptr), элементы остаются перемещенными
+   * @return Корень нового поддерева, еще не подвешенный к заголовку
+   */
+  RBTreeNode* moveSubtree(RBTreeNode* src);
 
   /**
    * @brief Удалить поддерево
    * @param node Корень удаляемого поддерева
+   * @return Количество удаленных узлов
    */
-  void deleteSubtree(RBTreeNode* node);
+  size_type deleteSubtree(RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Удалить узел из дерева с восстановлением балансировки
+   * @param node Удаляемый узел
+   */
+  void eraseNode(RBTreeNode* node);
+
+  /**
+   * @brief Отцепить узел от дерева с восстановлением балансировки
+   * @details Узел не разрушается и остается во владении хранилища дерева
+   * @param node Отцепляемый узел
+   */
+  void unlinkNode(RBTreeNode* node);
+
+  /**
+   * @brief Заменить поддерево одного узла поддеревом другого
+   * @param u Заменяемый узел
+   * @param v Узел, занимающий место u (может быть nullptr)
+   */
+  void transplant(RBTreeNode* u, RBTreeNode* v);
 
   /**
    * @brief Исправить случай двойного черного узла при удалении
@@ -371,12 +1249,184 @@ class RBTree {
   void handleRedSiblingChild(RBTreeNode* parent, bool isLeftChild,
                              RBTreeNode* sibling);
 
+  /**
+   * @brief Вставить элемент, если ключа еще нет в дереве
+   * @param key Ключ вставляемого элемента
+   * @param args Аргументы, из которых элемент строится прямо в узле
+   * @return Пара из узла с ключом key и флага, был ли узел создан
+   * @details Выполняет единственный спуск от корня с одним сравнением на
+   * уровень
+   */
+  template <typename... Args>
+  std::pair<RBTreeNode*, bool> insertUnique(const Key& key, Args&&... args);
+
+  /**
+   * @brief Место для вставки ключа
+   */
+  struct InsertPosition {
+    RBTreeNode* parent;    ///< Будущий родитель (nullptr для пустого дерева)
+    bool toLeft;           ///< Подвесить левым потомком parent
+    RBTreeNode* existing;  ///< Узел с тем же ключом или nullptr
+  };
+
+  /**
+   * @brief Найти место для вставки ключа
+   * @param key Ключ
+   * @return Место вставки или узел с тем же ключом
+   * @details Один спуск от корня с одним сравнением на уровень
+   */
+  InsertPosition findInsertPosition(const Key& key) const;
+
+  /**
+   * @brief Найти место для вставки ключа по подсказке
+   * @param hint Узел, перед которым ожидается ключ (заголовок для end())
+   * @param key Ключ
+   * @return Место вставки или узел с тем же ключом
+   * @details Если ключ лежит между предшественником hint и самим hint,
+   * место находится за O(1) (с учетом амортизированного поиска соседа), иначе
+   * выполняется обычный спуск от корня
+   */
+  InsertPosition findHintPosition(const RBTreeNode* hint,
+                                  const Key& key) const;
+
+  /**
+   * @brief Вставка элемента по подсказке, если ключа еще нет в дереве
+   * @param hint Узел-подсказка (nullptr - без подсказки)
+   * @param key Ключ вставляемого элемента
+   * @param args Аргументы, из которых элемент строится прямо в узле
+   * @return Пара из узла с ключом key и флага, был ли узел создан
+   */
+  template <typename... Args>
+  std::pair<RBTreeNode*, bool> insertUniqueHint(const RBTreeNode* hint,
+                                                const Key& key,
+                                                Args&&... args);
+
+  /**
+   * @brief Построить элемент и вставить его по подсказке
+   * @param hint Узел-подсказка (nullptr - без подсказки)
+   * @param args Аргументы конструктора элемента
+   * @return Пара из узла с ключом элемента и флага, был ли узел вставлен
+   * @details Ключ известен только после построения элемента, поэтому узел
+   * создается заранее и разрушается, если ключ уже есть в дереве
+   */
+  template <typename... Args>
+  std::pair<RBTreeNode*, bool> emplaceUniqueHint(const RBTreeNode* hint,
+                                                 Args&&... args);
+
+  /**
+   * @brief Подвесить к дереву узел, ранее отвязанный от дерева
+   * @param node Узел
+   * @param position Место вставки из findInsertPosition
+   */
+  void relinkNode(RBTreeNode* node, InsertPosition position);
+
+  /**
+   * @brief Может ли дерево забрать узел дескриптора без копирования
+   * @param handle Непустой дескриптор
+   * @return true, если узел выделен совместимым аллокатором
+   */
+  bool adoptsNode(const NodeHandle& handle) const noexcept;
+
+  /**
+   * @brief Отвязать узел от дерева и передать его дескриптору
+   * @param node Узел дерева
+   * @return Дескриптор
+   * @details Узел пула разрушается, а элемент перемещается в узел,
+   * выделенный через аллокатор
+   */
+  NodeHandle makeHandle(RBTreeNode* node);
+
+  /**
+   * @brief Доступ к узлу итератора множества
+   * @param it Итератор множества
+   * @return Узел итератора
+   */
+  static RBTreeNode* nodeOf(const SetConstIterator& it) noexcept {
+    return const_cast<RBTreeNode*>(it.node_);
+  }
+
+  /**
+   * @brief Устойчиво отсортировать список узлов, связанных через right
+   * @param head Первый узел списка
+   * @param n Длина списка
+   * @return Первый узел отсортированного списка
+   */
+  RBTreeNode* sortNodeList(RBTreeNode* head, size_type n);
+
+  /**
+   * @brief Построить сбалансированное поддерево из отсортированного списка
+   * @param list Список узлов, связанных через right, сдвигается на n узлов
+   * @param n Количество узлов поддерева
+   * @param depth Глубина корня поддерева
+   * @param redDepth Глубина неполного последнего уровня, его узлы красные
+   * @return Корень поддерева
+   */
+  RBTreeNode* buildBalanced(RBTreeNode*& list, size_type n, size_type depth,
+                            size_type redDepth);
+
+  /**
+   * @brief Подвесить новый узел к дереву и восстановить балансировку
+   * @param node Новый узел
+   * @param parent Будущий родитель (nullptr для пустого дерева)
+   * @param toLeft Подвесить узел левым потомком parent
+   */
+  void linkNode(RBTreeNode* node, RBTreeNode* parent, bool toLeft);
+
   /**
    * @brief Найти узел по ключу
+   * @details На каждом уровне выполняется одно сравнение, равенство
+   * проверяется один раз в конце спуска
+   * @tparam K Key или тип, сравнимый с Key прозрачным компаратором
    * @param key Ключ для поиска
    * @return Указатель на найденный узел или nullptr
    */
-  RBTreeNode* findNode(const Key& key) const;
+  template <typename K>
+  RBTreeNode* findNode(const K& key) const;
+
+  /**
+   * @brief Найти первый узел с ключом не меньше key
+   * @tparam K Key или тип, сравнимый с Key прозрачным компаратором
+   * @param key Ключ
+   * @return Узел или заголовок, если все ключи меньше key
+   */
+  template <typename K>
+  RBTreeNode* lowerBoundNode(const K& key) const;
+
+  /**
+   * @brief Найти узлы для последовательности ключей пакетами
+   * @details Спуски группы из kLookupBatch ключей продвигаются по одному
+   * уровню за проход с prefetch следующего узла. Группа завершается, когда
+   * закончены все ее спуски, поэтому результаты выдаются в порядке ключей
+   * @param first Начало последовательности ключей
+   * @param last Конец последовательности ключей
+   * @param visit Функтор, получающий найденный узел или nullptr
+   */
+  template <typename ForwardIt, typename Visit>
+  void findNodes(ForwardIt first, ForwardIt last, Visit&& visit) const;
+
+  /**
+   * @brief Запросить узел в кеш заранее
+   * @param node Узел (nullptr допустим)
+   */
+  static void prefetchNode(const RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Найти первый узел с ключом больше key
+   * @tparam K Key или тип, сравнимый с Key прозрачным компаратором
+   * @param key Ключ
+   * @return Узел или заголовок, если нет ключей больше key
+   */
+  template <typename K>
+  RBTreeNode* upperBoundNode(const K& key) const;
+
+  /**
+   * @brief Диапазон узлов с ключом, эквивалентным key
+   * @tparam K Key или тип, сравнимый с Key прозрачным компаратором
+   * @param key Ключ
+   * @return Пара из первого узла диапазона и узла за ним
+   */
+  template <typename K>
+  std::pair<RBTreeNode*, RBTreeNode*> equalRangeNodes(const K& key) const;
 
   /**
    * @brief Получить корень дерева
@@ -384,6 +1434,301 @@ class RBTree {
    */
   RBTreeNode* GetRoot() const;
 
+  /**
+   * @brief Получить заголовок дерева
+   * @return Указатель на заголовок (позиция end())
+   */
+  RBTreeNode* GetHeader() const noexcept;
+
+  /**
+   * @brief Сделать заголовок заголовком пустого дерева
+   */
+  void resetHeader() noexcept;
+
+  /**
+   * @brief Подвесить готовое дерево к заголовку
+   * @param node Новый корень (nullptr для пустого дерева)
+   * @param leftmost Минимальный узел дерева
+   * @param rightmost Максимальный узел дерева
+   */
+  void attachRoot(RBTreeNode* node, RBTreeNode* leftmost,
+                  RBTreeNode* rightmost) noexcept;
+
+  /**
+   * @brief Сделать узел корнем, не трогая минимум и максимум в заголовке
+   * @param node Новый корень
+   */
+  void hangRoot(RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Связать соседние в порядке ключей узлы (при Policy::threaded)
+   * @param before Меньший узел или заголовок
+   * @param after Следующий за ним узел или заголовок
+   */
+  static void linkThreads(RBTreeNode* before, RBTreeNode* after) noexcept;
+
+  /**
+   * @brief Прошить все узлы поддерева (при Policy::threaded)
+   * @param top Корень поддерева (может быть nullptr)
+   * @details Крайние узлы поддерева остаются без соседей снаружи, их
+   * связывает attachRoot или joinNodes
+   */
+  static void threadNodes(RBTreeNode* top) noexcept;
+
+  /**
+   * @brief Следующий узел в порядке возрастания ключей
+   * @param node Текущий узел (не заголовок)
+   * @return Следующий узел или заголовок после максимального узла
+   * @details В прошитом дереве - одно чтение указателя
+   */
+  static const RBTreeNode* nextNode(const RBTreeNode* node) noexcept;
+  static RBTreeNode* nextNode(RBTreeNode* node) noexcept {
+    return const_cast<RBTreeNode*>(
+        nextNode(static_cast<const RBTreeNode*>(node)));
+  }
+
+  /**
+   * @brief Предыдущий узел в порядке возрастания ключей
+   * @param node Текущий узел или заголовок
+   * @return Предыдущий узел, для заголовка - максимальный узел
+   */
+  static const RBTreeNode* prevNode(const RBTreeNode* node) noexcept;
+  static RBTreeNode* prevNode(RBTreeNode* node) noexcept {
+    return const_cast<RBTreeNode*>(
+        prevNode(static_cast<const RBTreeNode*>(node)));
+  }
+
+  /**
+   * @brief Вес поддерева
+   * @param node Корень поддерева (может быть nullptr)
+   * @return Суммарный вес элементов поддерева, 0 без порядковой статистики
+   */
+  static size_type subtreeWeight(const RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Пересчитать вес поддерева узла по его потомкам
+   * @param node Узел с корректными весами потомков
+   */
+  static void updateWeight(RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Пересчитать веса на пути от узла до корня
+   * @param node Нижний измененный узел
+   */
+  void updateWeightsToRoot(RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Позиция узла в порядке обхода
+   * @param node Узел или заголовок дерева
+   * @return Суммарный вес элементов перед узлом, для заголовка - вес дерева
+   */
+  static size_type indexOf(const RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Найти узел, содержащий k-й по порядку элемент
+   * @param k Номер элемента, начиная с 0
+   * @return Узел или заголовок, если k не меньше веса дерева
+   */
+  RBTreeNode* selectNode(size_type k) const noexcept;
+
+  /**
+   * @brief Поддерево, отделенное от дерева при split и join
+   */
+  struct Subtree {
+    RBTreeNode* root;  ///< Корень поддерева (nullptr для пустого)
+    size_type height;  ///< Черная высота поддерева
+  };
+
+  /**
+   * @brief Черная высота поддерева
+   * @param node Корень поддерева
+   * @return Число черных узлов на пути от node до листа
+   */
+  static size_type blackHeight(const RBTreeNode* node) noexcept;
+
+  /**
+   * @brief Соединить два поддерева через опорный узел
+   * @details Корень и заголовок дерева служат рабочим местом, поэтому до
+   * вызова дерево не должно содержать других узлов
+   * @param left Поддерево с меньшими ключами
+   * @param pivot Опорный узел
+   * @param right Поддерево с большими ключами
+   * @return Получившееся поддерево, подвешенное к заголовку
+   */
+  Subtree joinNodes(Subtree left, RBTreeNode* pivot, Subtree right);
+
+  /**
+   * @brief Разделить дерево по ключу в пустое дерево right
+   * @param key Граница разделения
+   * @param right Пустое дерево, получающее ключи не меньше key
+   */
+  void splitInto(const Key& key, RBTree& right);
+
+  /**
+   * @brief Части поддерева после разделения по ключу
+   */
+  struct SplitParts {
+    Subtree less;       ///< Узлы с меньшими ключами
+    RBTreeNode* equal;  ///< Узел с ключом, равным границе, или nullptr
+    Subtree greater;    ///< Узлы с большими ключами
+  };
+
+  /**
+   * @brief Разделить поддерево по ключу
+   * @details Путь поиска key разбирается снизу вверх: узел пути вместе с
+   * поддеревом, в которое поиск не пошел, присоединяется к накопленной
+   * меньшей или большей части. Работает за O(log n)
+   * @param tree Разделяемое поддерево
+   * @param key Граница разделения
+   * @return Меньшая часть, узел с ключом key и большая часть
+   */
+  SplitParts splitNodes(Subtree tree, const Key& key);
+
+  /**
+   * @brief Соединить два поддерева без опорного узла
+   * @details Опорным становится максимальный узел левого поддерева
+   * @param left Поддерево с меньшими ключами
+   * @param right Поддерево с большими ключами
+   * @return Получившееся поддерево
+   */
+  Subtree joinNodes(Subtree left, Subtree right);
+
+  /**
+   * @brief Поддерево потомка узла-корня поддерева
+   * @param parent Поддерево
+   * @param child Левый или правый потомок его корня
+   * @return Поддерево потомка с его черной высотой
+   */
+  static Subtree childSubtree(Subtree parent, RBTreeNode* child) noexcept;
+
+  /**
+   * @brief Объединить узлы двух поддеревьев
+   * @param mine Поддерево текущего дерева, его узлы остаются при совпадении
+   * @param theirs Поддерево добавляемых узлов
+   * @param combine Функтор объединения значений
+   * @param duplicates Счетчик совпавших ключей
+   * @return Объединенное поддерево
+   */
+  template <typename Combine>
+  Subtree unionNodes(Subtree mine, Subtree theirs, Combine& combine,
+                     size_type& duplicates);
+
+  /**
+   * @brief Пересечь узлы двух поддеревьев
+   * @param mine Поддерево текущего дерева
+   * @param theirs Поддерево ключей, которые нужно оставить, удаляется
+   * @param combine Функтор объединения значений
+   * @param kept Счетчик оставшихся узлов
+   * @return Пересечение
+   */
+  template <typename Combine>
+  Subtree intersectNodes(Subtree mine, Subtree theirs, Combine& combine,
+                         size_type& kept);
+
+  /**
+   * @brief Удалить из поддерева ключи другого поддерева
+   * @param mine Поддерево текущего дерева
+   * @param theirs Поддерево удаляемых ключей, удаляется
+   * @param removed Счетчик удаленных узлов
+   * @return Разность
+   */
+  Subtree differenceNodes(Subtree mine, Subtree theirs, size_type& removed);
+
+  /// @brief Можно ли передавать узлы между деревьями-исполнителями: узлы
+  /// пула принадлежат одному дереву, а аллокатор с состоянием может быть не
+  /// готов к работе из нескольких потоков
+  static constexpr bool kParallelNodes =
+      !Policy::pooled_nodes &&
+      std::allocator_traits<Allocator>::is_always_equal::value;
+
+  /**
+   * @brief Стоит ли отдавать пулу подзадачу над двумя поддеревьями
+   * @param first Первое поддерево
+   * @param second Второе поддерево
+   * @return true, если оба поддерева не ниже kParallelForkHeight
+   */
+  static bool shouldFork(Subtree first, Subtree second) noexcept;
+
+  /**
+   * @brief Отпустить узлы дерева-исполнителя, не удаляя их
+   * @details Узлы к этому моменту уже принадлежат результату подзадачи
+   */
+  void releaseNodes() noexcept;
+
+  /**
+   * @brief Параллельное объединение узлов двух поддеревьев
+   * @param mine Поддерево текущего дерева
+   * @param theirs Поддерево добавляемых узлов
+   * @param combine Функтор объединения значений
+   * @param duplicates Счетчик совпавших ключей
+   * @param pool Пул потоков
+   * @return Объединенное поддерево
+   */
+  template <typename Combine>
+  Subtree parallelUnionNodes(Subtree mine, Subtree theirs, Combine& combine,
+                             size_type& duplicates, TaskPool& pool);
+
+  /**
+   * @brief Параллельное пересечение узлов двух поддеревьев
+   * @param mine Поддерево текущего дерева
+   * @param theirs Поддерево ключей, которые нужно оставить
+   * @param combine Функтор объединения значений
+   * @param kept Счетчик оставшихся узлов
+   * @param pool Пул потоков
+   * @return Пересечение
+   */
+  template <typename Combine>
+  Subtree parallelIntersectNodes(Subtree mine, Subtree theirs,
+                                 Combine& combine, size_type& kept,
+                                 TaskPool& pool);
+
+  /**
+   * @brief Параллельная разность узлов двух поддеревьев
+   * @param mine Поддерево текущего дерева
+   * @param theirs Поддерево удаляемых ключей
+   * @param removed Счетчик удаленных узлов
+   * @param pool Пул потоков
+   * @return Разность
+   */
+  Subtree parallelDifferenceNodes(Subtree mine, Subtree theirs,
+                                  size_type& removed, TaskPool& pool);
+
+  /**
+   * @brief Построить дерево из диапазона, деля его между потоками пула
+   * @param first Начало диапазона
+   * @param count Число элементов
+   * @param pool Пул потоков
+   * @return Дерево с компаратором и аллокатором текущего
+   */
+  template <typename RandomIt>
+  RBTree buildParallel(RandomIt first, size_type count, TaskPool& pool) const;
+
+  /**
+   * @brief Записать в узел дерева результат объединения значений
+   * @param ours Остающийся узел
+   * @param theirs Совпавший узел другого дерева
+   * @param combine Функтор объединения значений
+   */
+  template <typename Combine>
+  static void combineValues(RBTreeNode* ours, const RBTreeNode* theirs,
+                            Combine& combine);
+
+  /**
+   * @brief Может ли дерево забрать узлы другого дерева без копирования
+   * @param other Другое дерево
+   * @return true, если узлы выделены совместимым хранилищем
+   */
+  bool sharesNodeStorage(const RBTree& other) const noexcept;
+
+  /**
+   * @brief Забрать все узлы другого дерева
+   * @details Узлы переходят без копирования, если хранилища совместимы,
+   * иначе элементы перемещаются в новые узлы хранилища текущего дерева
+   * @param other Дерево, становится пустым
+   * @return Корень полученного поддерева
+   */
+  RBTreeNode* takeNodes(RBTree& other);
+
   /**
    * @brief Получить узел с минимальным ключом в поддереве
    * @param node Корень поддерева
@@ -399,29 +1744,11 @@ class RBTree {
   RBTreeNode* GetMax(RBTreeNode* node) const;
 
   /**
-   * @brief Рекурсивно вставить узел в дерево
-   * @param node Текущий узел
-   * @param key Ключ для вставки
-   * @param value Значение для вставки
-   * @return true если вставка успешна, false если узел с таким ключом уже
-   * существует
-   */
-  bool RecursiveInsert(RBTreeNode* node, const Key& key, const Value& value);
-
-  /**
-   * @brief Рекурсивно удалить узел
+   * @brief Удалить узел вместе с поддеревом и уменьшить размер дерева
    * @param node Узел для удаления
    */
   void RecursiveDelete(RBTreeNode* node);
 
-  /**
-   * @brief Рекурсивно удалить узел по ключу
-   * @param node Текущий узел
-   * @param key Ключ для удаления
-   * @return Указатель на новый корень поддерева
-   */
-  RBTreeNode* RecursiveDelete(RBTreeNode* node, const Key& key);
-
   friend class RBTreeTest;  ///< Для доступа к защищенным членам в тестах
 };
 
@@ -433,6 +1760,11 @@ class RBTree {
 #include "tree_operations.tpp"
 #include "tree_constructors.tpp"
 #include "tree_utility.tpp"
+#include "tree_statistics.tpp"
+#include "tree_join.tpp"
+#include "tree_node_handle.tpp"
+#include "tree_set_algebra.tpp"
+#include "tree_batch_lookup.tpp"
 // clang-format on
 
 #endif  // TREE_H
@@ -0,0 +1,131 @@
+/**
+ * @file tree_batch_lookup.tpp
+ * @brief Реализация пакетного поиска для класса RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Найти элементы для последовательности ключей
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt RBTree<Key, Value, Compare, Allocator, Policy>::find_many(
+    ForwardIt first, ForwardIt last, OutputIt out) {
+  findNodes(first, last, [&](RBTreeNode* node) {
+    *out++ = node ? Iterator(node) : end();
+  });
+  return out;
+}
+
+/**
+ * @brief Найти элементы для последовательности ключей (константный)
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода константных итераторов
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt RBTree<Key, Value, Compare, Allocator, Policy>::find_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  findNodes(first, last, [&](RBTreeNode* node) {
+    *out++ = node ? ConstIterator(node) : end();
+  });
+  return out;
+}
+
+/**
+ * @brief Проверить наличие последовательности ключей
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param out Начало вывода bool
+ * @return Итератор вывода за последним записанным результатом
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename OutputIt>
+OutputIt RBTree<Key, Value, Compare, Allocator, Policy>::contains_many(
+    ForwardIt first, ForwardIt last, OutputIt out) const {
+  findNodes(first, last, [&](RBTreeNode* node) { *out++ = node != nullptr; });
+  return out;
+}
+
+/**
+ * @brief Найти узлы для последовательности ключей пакетами
+ * @param first Начало последовательности ключей
+ * @param last Конец последовательности ключей
+ * @param visit Функтор, получающий найденный узел или nullptr
+ * @details Каждый спуск - тот же lowerBoundNode с одним сравнением на
+ * уровень. Высота красно-черного дерева различается для разных ключей не
+ * более чем вдвое, поэтому ожидание самого длинного спуска группы почти
+ * не стоит проходов вхолостую
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename ForwardIt, typename Visit>
+void RBTree<Key, Value, Compare, Allocator, Policy>::findNodes(
+    ForwardIt first, ForwardIt last, Visit&& visit) const {
+  struct Probe {
+    ForwardIt key;        ///< Искомый ключ
+    RBTreeNode* current;  ///< Следующий узел спуска
+    RBTreeNode* notLess;  ///< Последний узел с ключом не меньше искомого
+  };
+  Probe probes[kLookupBatch];
+
+  while (first != last) {
+    size_type count = 0;
+    for (; count < kLookupBatch && first != last; ++count, ++first) {
+      probes[count] = {first, root, GetHeader()};
+    }
+
+    bool active = root != nullptr;
+    while (active) {
+      active = false;
+      for (size_type i = 0; i < count; ++i) {
+        Probe& probe = probes[i];
+        if (probe.current == nullptr) continue;
+        if (comp_(probe.current->key(), *probe.key)) {
+          probe.current = probe.current->right;
+        } else {
+          probe.notLess = probe.current;
+          probe.current = probe.current->left;
+        }
+        if (probe.current != nullptr) {
+          prefetchNode(probe.current);
+          active = true;
+        }
+      }
+    }
+
+    for (size_type i = 0; i < count; ++i) {
+      RBTreeNode* found = probes[i].notLess;
+      bool equal = found != &header_ && !comp_(*probes[i].key, found->key());
+      visit(equal ? found : nullptr);
+    }
+  }
+}
+
+/**
+ * @brief Запросить узел в кеш заранее
+ * @param node Узел (nullptr допустим)
+ * @details Без поддержки компилятора ничего не делает
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::prefetchNode(
+    const RBTreeNode* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(node);
+#else
+  (void)node;
+#endif
+}
+
+}  // namespace s21
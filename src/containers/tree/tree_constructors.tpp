@@ -16,32 +16,85 @@ namespace s21 {
  * @brief Конструктор по умолчанию.
  * @details Инициализирует пустое дерево.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree() : root(nullptr), tree_size(0) {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree()
+    : root(nullptr), tree_size(0) {
+  resetHeader();
+}
+
+/**
+ * @brief Конструктор с аллокатором.
+ * @param alloc Аллокатор, из которого выделяются узлы дерева.
+ * @details Инициализирует пустое дерево.
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    const allocator_type& alloc)
+    : root(nullptr), tree_size(0), comp_(), nodes_(alloc) {
+  resetHeader();
+}
+
+/**
+ * @brief Конструктор с компаратором.
+ * @param comp Компаратор ключей.
+ * @param alloc Аллокатор, из которого выделяются узлы дерева.
+ * @details Инициализирует пустое дерево.
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    const key_compare& comp, const allocator_type& alloc)
+    : root(nullptr), tree_size(0), comp_(comp), nodes_(alloc) {
+  resetHeader();
+}
 
 /**
  * @brief Конструктор с инициализатором списка.
  * @param items Список пар ключ-значение для вставки.
  * @details Создает дерево и вставляет в него элементы из списка.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(std::initializer_list<value_type> const& items)
-    : RBTree() {
-  for (const auto& item : items) {
-    insert(item.first, item.second);
-  }
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    std::initializer_list<value_type> const& items)
+    : RBTree(items.begin(), items.end()) {}
+
+/**
+ * @brief Конструктор из диапазона.
+ * @param first Начало диапазона.
+ * @param last Конец диапазона.
+ * @param comp Компаратор ключей.
+ * @param alloc Аллокатор, из которого выделяются узлы дерева.
+ * @details Строит дерево через assign_sorted: за O(n) для отсортированного
+ * диапазона и за O(n log n) для произвольного.
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename InputIt>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    InputIt first, InputIt last, const key_compare& comp,
+    const allocator_type& alloc)
+    : RBTree(comp, alloc) {
+  assign_sorted(first, last);
 }
 
 /**
  * @brief Конструктор копирования.
  * @param t Дерево для копирования.
- * @details Создает копию переданного дерева.
+ * @details Создает копию переданного дерева. Аллокатор выбирается через
+ * select_on_container_copy_construction.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(const RBTree& t) : RBTree() {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(const RBTree& t)
+    : RBTree(t.comp_,
+             std::allocator_traits<Allocator>::
+                 select_on_container_copy_construction(t.get_allocator())) {
   if (t.root != nullptr) {
-    root = new RBTreeNode(t.root->key, t.root->value, t.root->color);
-    copyNodes(root, t.root);
+    RBTreeNode* copy = copySubtree(t.root);
+    attachRoot(copy, GetMin(copy), GetMax(copy));
     tree_size = t.tree_size;
   }
 }
@@ -49,64 +102,123 @@ RBTree<Key, Value>::RBTree(const RBTree& t) : RBTree() {
 /**
  * @brief Конструктор перемещения.
  * @param t Дерево для перемещения.
- * @details Перемещает данные из переданного дерева в новое дерево.
+ * @details Перемещает данные из переданного дерева в новое дерево. Узлы
+ * подвешиваются к заголовку нового дерева.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTree(RBTree&& t) noexcept
-    : root(t.root), tree_size(t.tree_size) {
-  t.root = nullptr;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(RBTree&& t) noexcept
+    : root(nullptr),
+      tree_size(t.tree_size),
+      comp_(t.comp_),
+      nodes_(std::move(t.nodes_)) {
+  attachRoot(t.root, t.header_.left, t.header_.right);
+  t.attachRoot(nullptr, nullptr, nullptr);
   t.tree_size = 0;
 }
 
 /**
- * @brief Деструктор.
- * @details Удаляет все узлы дерева и освобождает память.
+ * @brief Конструктор копирования с аллокатором.
+ * @param t Дерево для копирования.
+ * @param alloc Аллокатор, из которого выделяются узлы копии.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::~RBTree() {
-  if (root != nullptr) {
-    RecursiveDelete(root);
-    root = nullptr;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    const RBTree& t, const allocator_type& alloc)
+    : RBTree(t.comp_, alloc) {
+  if (t.root != nullptr) {
+    RBTreeNode* copy = copySubtree(t.root);
+    attachRoot(copy, GetMin(copy), GetMax(copy));
+    tree_size = t.tree_size;
   }
 }
 
 /**
- * @brief Рекурсивное удаление узлов.
- * @param node Узел для удаления.
- * @details Удаляет все узлы, начиная с указанного.
+ * @brief Конструктор перемещения с аллокатором.
+ * @param t Дерево для перемещения.
+ * @param alloc Аллокатор, из которого выделяются узлы дерева.
+ * @details Узлы t переходят без копирования, если их освободит alloc: пула
+ * нет и аллокаторы равны. Иначе элементы перемещаются в новые узлы.
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::RecursiveDelete(RBTreeNode* node) {
-  if (node == nullptr) return;
-
-  if (node->left) {
-    RecursiveDelete(node->left);
-    node->left = nullptr;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTree(
+    RBTree&& t, const allocator_type& alloc)
+    : RBTree(t.comp_, alloc) {
+  if (t.root == nullptr) return;
+  if (!Policy::pooled_nodes &&
+      (std::allocator_traits<Allocator>::is_always_equal::value ||
+       get_allocator() == t.get_allocator())) {
+    attachRoot(t.root, t.header_.left, t.header_.right);
+    tree_size = std::exchange(t.tree_size, 0);
+    t.attachRoot(nullptr, nullptr, nullptr);
+  } else {
+    RBTreeNode* moved = moveSubtree(t.root);
+    attachRoot(moved, GetMin(moved), GetMax(moved));
+    tree_size = t.tree_size;
+    t.clear();
   }
+}
 
-  if (node->right) {
-    RecursiveDelete(node->right);
-    node->right = nullptr;
-  }
+/**
+ * @brief Деструктор.
+ * @details Удаляет все узлы дерева и освобождает память.
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::~RBTree() {
+  clear();
+}
 
-  node->parent = nullptr;
-  delete node;
-  --tree_size;
+/**
+ * @brief Удаление узла вместе с поддеревом.
+ * @param node Узел для удаления.
+ * @details Удаляет все узлы, начиная с указанного, без рекурсии (см.
+ * deleteSubtree) и уменьшает размер дерева на их число.
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::RecursiveDelete(
+    RBTreeNode* node) {
+  tree_size -= deleteSubtree(node);
 }
 
 /**
  * @brief Оператор присваивания перемещением.
  * @param t Дерево для перемещения.
  * @return Ссылка на текущее дерево.
- * @details Перемещает данные из переданного дерева в текущее дерево.
+ * @details Перемещает данные из переданного дерева в текущее дерево. Если
+ * аллокатор не переносится и не равен аллокатору t, узлы нельзя забрать:
+ * элементы перемещаются в новые узлы в памяти текущего дерева.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>& RBTree<Key, Value>::operator=(RBTree&& t) noexcept {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>&
+RBTree<Key, Value, Compare, Allocator, Policy>::operator=(RBTree&& t) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+  using AllocTraits = std::allocator_traits<Allocator>;
   if (this != &t) {
     clear();
-    root = t.root;
+    comp_ = t.comp_;
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+                  !AllocTraits::is_always_equal::value) {
+      if (get_allocator() != t.get_allocator()) {
+        if (t.root != nullptr) {
+          RBTreeNode* moved = moveSubtree(t.root);
+          attachRoot(moved, GetMin(moved), GetMax(moved));
+          tree_size = t.tree_size;
+          t.clear();
+        }
+        return *this;
+      }
+    }
+    attachRoot(t.root, t.header_.left, t.header_.right);
     tree_size = t.tree_size;
-    t.root = nullptr;
+    nodes_ = std::move(t.nodes_);
+    t.attachRoot(nullptr, nullptr, nullptr);
     t.tree_size = 0;
   }
   return *this;
@@ -118,14 +230,20 @@ RBTree<Key, Value>& RBTree<Key, Value>::operator=(RBTree&& t) noexcept {
  * @return Ссылка на текущее дерево.
  * @details Копирует данные из переданного дерева в текущее дерево.
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>& RBTree<Key, Value>::operator=(const RBTree& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>&
+RBTree<Key, Value, Compare, Allocator, Policy>::operator=(const RBTree& other) {
   if (this != &other) {
     clear();
+    comp_ = other.comp_;
+    if constexpr (std::allocator_traits<Allocator>::
+                      propagate_on_container_copy_assignment::value) {
+      nodes_.set_allocator(other.nodes_.get_allocator());
+    }
     if (other.root != nullptr) {
-      root =
-          new RBTreeNode(other.root->key, other.root->value, other.root->color);
-      copyNodes(root, other.root);
+      RBTreeNode* copy = copySubtree(other.root);
+      attachRoot(copy, GetMin(copy), GetMax(copy));
       tree_size = other.tree_size;
     }
   }
@@ -137,20 +255,24 @@ RBTree<Key, Value>& RBTree<Key, Value>::operator=(const RBTree& other) {
  * @return Константный итератор.
  * @details Возвращает итератор на минимальный элемент дерева.
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::ConstIterator RBTree<Key, Value>::cbegin() const {
-  return ConstIterator(GetMin(root));
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::cbegin() const {
+  return ConstIterator(header_.left);
 }
 
 /**
  * @brief Получить константный итератор на конец дерева.
  * @return Константный итератор.
- * @details Возвращает итератор на элемент, следующий за последним элементом
- * дерева.
+ * @details Возвращает итератор на заголовок дерева, следующий за последним
+ * элементом.
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::ConstIterator RBTree<Key, Value>::cend() const {
-  return ConstIterator(nullptr);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::cend() const {
+  return ConstIterator(GetHeader());
 }
 
 }  // namespace s21
@@ -9,34 +9,99 @@ namespace s21 {
  * @brief Конструктор итератора по умолчанию
  * @details Создает итератор, указывающий на nullptr
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::Iterator::Iterator()
-    : iter_node_(nullptr), past_node_(nullptr) {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::Iterator()
+    : iter_node_(nullptr) {}
 
 /**
  * @brief Конструктор итератора
- * @param node Текущий узел
- * @param past Узел после последнего
+ * @param node Текущий узел или заголовок дерева
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::Iterator::Iterator(RBTreeNode *node, RBTreeNode *past)
-    : iter_node_(node), past_node_(past) {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::Iterator(
+    RBTreeNode *node)
+    : iter_node_(node) {}
+
+/**
+ * @brief Следующий узел в порядке возрастания ключей
+ * @param node Текущий узел
+ * @return Следующий узел или заголовок
+ * @details Если правого поддерева нет, подъем идет, пока узел остается правым
+ * потомком. Родитель корня - заголовок, поэтому подъем от максимального узла
+ * заканчивается на заголовке без проверок на nullptr. Последнее условие
+ * отличает дерево, где корень сам максимальный: тогда подъем проходит через
+ * заголовок и возвращается к корню. Прошитому дереву подъем не нужен
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+const typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode *
+RBTree<Key, Value, Compare, Allocator, Policy>::nextNode(
+    const RBTreeNode *node) noexcept {
+  if constexpr (Policy::threaded) return node->next;
+  if (node->right != nullptr) {
+    node = node->right;
+    while (node->left != nullptr) node = node->left;
+    return node;
+  }
+  const RBTreeNode *parent = node->getParent();
+  while (node == parent->right) {
+    node = parent;
+    parent = parent->getParent();
+  }
+  return node->right != parent ? parent : node;
+}
+
+/**
+ * @brief Предыдущий узел в порядке возрастания ключей
+ * @param node Текущий узел или заголовок
+ * @return Предыдущий узел
+ * @details Заголовок - единственный красный узел, чей дед - он сам, для него
+ * результатом служит максимальный узел из заголовка. В прошитом дереве
+ * предыдущий узел заголовка - тоже максимальный
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+const typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode *
+RBTree<Key, Value, Compare, Allocator, Policy>::prevNode(
+    const RBTreeNode *node) noexcept {
+  if constexpr (Policy::threaded) return node->prev;
+  if (node->getColor() == RED && node->getParent()->getParent() == node) {
+    return node->right;
+  }
+  if (node->left != nullptr) {
+    node = node->left;
+    while (node->right != nullptr) node = node->right;
+    return node;
+  }
+  const RBTreeNode *parent = node->getParent();
+  while (node == parent->left) {
+    node = parent;
+    parent = parent->getParent();
+  }
+  return parent;
+}
 
 /**
  * @brief Конструктор константного итератора по умолчанию
  * @details Создает константный итератор, вызывая конструктор базового класса
  * Iterator
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::ConstIterator::ConstIterator() : Iterator() {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::ConstIterator()
+    : Iterator() {}
 
 /**
  * @brief Конструктор константного итератора
  * @param node Текущий узел
  * @details Создает константный итератор для указанного узла
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::ConstIterator::ConstIterator(RBTreeNode *node)
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::ConstIterator(
+    RBTreeNode *node)
     : Iterator(node) {}
 
 /**
@@ -44,24 +109,25 @@ RBTree<Key, Value>::ConstIterator::ConstIterator(RBTreeNode *node)
  * @return Ссылка на итератор
  * @details Перемещает итератор к следующему узлу в порядке возрастания ключей
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator &
-RBTree<Key, Value>::Iterator::operator++() {
-  if (iter_node_ == nullptr) return *this;
-
-  if (iter_node_->right != nullptr) {
-    iter_node_ = iter_node_->right;
-    while (iter_node_->left != nullptr) {
-      iter_node_ = iter_node_->left;
-    }
-  } else {
-    RBTreeNode *parent = iter_node_->parent;
-    while (parent != nullptr && iter_node_ == parent->right) {
-      iter_node_ = parent;
-      parent = parent->parent;
-    }
-    iter_node_ = parent;
-  }
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator++() {
+  iter_node_ = nextNode(iter_node_);
+  return *this;
+}
+
+/**
+ * @brief Оператор декремента префиксный
+ * @return Ссылка на итератор
+ * @details Перемещает итератор к предыдущему узлу, из end() - к последнему
+ * элементу
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator--() {
+  iter_node_ = prevNode(iter_node_);
   return *this;
 }
 
@@ -70,8 +136,10 @@ RBTree<Key, Value>::Iterator::operator++() {
  * @param other Другой итератор для сравнения
  * @return true если итераторы указывают на разные узлы, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::Iterator::operator!=(const Iterator &other) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator!=(
+    const Iterator &other) const {
   return iter_node_ != other.iter_node_;
 }
 
@@ -80,8 +148,10 @@ bool RBTree<Key, Value>::Iterator::operator!=(const Iterator &other) const {
  * @param other Другой итератор для сравнения
  * @return true если итераторы указывают на один и тот же узел, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::Iterator::operator==(const Iterator &other) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator==(
+    const Iterator &other) const {
   return iter_node_ == other.iter_node_;
 }
 
@@ -89,10 +159,11 @@ bool RBTree<Key, Value>::Iterator::operator==(const Iterator &other) const {
  * @brief Оператор разыменования
  * @return Ссылка на пару ключ-значение текущего узла
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator::reference
-RBTree<Key, Value>::Iterator::operator*() const {
-  return iter_node_->pair;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::reference
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator*() const {
+  return iter_node_->data;
 }
 
 /**
@@ -101,69 +172,156 @@ RBTree<Key, Value>::Iterator::operator*() const {
  * @details Создает копию текущего итератора, затем перемещает текущий итератор
  * вперед
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator RBTree<Key, Value>::Iterator::operator++(
-    int) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator++(int) {
   Iterator temp = *this;
   ++(*this);
   return temp;
 }
 
+/**
+ * @brief Оператор декремента постфиксный
+ * @return Копия итератора до декремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator--(int) {
+  Iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
 /**
  * @brief Получить итератор на начало дерева
  * @return Итератор, указывающий на узел с минимальным ключом
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator RBTree<Key, Value>::begin() {
-  return Iterator(GetMin(root), nullptr);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::begin() {
+  return Iterator(header_.left);
 }
 
 /**
  * @brief Получить итератор на конец дерева
- * @return Итератор, указывающий на позицию после последнего элемента (nullptr)
+ * @return Итератор, указывающий на заголовок дерева
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator RBTree<Key, Value>::end() {
-  return Iterator(nullptr, nullptr);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::end() {
+  return Iterator(&header_);
 }
 
 /**
  * @brief Получить константный итератор на начало дерева
  * @return Константный итератор, указывающий на узел с минимальным ключом
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::ConstIterator RBTree<Key, Value>::begin() const {
-  return ConstIterator(GetMin(root));
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::begin() const {
+  return ConstIterator(header_.left);
 }
 
 /**
  * @brief Получить константный итератор на конец дерева
- * @return Константный итератор, указывающий на позицию после последнего
- * элемента (nullptr)
+ * @return Константный итератор, указывающий на заголовок дерева
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::ConstIterator RBTree<Key, Value>::end() const {
-  return ConstIterator(nullptr);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::end() const {
+  return ConstIterator(GetHeader());
 }
 
 /**
  * @brief Оператор разыменования для константного итератора
- * @return Константная пара ключ-значение текущего узла
+ * @return Константная ссылка на элемент текущего узла
  */
-template <typename Key, typename Value>
-const std::pair<Key, Value> RBTree<Key, Value>::ConstIterator::operator*()
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator,
+                Policy>::ConstIterator::reference
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator*()
     const {
-  return this->iter_node_->pair;
+  return this->iter_node_->data;
+}
+
+/**
+ * @brief Оператор доступа к членам для константного итератора
+ * @return Указатель на неизменяемый элемент текущего узла
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::pointer
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator->()
+    const {
+  return &this->iter_node_->data;
 }
 
 /**
  * @brief Оператор доступа к членам
  * @return Указатель на пару ключ-значение текущего узла
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator::pointer
-RBTree<Key, Value>::Iterator::operator->() const {
-  return &iter_node_->pair;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::pointer
+RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator->() const {
+  return &iter_node_->data;
+}
+
+/**
+ * @brief Оператор инкремента префиксный для константного итератора
+ * @return Ссылка на итератор
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator++() {
+  Iterator::operator++();
+  return *this;
+}
+
+/**
+ * @brief Оператор инкремента постфиксный для константного итератора
+ * @return Копия итератора до инкремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator++(int) {
+  ConstIterator temp = *this;
+  Iterator::operator++();
+  return temp;
+}
+
+/**
+ * @brief Оператор декремента префиксный для константного итератора
+ * @return Ссылка на итератор
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator--() {
+  Iterator::operator--();
+  return *this;
+}
+
+/**
+ * @brief Оператор декремента постфиксный для константного итератора
+ * @return Копия итератора до декремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator--(int) {
+  ConstIterator temp = *this;
+  Iterator::operator--();
+  return temp;
 }
 
 /**
@@ -171,8 +329,9 @@ RBTree<Key, Value>::Iterator::operator->() const {
  * @param other Другой константный итератор для сравнения
  * @return true если итераторы указывают на один и тот же узел, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::ConstIterator::operator==(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator::operator==(
     const ConstIterator &other) const {
   return this->iter_node_ == other.iter_node_;
 }
@@ -183,25 +342,31 @@ bool RBTree<Key, Value>::ConstIterator::operator==(
  * @brief Конструктор итератора множества
  * @param node Указатель на узел
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::SetIterator::SetIterator(pointer node) : node_(node) {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::SetIterator(
+    RBTreeNode *node)
+    : node_(node) {}
 
 /**
  * @brief Конструктор копирования итератора множества
  * @param other Другой итератор для копирования
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::SetIterator::SetIterator(const SetIterator &other)
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::SetIterator(
+    const SetIterator &other)
     : node_(other.node_) {}
 
 /**
  * @brief Оператор разыменования для итератора множества
  * @return Ссылка на ключ текущего узла
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetIterator::reference
-RBTree<Key, Value>::SetIterator::operator*() const {
-  return node_->key;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::reference
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator*() const {
+  return node_->data;
 }
 
 /**
@@ -209,30 +374,61 @@ RBTree<Key, Value>::SetIterator::operator*() const {
  * @return Ссылка на итератор
  * @details Перемещает итератор к следующему узлу в порядке возрастания ключей
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetIterator &
-RBTree<Key, Value>::SetIterator::operator++() {
-  if (node_->right) {
-    node_ = node_->right;
-    while (node_->left) node_ = node_->left;
-  } else {
-    pointer parent = node_->parent;
-    while (parent && node_ == parent->right) {
-      node_ = parent;
-      parent = parent->parent;
-    }
-    node_ = parent;
-  }
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator++() {
+  node_ = nextNode(node_);
   return *this;
 }
 
+/**
+ * @brief Оператор инкремента постфиксный для итератора множества
+ * @return Копия итератора до инкремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator++(int) {
+  SetIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+/**
+ * @brief Оператор декремента префиксный для итератора множества
+ * @return Ссылка на итератор
+ * @details Из end() переходит к наибольшему элементу
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator--() {
+  node_ = prevNode(node_);
+  return *this;
+}
+
+/**
+ * @brief Оператор декремента постфиксный для итератора множества
+ * @return Копия итератора до декремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator--(int) {
+  SetIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
 /**
  * @brief Оператор равенства для итератора множества
  * @param other Другой итератор для сравнения
  * @return true если итераторы указывают на один и тот же узел, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::SetIterator::operator==(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator==(
     const SetIterator &other) const {
   return node_ == other.node_;
 }
@@ -242,8 +438,9 @@ bool RBTree<Key, Value>::SetIterator::operator==(
  * @param other Другой итератор для сравнения
  * @return true если итераторы указывают на разные узлы, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::SetIterator::operator!=(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator!=(
     const SetIterator &other) const {
   return !(*this == other);
 }
@@ -254,26 +451,33 @@ bool RBTree<Key, Value>::SetIterator::operator!=(
  * @brief Конструктор константного итератора множества
  * @param node Указатель на узел
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::SetConstIterator::SetConstIterator(pointer node)
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator,
+       Policy>::SetConstIterator::SetConstIterator(const RBTreeNode *node)
     : node_(node) {}
 
 /**
  * @brief Конструктор преобразования из обычного итератора множества
  * @param other Обычный итератор множества
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::SetConstIterator::SetConstIterator(const SetIterator &other)
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator,
+       Policy>::SetConstIterator::SetConstIterator(const SetIterator &other)
     : node_(other.node_) {}
 
 /**
  * @brief Оператор разыменования для константного итератора множества
  * @return Константная ссылка на ключ текущего узла
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetConstIterator::reference
-RBTree<Key, Value>::SetConstIterator::operator*() const {
-  return node_->key;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator,
+                Policy>::SetConstIterator::reference
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator*()
+    const {
+  return node_->data;
 }
 
 /**
@@ -281,30 +485,64 @@ RBTree<Key, Value>::SetConstIterator::operator*() const {
  * @return Ссылка на итератор
  * @details Перемещает итератор к следующему узлу в порядке возрастания ключей
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetConstIterator &
-RBTree<Key, Value>::SetConstIterator::operator++() {
-  if (node_->right) {
-    node_ = node_->right;
-    while (node_->left) node_ = node_->left;
-  } else {
-    pointer parent = node_->parent;
-    while (parent && node_ == parent->right) {
-      node_ = parent;
-      parent = parent->parent;
-    }
-    node_ = parent;
-  }
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator++() {
+  node_ = nextNode(node_);
   return *this;
 }
 
+/**
+ * @brief Оператор инкремента постфиксный для константного итератора множества
+ * @return Копия итератора до инкремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator++(
+    int) {
+  SetConstIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+/**
+ * @brief Оператор декремента префиксный для константного итератора множества
+ * @return Ссылка на итератор
+ * @details Из end() переходит к наибольшему элементу
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator &
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator--() {
+  node_ = prevNode(node_);
+  return *this;
+}
+
+/**
+ * @brief Оператор декремента постфиксный для константного итератора множества
+ * @return Копия итератора до декремента
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator--(
+    int) {
+  SetConstIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
 /**
  * @brief Оператор равенства для константного итератора множества
  * @param other Другой константный итератор для сравнения
  * @return true если итераторы указывают на один и тот же узел, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::SetConstIterator::operator==(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator==(
     const SetConstIterator &other) const {
   return node_ == other.node_;
 }
@@ -314,8 +552,10 @@ bool RBTree<Key, Value>::SetConstIterator::operator==(
  * @param other Другой константный итератор для сравнения
  * @return true если итераторы указывают на разные узлы, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::SetConstIterator::operator!=(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator!=(
     const SetConstIterator &other) const {
   return !(*this == other);
 }
@@ -326,19 +566,22 @@ bool RBTree<Key, Value>::SetConstIterator::operator!=(
  * @brief Получить итератор множества на начало дерева
  * @return Итератор множества, указывающий на узел с минимальным ключом
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetIterator RBTree<Key, Value>::set_begin() {
-  return SetIterator(GetMin(root));
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_begin() {
+  return SetIterator(header_.left);
 }
 
 /**
  * @brief Получить итератор множества на конец дерева
- * @return Итератор множества, указывающий на позицию после последнего элемента
- * (nullptr)
+ * @return Итератор множества, указывающий на заголовок дерева
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetIterator RBTree<Key, Value>::set_end() {
-  return SetIterator(nullptr);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_end() {
+  return SetIterator(&header_);
 }
 
 /**
@@ -346,21 +589,24 @@ typename RBTree<Key, Value>::SetIterator RBTree<Key, Value>::set_end() {
  * @return Константный итератор множества, указывающий на узел с минимальным
  * ключом
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetConstIterator RBTree<Key, Value>::set_cbegin()
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_cbegin()
     const {
-  return SetConstIterator(GetMin(root));
+  return SetConstIterator(header_.left);
 }
 
 /**
  * @brief Получить константный итератор множества на конец дерева
- * @return Константный итератор множества, указывающий на позицию после
- * последнего элемента (nullptr)
+ * @return Константный итератор множества, указывающий на заголовок дерева
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetConstIterator RBTree<Key, Value>::set_cend()
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_cend()
     const {
-  return SetConstIterator(nullptr);
+  return SetConstIterator(&header_);
 }
 
 /**
@@ -369,10 +615,26 @@ typename RBTree<Key, Value>::SetConstIterator RBTree<Key, Value>::set_cend()
  * @return Итератор множества, указывающий на найденный элемент или set_end()
  * если элемент не найден
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::SetIterator RBTree<Key, Value>::set_find(
-    const Key &key) {
-  return SetIterator(findNode(key));
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_find(const Key &key) {
+  RBTreeNode *node = findNode(key);
+  return node ? SetIterator(node) : set_end();
+}
+
+/**
+ * @brief Найти элемент множества по ключу, сравнимому с key
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор множества на найденный элемент или set_end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::set_find(const K& key) {
+  RBTreeNode* node = findNode(key);
+  return node ? SetIterator(node) : set_end();
 }
 
 }  // namespace s21
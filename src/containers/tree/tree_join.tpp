@@ -0,0 +1,354 @@
+/**
+ * @file tree_join.tpp
+ * @brief Реализация разделения и соединения деревьев для класса RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Разделить дерево по ключу
+ * @param key Граница разделения
+ * @return Дерево с ключами не меньше key, с тем же компаратором и
+ * аллокатором
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::split(const Key& key) {
+  RBTree right(comp_, get_allocator());
+  splitInto(key, right);
+  return right;
+}
+
+/**
+ * @brief Присоединить дерево с большими ключами
+ * @param right Дерево с большими ключами, становится пустым
+ * @throw std::invalid_argument Если диапазоны ключей пересекаются
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::join(RBTree& right) {
+  if (this == &right || right.root == nullptr) return;
+  if (root != nullptr &&
+      !comp_(header_.right->key(), right.header_.left->key())) {
+    throw std::invalid_argument("Key ranges overlap");
+  }
+  size_type total = tree_size + right.tree_size;
+  RBTreeNode* rightRoot = takeNodes(right);
+  if (root == nullptr) {
+    attachRoot(rightRoot, GetMin(rightRoot), GetMax(rightRoot));
+  } else {
+    RBTreeNode* pivot = header_.right;
+    unlinkNode(pivot);
+    Subtree joined = joinNodes({root, blackHeight(root)}, pivot,
+                               {rightRoot, blackHeight(rightRoot)});
+    attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  }
+  tree_size = total;
+}
+
+/**
+ * @brief Присоединить опорный элемент и дерево с большими ключами
+ * @param pivot Элемент, разделяющий деревья
+ * @param right Дерево с большими ключами, становится пустым
+ * @throw std::invalid_argument Если ключи нарушают порядок
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::join(
+    const value_type& pivot, RBTree& right) {
+  const Key& key = Traits::key(pivot);
+  if (this == &right ||
+      (root != nullptr && !comp_(header_.right->key(), key)) ||
+      (right.root != nullptr && !comp_(key, right.header_.left->key()))) {
+    throw std::invalid_argument("Pivot is out of order");
+  }
+  size_type total = tree_size + right.tree_size + 1;
+  RBTreeNode* node = createNode(BLACK, pivot);
+  RBTreeNode* rightRoot = nullptr;
+  try {
+    rightRoot = takeNodes(right);
+  } catch (...) {
+    destroyNode(node);
+    throw;
+  }
+  Subtree joined = joinNodes({root, blackHeight(root)}, node,
+                             {rightRoot, blackHeight(rightRoot)});
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size = total;
+}
+
+/**
+ * @brief Черная высота поддерева
+ * @param node Корень поддерева
+ * @return Число черных узлов на левом пути от node до листа
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::blackHeight(
+    const RBTreeNode* node) noexcept {
+  size_type height = 0;
+  for (; node != nullptr; node = node->left) {
+    if (node->getColor() == BLACK) ++height;
+  }
+  return height;
+}
+
+/**
+ * @brief Соединить два поддерева через опорный узел
+ * @param left Поддерево с меньшими ключами
+ * @param pivot Опорный узел
+ * @param right Поддерево с большими ключами
+ * @return Получившееся поддерево, подвешенное к заголовку
+ * @details Корни поддеревьев перекрашиваются в черный. При равной черной
+ * высоте опорный узел становится черным корнем. Иначе по правому (левому)
+ * краю более высокого поддерева спуск идет до черного узла с черной
+ * высотой низкого, опорный красный узел встает на его место и
+ * insertFixup устраняет возможный красный конфликт. Спуск занимает
+ * O(|hl - hr| + 1), что при разборе пути в split дает O(log n) в сумме.
+ * В прошитом дереве опорный узел встает между максимумом left и минимумом
+ * right, поиск крайних узлов стоит еще O(log n)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::joinNodes(Subtree left,
+                                                          RBTreeNode* pivot,
+                                                          Subtree right) {
+  for (Subtree* part : {&left, &right}) {
+    if (part->root != nullptr && part->root->getColor() == RED) {
+      part->root->setColor(BLACK);
+      ++part->height;
+    }
+  }
+  if constexpr (Policy::threaded) {
+    if (left.root != nullptr) linkThreads(GetMax(left.root), pivot);
+    if (right.root != nullptr) linkThreads(pivot, GetMin(right.root));
+  }
+
+  if (left.height == right.height) {
+    pivot->setColor(BLACK);
+    pivot->left = left.root;
+    pivot->right = right.root;
+    if (left.root != nullptr) left.root->setParent(pivot);
+    if (right.root != nullptr) right.root->setParent(pivot);
+    updateWeight(pivot);
+    hangRoot(pivot);
+    return {pivot, left.height + 1};
+  }
+
+  bool tallLeft = left.height > right.height;
+  Subtree tall = tallLeft ? left : right;
+  Subtree low = tallLeft ? right : left;
+  hangRoot(tall.root);
+
+  RBTreeNode* parent = nullptr;
+  RBTreeNode* current = tall.root;
+  size_type height = tall.height;
+  while (current != nullptr &&
+         (height > low.height || current->getColor() == RED)) {
+    if (current->getColor() == BLACK) --height;
+    parent = current;
+    current = tallLeft ? current->right : current->left;
+  }
+
+  pivot->setColor(RED);
+  pivot->setParent(parent);
+  if (tallLeft) {
+    pivot->left = current;
+    pivot->right = low.root;
+    parent->right = pivot;
+  } else {
+    pivot->left = low.root;
+    pivot->right = current;
+    parent->left = pivot;
+  }
+  if (current != nullptr) current->setParent(pivot);
+  if (low.root != nullptr) low.root->setParent(pivot);
+  updateWeightsToRoot(pivot);
+
+  bool grew = insertFixup(pivot);
+  return {root, tall.height + (grew ? 1 : 0)};
+}
+
+/**
+ * @brief Разделить дерево по ключу в пустое дерево right
+ * @param key Граница разделения
+ * @param right Пустое дерево, получающее ключи не меньше key
+ * @details Узел с ключом key, если он есть, присоединяется к большей части
+ * как ее минимум. Если узлы нельзя передать right, элементы большей части
+ * перемещаются в новые узлы right, а старые узлы удаляются
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::splitInto(
+    const Key& key, RBTree& right) {
+  bool shared = sharesNodeStorage(right);
+  if (!shared) {
+    right.assign_sorted(
+        std::make_move_iterator(Iterator(lowerBoundNode(key))),
+        std::make_move_iterator(end()));
+  }
+
+  size_type total = tree_size;
+  SplitParts parts = splitNodes({root, blackHeight(root)}, key);
+  Subtree lessPart = parts.less;
+  Subtree notLessPart = parts.greater;
+  if (parts.equal != nullptr) {
+    notLessPart = joinNodes({nullptr, 0}, parts.equal, notLessPart);
+  }
+
+  attachRoot(lessPart.root, GetMin(lessPart.root), GetMax(lessPart.root));
+  if (!shared) {
+    deleteSubtree(notLessPart.root);
+    tree_size = total - right.tree_size;
+    return;
+  }
+  right.attachRoot(notLessPart.root, GetMin(notLessPart.root),
+                   GetMax(notLessPart.root));
+
+  if constexpr (Policy::order_statistics && Policy::unit_weights) {
+    tree_size = subtreeWeight(root);
+  } else {
+    const RBTreeNode* mine = header_.left;
+    const RBTreeNode* theirs = right.header_.left;
+    size_type steps = 0;
+    while (mine != &header_ && theirs != &right.header_) {
+      mine = nextNode(mine);
+      theirs = nextNode(theirs);
+      ++steps;
+    }
+    tree_size = mine == &header_ ? steps : total - steps;
+  }
+  right.tree_size = total - tree_size;
+}
+
+/**
+ * @brief Разделить поддерево по ключу
+ * @param tree Разделяемое поддерево
+ * @param key Граница разделения
+ * @return Меньшая часть, узел с ключом key (или nullptr) и большая часть
+ * @details Путь поиска запоминается вместе с черными высотами поддеревьев,
+ * висящих сбоку от него, затем разбирается снизу вверх через joinNodes.
+ * Высота соединяемых частей растет вместе с подъемом, поэтому суммарная
+ * стоимость соединений O(log n)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::SplitParts
+RBTree<Key, Value, Compare, Allocator, Policy>::splitNodes(Subtree tree,
+                                                           const Key& key) {
+  constexpr size_type kMaxDepth = 2 * std::numeric_limits<size_type>::digits;
+  RBTreeNode* path[kMaxDepth];
+  size_type heights[kMaxDepth];
+  bool less[kMaxDepth];
+  size_type depth = 0;
+
+  SplitParts parts{{nullptr, 0}, nullptr, {nullptr, 0}};
+  RBTreeNode* node = tree.root;
+  size_type height = tree.height;
+  while (node != nullptr) {
+    size_type childHeight = height - (node->getColor() == BLACK ? 1 : 0);
+    if (comp_(node->key(), key)) {
+      less[depth] = true;
+    } else if (comp_(key, node->key())) {
+      less[depth] = false;
+    } else {
+      parts.less = {node->left, childHeight};
+      parts.equal = node;
+      parts.greater = {node->right, childHeight};
+      break;
+    }
+    path[depth] = node;
+    heights[depth] = childHeight;
+    node = less[depth++] ? node->right : node->left;
+    height = childHeight;
+  }
+
+  while (depth > 0) {
+    --depth;
+    node = path[depth];
+    if (less[depth]) {
+      parts.less = joinNodes({node->left, heights[depth]}, node, parts.less);
+    } else {
+      parts.greater =
+          joinNodes(parts.greater, node, {node->right, heights[depth]});
+    }
+  }
+  return parts;
+}
+
+/**
+ * @brief Соединить два поддерева без опорного узла
+ * @param left Поддерево с меньшими ключами
+ * @param right Поддерево с большими ключами
+ * @return Получившееся поддерево
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::joinNodes(Subtree left,
+                                                          Subtree right) {
+  if (right.root == nullptr) return left;
+  if (left.root == nullptr) return right;
+  SplitParts parts = splitNodes(left, GetMax(left.root)->key());
+  return joinNodes(parts.less, parts.equal, right);
+}
+
+/**
+ * @brief Поддерево потомка узла-корня поддерева
+ * @param parent Поддерево
+ * @param child Левый или правый потомок его корня
+ * @return Поддерево потомка с его черной высотой
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::childSubtree(
+    Subtree parent, RBTreeNode* child) noexcept {
+  return {child, parent.height - (parent.root->getColor() == BLACK ? 1 : 0)};
+}
+
+/**
+ * @brief Может ли дерево забрать узлы другого дерева без копирования
+ * @param other Другое дерево
+ * @return true, если узлы выделены совместимым хранилищем
+ * @details Пул принадлежит одному дереву, поэтому его узлы не передаются.
+ * Узлы обычного хранилища передаются, если аллокаторы равны
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::sharesNodeStorage(
+    const RBTree& other) const noexcept {
+  if constexpr (Policy::pooled_nodes) {
+    static_cast<void>(other);
+    return false;
+  } else {
+    return std::allocator_traits<Allocator>::is_always_equal::value ||
+           get_allocator() == other.get_allocator();
+  }
+}
+
+/**
+ * @brief Забрать все узлы другого дерева
+ * @param other Дерево, становится пустым
+ * @return Корень полученного поддерева (nullptr для пустого other)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::takeNodes(RBTree& other) {
+  RBTreeNode* node = other.root;
+  if (node == nullptr) return nullptr;
+  if (sharesNodeStorage(other)) {
+    other.attachRoot(nullptr, nullptr, nullptr);
+    other.tree_size = 0;
+    return node;
+  }
+  RBTreeNode* moved = moveSubtree(node);
+  other.clear();
+  return moved;
+}
+
+}  // namespace s21
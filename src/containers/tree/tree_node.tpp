@@ -7,21 +7,60 @@ namespace s21 {
 
 /**
  * @brief Узел красно-черного дерева
- * @details Содержит ключ, значение, цвет и указатели на родительский и дочерние
- * узлы
+ * @details Элемент узла строит RBTree::createNode через аллокатор дерева
  *
- * @param k Ключ узла
- * @param v Значение узла
- * @param c Цвет узла (по умолчанию RED)
+ * @param c Цвет узла
  */
-template <typename Key, typename Value>
-RBTree<Key, Value>::RBTreeNode::RBTreeNode(Key k, Value v, Color c)
-    : key(k),
-      value(v),
-      pair(k, v),
-      color(c),
-      parent(nullptr),
-      left(nullptr),
-      right(nullptr) {}
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode::RBTreeNode(
+    Color c) noexcept
+    : left(nullptr), right(nullptr) {
+  this->setColor(c);
+}
+
+/**
+ * @brief Создать узел в памяти хранилища
+ * @details Элемент строится прямо в узле через allocator_traits::construct,
+ * поэтому аллокаторы вроде std::pmr::polymorphic_allocator передают свой
+ * ресурс и элементу. Если конструктор элемента бросает исключение, память
+ * возвращается хранилищу
+ * @param c Цвет узла
+ * @param args Аргументы конструктора элемента
+ * @return Указатель на новый узел
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::createNode(
+    Color c, Args&&... args) {
+  RBTreeNode* node = new (nodes_.allocate()) RBTreeNode(c);
+  allocator_type alloc(nodes_.get_allocator());
+  try {
+    std::allocator_traits<allocator_type>::construct(
+        alloc, std::addressof(node->data), std::forward<Args>(args)...);
+  } catch (...) {
+    node->~RBTreeNode();
+    nodes_.deallocate(node);
+    throw;
+  }
+  return node;
+}
+
+/**
+ * @brief Разрушить узел и вернуть его память хранилищу
+ * @param node Удаляемый узел
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::destroyNode(
+    RBTreeNode* node) noexcept {
+  allocator_type alloc(nodes_.get_allocator());
+  std::allocator_traits<allocator_type>::destroy(alloc,
+                                                 std::addressof(node->data));
+  node->~RBTreeNode();
+  nodes_.deallocate(node);
+}
 
 }  // namespace s21
@@ -0,0 +1,210 @@
+/**
+ * @file tree_node_handle.tpp
+ * @brief Реализация извлечения и вставки узлов для класса RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Конструктор перемещения
+ * @param other Дескриптор, который становится пустым
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle::NodeHandle(
+    NodeHandle&& other) noexcept
+    : node_(other.node_), alloc_(std::move(other.alloc_)) {
+  other.node_ = nullptr;
+  other.alloc_.reset();
+}
+
+/**
+ * @brief Оператор перемещающего присваивания
+ * @param other Дескриптор, который становится пустым
+ * @return Ссылка на текущий дескриптор
+ * @details Узел, которым владел текущий дескриптор, разрушается
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle&
+RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle::operator=(
+    NodeHandle&& other) noexcept {
+  if (this != &other) {
+    reset();
+    node_ = other.node_;
+    alloc_ = std::move(other.alloc_);
+    other.node_ = nullptr;
+    other.alloc_.reset();
+  }
+  return *this;
+}
+
+/**
+ * @brief Обменять дескрипторы
+ * @param other Другой дескриптор
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle::swap(
+    NodeHandle& other) noexcept {
+  std::swap(node_, other.node_);
+  std::swap(alloc_, other.alloc_);
+}
+
+/**
+ * @brief Разрушить узел, если дескриптор им владеет
+ * @details Элемент разрушается и память возвращается тем же аллокатором,
+ * которым узел был выделен
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator,
+            Policy>::NodeHandle::reset() noexcept {
+  if (node_ == nullptr) return;
+  std::allocator_traits<allocator_type>::destroy(*alloc_,
+                                                 std::addressof(node_->data));
+  node_->~RBTreeNode();
+  HeapNodeStorage<RBTreeNode, Allocator>(*alloc_).deallocate(node_);
+  node_ = nullptr;
+  alloc_.reset();
+}
+
+/**
+ * @brief Отказаться от владения узлом
+ * @return Узел
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle::release() noexcept {
+  RBTreeNode* node = node_;
+  node_ = nullptr;
+  alloc_.reset();
+  return node;
+}
+
+/**
+ * @brief Извлечь узел из дерева без освобождения памяти
+ * @param pos Итератор на извлекаемый элемент
+ * @return Владеющий узлом дескриптор (пустой для end())
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle
+RBTree<Key, Value, Compare, Allocator, Policy>::extract(Iterator pos) {
+  RBTreeNode* node = pos.iter_node_;
+  if (node == nullptr || node == &header_) return NodeHandle();
+  return makeHandle(node);
+}
+
+/**
+ * @brief Извлечь узел по ключу
+ * @param key Ключ извлекаемого элемента
+ * @return Владеющий узлом дескриптор (пустой, если ключа нет)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle
+RBTree<Key, Value, Compare, Allocator, Policy>::extract(const Key& key) {
+  RBTreeNode* node = findNode(key);
+  if (node == nullptr) return NodeHandle();
+  return makeHandle(node);
+}
+
+/**
+ * @brief Вставить извлеченный узел
+ * @param node Дескриптор узла
+ * @return Позиция, флаг вставки и дескриптор, если ключ уже был в дереве
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator,
+                Policy>::template InsertReturn<typename RBTree<
+    Key, Value, Compare, Allocator, Policy>::Iterator>
+RBTree<Key, Value, Compare, Allocator, Policy>::insert(NodeHandle&& node) {
+  if (node.empty()) return {end(), false, NodeHandle()};
+  InsertPosition position = findInsertPosition(node.key());
+  if (position.existing != nullptr) {
+    return {Iterator(position.existing), false, std::move(node)};
+  }
+  RBTreeNode* inserted = nullptr;
+  if (adoptsNode(node)) {
+    inserted = node.release();
+    relinkNode(inserted, position);
+  } else {
+    inserted = createNode(RED, std::move(node.value()));
+    linkNode(inserted, position.parent, position.toLeft);
+    node.reset();
+  }
+  return {Iterator(inserted), true, NodeHandle()};
+}
+
+/**
+ * @brief Подвесить к дереву узел, ранее отвязанный от дерева
+ * @param node Узел
+ * @param position Место вставки из findInsertPosition
+ * @details Узел очищается так же, как только что созданный, поэтому
+ * linkNode заново считает его вес и цвет
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::relinkNode(
+    RBTreeNode* node, InsertPosition position) {
+  node->left = nullptr;
+  node->right = nullptr;
+  node->setParent(nullptr);
+  node->setColor(RED);
+  linkNode(node, position.parent, position.toLeft);
+}
+
+/**
+ * @brief Может ли дерево забрать узел дескриптора без копирования
+ * @param handle Непустой дескриптор
+ * @return true, если узел выделен совместимым аллокатором
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::adoptsNode(
+    const NodeHandle& handle) const noexcept {
+  if constexpr (Policy::pooled_nodes) {
+    static_cast<void>(handle);
+    return false;
+  } else {
+    return std::allocator_traits<Allocator>::is_always_equal::value ||
+           get_allocator() == *handle.alloc_;
+  }
+}
+
+/**
+ * @brief Передать узел дескриптору
+ * @param node Узел дерева
+ * @return Дескриптор
+ * @details Узел пула принадлежит дереву, поэтому его элемент сначала
+ * перемещается в узел, выделенный через аллокатор, и только потом узел
+ * удаляется из дерева
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::NodeHandle
+RBTree<Key, Value, Compare, Allocator, Policy>::makeHandle(RBTreeNode* node) {
+  allocator_type alloc(get_allocator());
+  if constexpr (Policy::pooled_nodes) {
+    HeapNodeStorage<RBTreeNode, Allocator> storage(alloc);
+    RBTreeNode* copy = new (storage.allocate()) RBTreeNode(RED);
+    try {
+      std::allocator_traits<allocator_type>::construct(
+          alloc, std::addressof(copy->data), std::move(node->data));
+    } catch (...) {
+      copy->~RBTreeNode();
+      storage.deallocate(copy);
+      throw;
+    }
+    eraseNode(node);
+    return NodeHandle(copy, alloc);
+  } else {
+    unlinkNode(node);
+    return NodeHandle(node, alloc);
+  }
+}
+
+}  // namespace s21
@@ -9,34 +9,163 @@ namespace s21 {
  * @brief Получить корень дерева
  * @return Указатель на корневой узел дерева
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::GetRoot() const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::GetRoot() const {
   return root;
 }
 
+/**
+ * @brief Получить заголовок дерева
+ * @return Указатель на заголовок, он же позиция end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::GetHeader() const noexcept {
+  return const_cast<RBTreeNode*>(&header_);
+}
+
+/**
+ * @brief Сделать заголовок заголовком пустого дерева
+ * @details Минимум и максимум указывают на сам заголовок, поэтому
+ * begin() == end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::resetHeader() noexcept {
+  header_.setParent(nullptr);
+  header_.left = &header_;
+  header_.right = &header_;
+  linkThreads(&header_, &header_);
+}
+
+/**
+ * @brief Подвесить готовое дерево к заголовку
+ * @param node Новый корень (nullptr для пустого дерева)
+ * @param leftmost Минимальный узел дерева
+ * @param rightmost Максимальный узел дерева
+ * @details Используется, когда дерево целиком строится или переходит от
+ * другого заголовка: при копировании, перемещении, обмене и массовой вставке.
+ * В прошитом дереве крайние узлы замыкаются на заголовок, ссылки между
+ * остальными узлами должны быть уже верны. Корень перекрашивается в
+ * черный: у частей разрезания он может остаться красным, а prevNode
+ * отличает заголовок от узлов по черному корню
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::attachRoot(
+    RBTreeNode* node, RBTreeNode* leftmost, RBTreeNode* rightmost) noexcept {
+  if (node == nullptr) {
+    root = nullptr;
+    resetHeader();
+    return;
+  }
+  node->setColor(BLACK);
+  hangRoot(node);
+  header_.left = leftmost;
+  header_.right = rightmost;
+  linkThreads(&header_, leftmost);
+  linkThreads(rightmost, &header_);
+}
+
+/**
+ * @brief Сделать узел корнем дерева
+ * @param node Новый корень
+ * @details Минимум и максимум в заголовке не меняются: joinNodes собирает
+ * дерево на месте корня, а крайние узлы потом задает attachRoot
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::hangRoot(
+    RBTreeNode* node) noexcept {
+  root = node;
+  node->setParent(&header_);
+  header_.setParent(node);
+}
+
+/**
+ * @brief Связать соседние в порядке ключей узлы
+ * @param before Меньший узел или заголовок
+ * @param after Следующий за ним узел или заголовок
+ * @details Без прошивки ничего не делает
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::linkThreads(
+    RBTreeNode* before, RBTreeNode* after) noexcept {
+  if constexpr (Policy::threaded) {
+    before->next = after;
+    after->prev = before;
+  } else {
+    static_cast<void>(before);
+    static_cast<void>(after);
+  }
+}
+
+/**
+ * @brief Прошить все узлы поддерева
+ * @param top Корень поддерева (может быть nullptr)
+ * @details Обход в симметричном порядке подъемом по родителям, который
+ * останавливается на top, поэтому поддерево может еще не висеть на
+ * заголовке. Нужен там, где узлы создаются копированием структуры
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::threadNodes(
+    RBTreeNode* top) noexcept {
+  if constexpr (Policy::threaded) {
+    if (top == nullptr) return;
+    RBTreeNode* node = top;
+    while (node->left != nullptr) node = node->left;
+    RBTreeNode* previous = nullptr;
+    while (node != nullptr) {
+      if (previous != nullptr) linkThreads(previous, node);
+      previous = node;
+      if (node->right != nullptr) {
+        node = node->right;
+        while (node->left != nullptr) node = node->left;
+      } else {
+        while (node != top && node == node->getParent()->right) {
+          node = node->getParent();
+        }
+        node = node == top ? nullptr : node->getParent();
+      }
+    }
+  } else {
+    static_cast<void>(top);
+  }
+}
+
 /**
  * @brief Выполнить левый поворот вокруг указанного узла
  * @param node Узел, вокруг которого выполняется поворот
  * @details Перестраивает связи между узлами для поддержания свойств
  * красно-черного дерева
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::leftRotate(RBTreeNode* node) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::leftRotate(
+    RBTreeNode* node) {
   RBTreeNode* y = node->right;
   node->right = y->left;
   if (y->left != nullptr) {
-    y->left->parent = node;
+    y->left->setParent(node);
   }
-  y->parent = node->parent;
-  if (node->parent == nullptr) {
+  y->setParent(node->getParent());
+  if (node == root) {
     root = y;
-  } else if (node == node->parent->left) {
-    node->parent->left = y;
+    header_.setParent(y);
+  } else if (node == node->getParent()->left) {
+    node->getParent()->left = y;
   } else {
-    node->parent->right = y;
+    node->getParent()->right = y;
   }
   y->left = node;
-  node->parent = y;
+  node->setParent(y);
+  updateWeight(node);
+  updateWeight(y);
 }
 
 /**
@@ -45,120 +174,527 @@ void RBTree<Key, Value>::leftRotate(RBTreeNode* node) {
  * @details Перестраивает связи между узлами для поддержания свойств
  * красно-черного дерева
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::rightRotate(RBTreeNode* node) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::rightRotate(
+    RBTreeNode* node) {
   RBTreeNode* leftChild = node->left;
   node->left = leftChild->right;
 
   if (leftChild->right != nullptr) {
-    leftChild->right->parent = node;
+    leftChild->right->setParent(node);
   }
 
-  leftChild->parent = node->parent;
+  leftChild->setParent(node->getParent());
 
-  if (node->parent == nullptr) {
+  if (node == root) {
     root = leftChild;
-  } else if (node == node->parent->right) {
-    node->parent->right = leftChild;
+    header_.setParent(leftChild);
+  } else if (node == node->getParent()->right) {
+    node->getParent()->right = leftChild;
   } else {
-    node->parent->left = leftChild;
+    node->getParent()->left = leftChild;
   }
 
   leftChild->right = node;
-  node->parent = leftChild;
+  node->setParent(leftChild);
+  updateWeight(node);
+  updateWeight(leftChild);
 }
 
 /**
  * @brief Исправление свойств красно-черного дерева после вставки
  * @param node Узел, с которого начинается исправление
+ * @return true, если черная высота дерева выросла на 1
  * @details Восстанавливает свойства красно-черного дерева после вставки нового
- * узла
- */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::insertFixup(RBTreeNode* node) {
-  while (node->parent != nullptr && node->parent->color == RED) {
-    if (node->parent == node->parent->parent->left) {
-      RBTreeNode* uncle = node->parent->parent->right;
-      if (uncle != nullptr && uncle->color == RED) {
-        node->parent->color = BLACK;
-        uncle->color = BLACK;
-        node->parent->parent->color = RED;
-        node = node->parent->parent;
+ * узла. Корень остается красным к концу цикла, только если перекраска дошла
+ * до него, поэтому его окраска в черный и есть рост черной высоты
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::insertFixup(
+    RBTreeNode* node) {
+  while (node != root && node->getParent()->getColor() == RED) {
+    RBTreeNode* parent = node->getParent();
+    RBTreeNode* grandparent = parent->getParent();
+    if (parent == grandparent->left) {
+      RBTreeNode* uncle = grandparent->right;
+      if (uncle != nullptr && uncle->getColor() == RED) {
+        parent->setColor(BLACK);
+        uncle->setColor(BLACK);
+        grandparent->setColor(RED);
+        node = grandparent;
       } else {
-        if (node == node->parent->right) {
-          node = node->parent;
+        if (node == parent->right) {
+          node = parent;
           leftRotate(node);
+          parent = node->getParent();
         }
-        node->parent->color = BLACK;
-        node->parent->parent->color = RED;
-        rightRotate(node->parent->parent);
+        parent->setColor(BLACK);
+        grandparent->setColor(RED);
+        rightRotate(grandparent);
       }
     } else {
-      RBTreeNode* uncle = node->parent->parent->left;
-      if (uncle != nullptr && uncle->color == RED) {
-        node->parent->color = BLACK;
-        uncle->color = BLACK;
-        node->parent->parent->color = RED;
-        node = node->parent->parent;
+      RBTreeNode* uncle = grandparent->left;
+      if (uncle != nullptr && uncle->getColor() == RED) {
+        parent->setColor(BLACK);
+        uncle->setColor(BLACK);
+        grandparent->setColor(RED);
+        node = grandparent;
       } else {
-        node->parent->color = BLACK;
-        node->parent->parent->color = RED;
-        leftRotate(node->parent->parent);
+        if (node == parent->left) {
+          node = parent;
+          rightRotate(node);
+          parent = node->getParent();
+        }
+        parent->setColor(BLACK);
+        grandparent->setColor(RED);
+        leftRotate(grandparent);
       }
     }
   }
-  root->color = BLACK;
+  bool grew = root->getColor() == RED;
+  root->setColor(BLACK);
+  return grew;
 }
 
 /**
  * @brief Вставка элемента в дерево
  * @param key Ключ для вставки
- * @param value Значение для вставки
- * @details Вставляет новый узел и восстанавливает свойства красно-черного
- * дерева
- */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::insert(const Key& key, const Value& value) {
-  if (contains(key)) return;
-  RBTreeNode* newNode = new RBTreeNode(key, value, RED);
+ * @param args Значение для вставки (отсутствует для дерева без значений)
+ * @return Пара из итератора на элемент с ключом key и флага успешной вставки
+ * @details Строит элемент из ключа и значения прямо в новом узле
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator,
+          bool>
+RBTree<Key, Value, Compare, Allocator, Policy>::insert(
+    const Key& key, Args&&... args) {
+  auto [node, inserted] = insertUnique(key, key, std::forward<Args>(args)...);
+  return {Iterator(node), inserted};
+}
+
+/**
+ * @brief Вставка элемента, если ключа еще нет в дереве
+ * @param key Ключ вставляемого элемента
+ * @param args Аргументы, из которых элемент строится прямо в узле
+ * @return Пара из узла с ключом key и флага, был ли узел создан
+ * @details Элемент строится только если ключ не найден
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*,
+          bool>
+RBTree<Key, Value, Compare, Allocator, Policy>::insertUnique(
+    const Key& key, Args&&... args) {
+  return insertUniqueHint(nullptr, key, std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Вставка элемента по подсказке, если ключа еще нет в дереве
+ * @param hint Узел-подсказка (nullptr - без подсказки)
+ * @param key Ключ вставляемого элемента
+ * @param args Аргументы, из которых элемент строится прямо в узле
+ * @return Пара из узла с ключом key и флага, был ли узел создан
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*,
+          bool>
+RBTree<Key, Value, Compare, Allocator, Policy>::insertUniqueHint(
+    const RBTreeNode* hint, const Key& key, Args&&... args) {
+  InsertPosition position = findHintPosition(hint, key);
+  if (position.existing != nullptr) return {position.existing, false};
+
+  RBTreeNode* newNode = createNode(RED, std::forward<Args>(args)...);
+  linkNode(newNode, position.parent, position.toLeft);
+  return {newNode, true};
+}
+
+/**
+ * @brief Построить элемент и вставить его по подсказке
+ * @param hint Узел-подсказка (nullptr - без подсказки)
+ * @param args Аргументы конструктора элемента
+ * @return Пара из узла с ключом элемента и флага, был ли узел вставлен
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*,
+          bool>
+RBTree<Key, Value, Compare, Allocator, Policy>::emplaceUniqueHint(
+    const RBTreeNode* hint, Args&&... args) {
+  RBTreeNode* newNode = createNode(RED, std::forward<Args>(args)...);
+  InsertPosition position;
+  try {
+    position = findHintPosition(hint, newNode->key());
+  } catch (...) {
+    destroyNode(newNode);
+    throw;
+  }
+  if (position.existing != nullptr) {
+    destroyNode(newNode);
+    return {position.existing, false};
+  }
+  linkNode(newNode, position.parent, position.toLeft);
+  return {newNode, true};
+}
+
+/**
+ * @brief Найти место для вставки ключа по подсказке
+ * @param hint Узел, перед которым ожидается ключ (заголовок для end())
+ * @param key Ключ
+ * @return Место вставки или узел с тем же ключом
+ * @details Для end() ключ сравнивается с максимумом, так что равный
+ * максимуму ключ тоже находится без спуска. Ключ, больший hint, проверяется
+ * и со следующим узлом, чтобы подсказка на последний вставленный элемент
+ * тоже работала. Новый узел подвешивается к тому из двух соседей, у которого
+ * свободна нужная сторона: если у меньшего соседа есть правое поддерево,
+ * больший сосед - его минимум, и его левая сторона пуста
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::InsertPosition
+RBTree<Key, Value, Compare, Allocator, Policy>::findHintPosition(
+    const RBTreeNode* hint, const Key& key) const {
+  if (hint == nullptr || root == nullptr) return findInsertPosition(key);
+  RBTreeNode* node = const_cast<RBTreeNode*>(hint);
+  if (node == &header_) node = header_.right;
+
+  RBTreeNode* before = nullptr;
+  RBTreeNode* after = nullptr;
+  if (comp_(key, node->key())) {
+    if (hint != node) return findInsertPosition(key);
+    after = node;
+    if (node != header_.left) {
+      before = prevNode(node);
+      if (!comp_(before->key(), key)) return findInsertPosition(key);
+    }
+  } else if (comp_(node->key(), key)) {
+    before = node;
+    if (node != header_.right) {
+      after = nextNode(node);
+      if (!comp_(key, after->key())) return findInsertPosition(key);
+    }
+  } else {
+    return {nullptr, false, node};
+  }
+
+  if (before != nullptr && before->right == nullptr) {
+    return {before, false, nullptr};
+  }
+  return {after, true, nullptr};
+}
+
+/**
+ * @brief Найти место для вставки ключа
+ * @param key Ключ
+ * @return Место вставки или узел с тем же ключом
+ * @details За один спуск от корня либо находит узел с таким ключом, либо
+ * запоминает место вставки. На каждом уровне выполняется одно сравнение:
+ * последний узел, от которого спуск ушел вправо, - наибольший ключ не больше
+ * key, и равенство проверяется только с ним
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::InsertPosition
+RBTree<Key, Value, Compare, Allocator, Policy>::findInsertPosition(
+    const Key& key) const {
   RBTreeNode* parent = nullptr;
   RBTreeNode* current = root;
+  RBTreeNode* notGreater = nullptr;
+  bool toLeft = false;
 
   while (current != nullptr) {
     parent = current;
-    if (newNode->key < current->key) {
+    toLeft = comp_(key, current->key());
+    if (toLeft) {
       current = current->left;
     } else {
+      notGreater = current;
       current = current->right;
     }
   }
+  if (notGreater != nullptr && !comp_(notGreater->key(), key)) {
+    return {parent, toLeft, notGreater};
+  }
+  return {parent, toLeft, nullptr};
+}
 
-  newNode->parent = parent;
+/**
+ * @brief Подвесить новый узел к дереву
+ * @param node Новый узел
+ * @param parent Будущий родитель (nullptr для пустого дерева)
+ * @param toLeft Подвесить узел левым потомком parent
+ * @details Обновляет минимум и максимум в заголовке, веса поддеревьев на
+ * пути до корня и восстанавливает свойства красно-черного дерева после
+ * вставки
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::linkNode(
+    RBTreeNode* node, RBTreeNode* parent, bool toLeft) {
   if (parent == nullptr) {
-    root = newNode;
-  } else if (newNode->key < parent->key) {
-    parent->left = newNode;
+    attachRoot(node, node, node);
+  } else if (toLeft) {
+    node->setParent(parent);
+    parent->left = node;
+    if (parent == header_.left) header_.left = node;
+    if constexpr (Policy::threaded) linkThreads(parent->prev, node);
+    linkThreads(node, parent);
   } else {
-    parent->right = newNode;
+    node->setParent(parent);
+    parent->right = node;
+    if (parent == header_.right) header_.right = node;
+    if constexpr (Policy::threaded) linkThreads(node, parent->next);
+    linkThreads(parent, node);
   }
+  updateWeightsToRoot(node);
 
-  insertFixup(newNode);
+  insertFixup(node);
   tree_size++;
 }
 
+/**
+ * @brief Заменить содержимое дерева элементами диапазона
+ * @param first Начало диапазона
+ * @param last Конец диапазона
+ * @details Первый проход создает узлы в порядке диапазона и связывает их в
+ * список через right, попутно проверяя, отсортированы ли ключи.
+ * Неотсортированный список сортируется, затем из эквивалентных ключей
+ * остается первый, и список сворачивается в дерево. Неполный последний
+ * уровень окрашивается в красный, остальные уровни черные, поэтому черная
+ * высота всех путей одинакова
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename InputIt>
+void RBTree<Key, Value, Compare, Allocator, Policy>::assign_sorted(
+    InputIt first, InputIt last) {
+  clear();
+  RBTreeNode* head = nullptr;
+  RBTreeNode** tail = &head;
+  RBTreeNode* previous = nullptr;
+  size_type count = 0;
+  bool sorted = true;
+  try {
+    for (; first != last; ++first) {
+      RBTreeNode* node = createNode(BLACK, *first);
+      if (previous != nullptr && comp_(node->key(), previous->key())) {
+        sorted = false;
+      }
+      *tail = node;
+      tail = &node->right;
+      previous = node;
+      ++count;
+    }
+    if (!sorted) head = sortNodeList(head, count);
+  } catch (...) {
+    while (head != nullptr) destroyNode(std::exchange(head, head->right));
+    throw;
+  }
+
+  count = 0;
+  RBTreeNode* leftmost = head;
+  RBTreeNode* rightmost = nullptr;
+  for (RBTreeNode* current = head; current != nullptr;
+       current = current->right) {
+    while (current->right != nullptr &&
+           !comp_(current->key(), current->right->key())) {
+      destroyNode(std::exchange(current->right, current->right->right));
+    }
+    if (current->right != nullptr) linkThreads(current, current->right);
+    rightmost = current;
+    ++count;
+  }
+
+  size_type fullLevels = 0;
+  while ((size_type{2} << fullLevels) - 1 <= count) ++fullLevels;
+  attachRoot(buildBalanced(head, count, 0, fullLevels), leftmost, rightmost);
+  tree_size = count;
+}
+
+/**
+ * @brief Устойчивая сортировка списка узлов
+ * @param head Первый узел списка, узлы связаны через right
+ * @param n Длина списка
+ * @return Первый узел отсортированного списка
+ * @details Указатели на узлы собираются в массив и сортируются восходящим
+ * слиянием через второй буфер, после чего список связывается заново. Массив
+ * последовательен в памяти, поэтому проходы заметно быстрее слияния самих
+ * списков. При равных ключах первым берется элемент левой серии, поэтому
+ * исходный порядок эквивалентных элементов сохраняется
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::sortNodeList(RBTreeNode* head,
+                                                             size_type n) {
+  if (n < 2) return head;
+  std::unique_ptr<RBTreeNode*[]> buffer(new RBTreeNode*[2 * n]);
+  RBTreeNode** from = buffer.get();
+  RBTreeNode** to = from + n;
+  for (size_type i = 0; i < n; ++i, head = head->right) from[i] = head;
+
+  for (size_type width = 1; width < n; width *= 2) {
+    for (size_type lo = 0; lo < n; lo += 2 * width) {
+      size_type mid = std::min(lo + width, n);
+      size_type hi = std::min(lo + 2 * width, n);
+      size_type i = lo, j = mid, k = lo;
+      while (i < mid && j < hi) {
+        to[k++] = comp_(from[j]->key(), from[i]->key()) ? from[j++] : from[i++];
+      }
+      while (i < mid) to[k++] = from[i++];
+      while (j < hi) to[k++] = from[j++];
+    }
+    std::swap(from, to);
+  }
+
+  for (size_type i = 0; i + 1 < n; ++i) from[i]->right = from[i + 1];
+  from[n - 1]->right = nullptr;
+  return from[0];
+}
+
+/**
+ * @brief Построить сбалансированное поддерево из отсортированного списка
+ * @param list Список узлов, связанных через right
+ * @param n Количество узлов поддерева
+ * @param depth Глубина корня поддерева
+ * @param redDepth Глубина неполного последнего уровня
+ * @return Корень поддерева
+ * @details Обход в симметричном порядке: левое поддерево забирает первые
+ * (n - 1) / 2 узлов списка, следующий узел становится корнем. Размеры
+ * поддеревьев отличаются не больше чем на один, поэтому все уровни, кроме
+ * последнего, заполнены
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::buildBalanced(
+    RBTreeNode*& list, size_type n, size_type depth, size_type redDepth) {
+  if (n == 0) return nullptr;
+  size_type leftSize = (n - 1) / 2;
+  RBTreeNode* left = buildBalanced(list, leftSize, depth + 1, redDepth);
+  RBTreeNode* node = list;
+  list = list->right;
+  node->setParent(nullptr);
+  node->left = left;
+  if (left != nullptr) left->setParent(node);
+  node->right = buildBalanced(list, n - leftSize - 1, depth + 1, redDepth);
+  if (node->right != nullptr) node->right->setParent(node);
+  node->setColor(depth == redDepth ? RED : BLACK);
+  updateWeight(node);
+  return node;
+}
+
 /**
  * @brief Удаление элемента из дерева
  * @param key Ключ элемента для удаления
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::remove(const Key& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::remove(const Key& key) {
   RBTreeNode* node = findNode(key);
   if (!node) return;
+  eraseNode(node);
+}
+
+/**
+ * @brief Заменить поддерево с корнем в узле u поддеревом с корнем в узле v
+ * @param u Заменяемый узел
+ * @param v Узел, занимающий место u (может быть nullptr)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::transplant(
+    RBTreeNode* u, RBTreeNode* v) {
+  if (u == root) {
+    root = v;
+    header_.setParent(v);
+  } else if (u == u->getParent()->left) {
+    u->getParent()->left = v;
+  } else {
+    u->getParent()->right = v;
+  }
+  if (v != nullptr) v->setParent(u->getParent());
+}
+
+/**
+ * @brief Удаление узла из дерева
+ * @param node Удаляемый узел
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::eraseNode(
+    RBTreeNode* node) {
+  unlinkNode(node);
+  destroyNode(node);
+}
+
+/**
+ * @brief Отцепить узел от дерева
+ * @param node Отцепляемый узел
+ * @details Узел с двумя потомками заменяется узлом-преемником путем
+ * перестановки связей, элементы узлов не копируются. Если из дерева ушел
+ * черный узел, свойства красно-черного дерева восстанавливаются
+ * fixDoubleBlack за O(log n). Минимум и максимум в заголовке сдвигаются
+ * на соседний узел до перестановки связей, веса поддеревьев пересчитываются
+ * от места, где изменилась структура, до корня
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::unlinkNode(
+    RBTreeNode* node) {
+  RBTreeNode* child = nullptr;
+  RBTreeNode* childParent = node->getParent();
+  Color removedColor = node->getColor();
+  if constexpr (Policy::threaded) linkThreads(node->prev, node->next);
+
+  if (node == header_.left) {
+    header_.left =
+        node->right != nullptr ? GetMin(node->right) : node->getParent();
+  }
+  if (node == header_.right) {
+    header_.right =
+        node->left != nullptr ? GetMax(node->left) : node->getParent();
+  }
+
+  if (node->left == nullptr) {
+    child = node->right;
+    transplant(node, child);
+  } else if (node->right == nullptr) {
+    child = node->left;
+    transplant(node, child);
+  } else {
+    RBTreeNode* successor = GetMin(node->right);
+    removedColor = successor->getColor();
+    child = successor->right;
+    if (successor->getParent() == node) {
+      childParent = successor;
+    } else {
+      childParent = successor->getParent();
+      transplant(successor, successor->right);
+      successor->right = node->right;
+      successor->right->setParent(successor);
+    }
+    transplant(node, successor);
+    successor->left = node->left;
+    successor->left->setParent(successor);
+    successor->setColor(node->getColor());
+  }
+  updateWeightsToRoot(childParent);
+  --tree_size;
 
-  root = RecursiveDelete(root, key);
-  if (root) {
-    root->parent = nullptr;
-    root->color = BLACK;
+  if (removedColor == BLACK) {
+    if (child != nullptr && child->getColor() == RED) {
+      child->setColor(BLACK);
+    } else if (childParent != &header_) {
+      fixDoubleBlack(childParent, child == childParent->left);
+    }
   }
 }
 
@@ -166,22 +702,88 @@ void RBTree<Key, Value>::remove(const Key& key) {
  * @brief Найти узел по ключу
  * @param key Ключ для поиска
  * @return Указатель на найденный узел или nullptr, если узел не найден
- * @details Выполняет бинарный поиск по дереву
+ * @details Спускается к первому узлу с ключом не меньше key, делая одно
+ * сравнение на уровень, и проверяет эквивалентность только с ним
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::findNode(
-    const Key& key) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::findNode(const K& key) const {
+  RBTreeNode* notLess = lowerBoundNode(key);
+  if (notLess != &header_ && !comp_(key, notLess->key())) return notLess;
+  return nullptr;
+}
+
+/**
+ * @brief Найти первый узел с ключом не меньше key
+ * @param key Ключ
+ * @return Узел или заголовок, если все ключи меньше key
+ * @details Одно сравнение на уровень: узел, не меньший key, запоминается как
+ * кандидат, и спуск продолжается влево
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::lowerBoundNode(
+    const K& key) const {
+  RBTreeNode* notLess = GetHeader();
   RBTreeNode* current = root;
   while (current) {
-    if (key < current->key) {
-      current = current->left;
-    } else if (key > current->key) {
+    if (comp_(current->key(), key)) {
       current = current->right;
     } else {
-      return current;
+      notLess = current;
+      current = current->left;
     }
   }
-  return nullptr;
+  return notLess;
+}
+
+/**
+ * @brief Найти первый узел с ключом больше key
+ * @param key Ключ
+ * @return Узел или заголовок, если нет ключей больше key
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::upperBoundNode(
+    const K& key) const {
+  RBTreeNode* greater = GetHeader();
+  RBTreeNode* current = root;
+  while (current) {
+    if (comp_(key, current->key())) {
+      greater = current;
+      current = current->left;
+    } else {
+      current = current->right;
+    }
+  }
+  return greater;
+}
+
+/**
+ * @brief Диапазон узлов с ключом, эквивалентным key
+ * @param key Ключ
+ * @return Пара из первого узла диапазона и узла за ним
+ * @details Ключи дерева уникальны, поэтому верхняя граница - либо следующий
+ * за найденным узел, либо сама нижняя граница
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*,
+          typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*>
+RBTree<Key, Value, Compare, Allocator, Policy>::equalRangeNodes(
+    const K& key) const {
+  RBTreeNode* first = lowerBoundNode(key);
+  if (first != &header_ && !comp_(key, first->key())) {
+    return {first, nextNode(first)};
+  }
+  return {first, first};
 }
 
 /**
@@ -190,9 +792,10 @@ typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::findNode(
  * @return Указатель на узел с минимальным ключом
  * @details Идет по левым потомкам до конца
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::GetMin(
-    RBTreeNode* node) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::GetMin(RBTreeNode* node) const {
   while (node != nullptr && node->left != nullptr) {
     node = node->left;
   }
@@ -200,50 +803,18 @@ typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::GetMin(
 }
 
 /**
- * @brief Рекурсивное удаление узла по ключу
- * @param node Текущий узел
- * @param key Ключ для удаления
- * @return Указатель на новый корень поддерева после удаления
- * @details Выполняет рекурсивный поиск и удаление узла, сохраняя свойства
- * дерева
+ * @brief Получить максимальный узел в поддереве
+ * @param node Корень поддерева
+ * @return Указатель на узел с максимальным ключом
+ * @details Идет по правым потомкам до конца
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::RecursiveDelete(
-    RBTreeNode* node, const Key& key) {
-  if (node == nullptr) return nullptr;
-
-  if (key < node->key) {
-    node->left = RecursiveDelete(node->left, key);
-    if (node->left) node->left->parent = node;
-  } else if (key > node->key) {
-    node->right = RecursiveDelete(node->right, key);
-    if (node->right) node->right->parent = node;
-  } else {
-    if (node->left == nullptr && node->right == nullptr) {
-      delete node;
-      --tree_size;
-      return nullptr;
-    } else if (node->left == nullptr) {
-      RBTreeNode* temp = node->right;
-      if (temp) temp->parent = node->parent;
-      delete node;
-      --tree_size;
-      return temp;
-    } else if (node->right == nullptr) {
-      RBTreeNode* temp = node->left;
-      if (temp) temp->parent = node->parent;
-      delete node;
-      --tree_size;
-      return temp;
-    }
-
-    RBTreeNode* successor = GetMin(node->right);
-    node->key = successor->key;
-    node->value = successor->value;
-    node->right = RecursiveDelete(node->right, successor->key);
-    if (node->right) node->right->parent = node;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::GetMax(RBTreeNode* node) const {
+  while (node != nullptr && node->right != nullptr) {
+    node = node->right;
   }
-
   return node;
 }
 
@@ -251,33 +822,41 @@ typename RBTree<Key, Value>::RBTreeNode* RBTree<Key, Value>::RecursiveDelete(
  * @brief Исправление двойного черного узла
  * @param parent Родительский узел
  * @param isLeftChild Флаг, указывающий является ли узел левым потомком
- * @details Восстанавливает свойства красно-черного дерева после удаления узла
- */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::fixDoubleBlack(RBTreeNode* parent, bool isLeftChild) {
-  RBTreeNode* sibling = isLeftChild ? parent->right : parent->left;
-  if (!sibling) return;
-
-  if (sibling->color == RED) {
-    parent->color = RED;
-    sibling->color = BLACK;
-    isLeftChild ? leftRotate(parent) : rightRotate(parent);
-    fixDoubleBlack(parent, isLeftChild);
-  } else {
-    bool hasRedChild = (sibling->left && sibling->left->color == RED) ||
-                       (sibling->right && sibling->right->color == RED);
+ * @details Восстанавливает свойства красно-черного дерева после удаления узла.
+ * Лишняя черная единица поднимается вверх по дереву в цикле, поэтому
+ * выполняется не более O(log n) перекрашиваний и не более трех поворотов
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::fixDoubleBlack(
+    RBTreeNode* parent, bool isLeftChild) {
+  RBTreeNode* node = isLeftChild ? parent->left : parent->right;
+
+  while (parent != &header_ && (node == nullptr || node->getColor() == BLACK)) {
+    RBTreeNode* sibling = isLeftChild ? parent->right : parent->left;
+    if (sibling->getColor() == RED) {
+      sibling->setColor(BLACK);
+      parent->setColor(RED);
+      isLeftChild ? leftRotate(parent) : rightRotate(parent);
+      sibling = isLeftChild ? parent->right : parent->left;
+    }
+
+    bool hasRedChild = (sibling->left && sibling->left->getColor() == RED) ||
+                       (sibling->right && sibling->right->getColor() == RED);
 
     if (hasRedChild) {
       handleRedSiblingChild(parent, isLeftChild, sibling);
+      node = root;
+      parent = &header_;
     } else {
-      sibling->color = RED;
-      if (parent->color == BLACK && parent != root) {
-        bool parentIsLeft = parent->parent->left == parent;
-        fixDoubleBlack(parent->parent, parentIsLeft);
-      }
-      parent->color = BLACK;
+      sibling->setColor(RED);
+      node = parent;
+      parent = node->getParent();
+      if (parent != &header_) isLeftChild = node == parent->left;
     }
   }
+
+  if (node != nullptr) node->setColor(BLACK);
 }
 
 /**
@@ -285,34 +864,36 @@ void RBTree<Key, Value>::fixDoubleBlack(RBTreeNode* parent, bool isLeftChild) {
  * @param parent Родительский узел
  * @param isLeftChild Флаг, указывающий является ли узел левым потомком
  * @param sibling Братский узел
- * @details Выполняет необходимые повороты и перекрашивания для восстановления
- * свойств дерева
+ * @details Если красный потомок брата ближний, он сначала поворотом
+ * становится братом. Затем поворот вокруг родителя снимает двойную черноту
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::handleRedSiblingChild(RBTreeNode* parent,
-                                               bool isLeftChild,
-                                               RBTreeNode* sibling) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::handleRedSiblingChild(
+    RBTreeNode* parent, bool isLeftChild, RBTreeNode* sibling) {
   if (isLeftChild) {
-    if (sibling->right && sibling->right->color == RED) {
-      sibling->right->color = BLACK;
-      leftRotate(parent);
-    } else {
-      sibling->left->color = BLACK;
+    if (sibling->right == nullptr || sibling->right->getColor() == BLACK) {
+      sibling->left->setColor(BLACK);
+      sibling->setColor(RED);
       rightRotate(sibling);
-      leftRotate(parent);
+      sibling = parent->right;
     }
+    sibling->setColor(parent->getColor());
+    parent->setColor(BLACK);
+    sibling->right->setColor(BLACK);
+    leftRotate(parent);
   } else {
-    if (sibling->left && sibling->left->color == RED) {
-      sibling->left->color = BLACK;
-      rightRotate(parent);
-    } else {
-      sibling->right->color = BLACK;
+    if (sibling->left == nullptr || sibling->left->getColor() == BLACK) {
+      sibling->right->setColor(BLACK);
+      sibling->setColor(RED);
       leftRotate(sibling);
-      rightRotate(parent);
+      sibling = parent->left;
     }
+    sibling->setColor(parent->getColor());
+    parent->setColor(BLACK);
+    sibling->left->setColor(BLACK);
+    rightRotate(parent);
   }
-  sibling->color = parent->color;
-  parent->color = BLACK;
 }
 
 }  // namespace s21
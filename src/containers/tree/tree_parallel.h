@@ -0,0 +1,32 @@
+/**
+ * @file tree_parallel.h
+ * @brief Параллельные операции над деревьями: пул потоков TaskPool и
+ * parallel_union, parallel_intersection, parallel_difference, parallel_insert
+ * @details s21_containers.h объявляет эти методы у RBTree, map и set, но не
+ * подключает потоки. Код, который их вызывает, подключает этот заголовок
+ */
+
+#ifndef TREE_PARALLEL_H
+#define TREE_PARALLEL_H
+
+/**
+ * @defgroup Parallel_headers Стандартные заголовки параллельных операций
+ * @{
+ */
+#include <atomic>  ///< Для std::atomic (пул потоков TaskPool)
+#include <condition_variable>  ///< Для ожидания задач в TaskPool
+#include <deque>  ///< Для очередей задач TaskPool
+#include <exception>  ///< Для std::exception_ptr (исключения задач пула)
+#include <mutex>  ///< Для std::mutex (очереди TaskPool)
+#include <thread>  ///< Для рабочих потоков TaskPool
+#include <vector>  ///< Для рабочих потоков и буферов параллельных операций
+/** @} */
+
+#include "../../s21_containers.h"
+#include "tree_task_pool.h"
+
+// clang-format off
+#include "tree_parallel.tpp"
+// clang-format on
+
+#endif  // TREE_PARALLEL_H
@@ -0,0 +1,294 @@
+/**
+ * @file tree_parallel.tpp
+ * @brief Реализация параллельных операций над множествами для класса RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Объединить дерево с другим, используя пул потоков
+ * @param other Добавляемое дерево
+ * @param pool Пул потоков
+ * @param combine Функтор объединения значений совпавших ключей
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void RBTree<Key, Value, Compare, Allocator, Policy>::parallel_union(
+    RBTree other, TaskPool& pool, Combine combine) {
+  if (!kParallelNodes || pool.size() == 1 ||
+      tree_size + other.tree_size < kParallelCutoff) {
+    set_union(std::move(other), std::move(combine));
+    return;
+  }
+  size_type total = tree_size + other.tree_size;
+  RBTreeNode* theirs = takeNodes(other);
+  size_type duplicates = 0;
+  Subtree joined =
+      parallelUnionNodes({root, blackHeight(root)},
+                         {theirs, blackHeight(theirs)}, combine, duplicates,
+                         pool);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size = total - duplicates;
+}
+
+/**
+ * @brief Пересечь дерево с другим, используя пул потоков
+ * @param other Дерево ключей, которые нужно оставить
+ * @param pool Пул потоков
+ * @param combine Функтор объединения значений совпавших ключей
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void RBTree<Key, Value, Compare, Allocator, Policy>::parallel_intersection(
+    RBTree other, TaskPool& pool, Combine combine) {
+  if (!kParallelNodes || pool.size() == 1 ||
+      tree_size + other.tree_size < kParallelCutoff) {
+    set_intersection(std::move(other), std::move(combine));
+    return;
+  }
+  RBTreeNode* theirs = takeNodes(other);
+  size_type kept = 0;
+  Subtree joined = parallelIntersectNodes({root, blackHeight(root)},
+                                          {theirs, blackHeight(theirs)},
+                                          combine, kept, pool);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size = kept;
+}
+
+/**
+ * @brief Удалить из дерева ключи другого дерева, используя пул потоков
+ * @param other Дерево удаляемых ключей
+ * @param pool Пул потоков
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::parallel_difference(
+    RBTree other, TaskPool& pool) {
+  if (!kParallelNodes || pool.size() == 1 ||
+      tree_size + other.tree_size < kParallelCutoff) {
+    set_difference(std::move(other));
+    return;
+  }
+  RBTreeNode* theirs = takeNodes(other);
+  size_type removed = 0;
+  Subtree joined = parallelDifferenceNodes(
+      {root, blackHeight(root)}, {theirs, blackHeight(theirs)}, removed, pool);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size -= removed;
+}
+
+/**
+ * @brief Вставить диапазон элементов, используя пул потоков
+ * @param first Начало диапазона
+ * @param last Конец диапазона
+ * @param pool Пул потоков
+ * @details Диапазон без произвольного доступа сначала копируется в буфер,
+ * чтобы его можно было делить на части
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename InputIt>
+void RBTree<Key, Value, Compare, Allocator, Policy>::parallel_insert(
+    InputIt first, InputIt last, TaskPool& pool) {
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                  Category>) {
+    size_type count = static_cast<size_type>(last - first);
+    parallel_union(buildParallel(first, count, pool), pool);
+  } else {
+    std::vector<value_type> items(first, last);
+    parallel_insert(items.begin(), items.end(), pool);
+  }
+}
+
+/**
+ * @brief Стоит ли отдавать пулу подзадачу над двумя поддеревьями
+ * @param first Первое поддерево
+ * @param second Второе поддерево
+ * @return true, если оба поддерева не ниже kParallelForkHeight
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::shouldFork(
+    Subtree first, Subtree second) noexcept {
+  return first.height >= kParallelForkHeight &&
+         second.height >= kParallelForkHeight;
+}
+
+/**
+ * @brief Отпустить узлы дерева-исполнителя, не удаляя их
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::releaseNodes() noexcept {
+  attachRoot(nullptr, nullptr, nullptr);
+  tree_size = 0;
+}
+
+/**
+ * @brief Параллельное объединение узлов двух поддеревьев
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево добавляемых узлов
+ * @param combine Функтор объединения значений
+ * @param duplicates Счетчик совпавших ключей
+ * @param pool Пул потоков
+ * @return Объединенное поддерево
+ * @details joinNodes использует корень и заголовок дерева как рабочее место,
+ * поэтому правая половина обрабатывается отдельным деревом-исполнителем.
+ * Узлы половин не пересекаются, и исполнители работают без блокировок
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::parallelUnionNodes(
+    Subtree mine, Subtree theirs, Combine& combine, size_type& duplicates,
+    TaskPool& pool) {
+  if (!shouldFork(mine, theirs)) {
+    return unionNodes(mine, theirs, combine, duplicates);
+  }
+  RBTreeNode* pivot = mine.root;
+  Subtree left = childSubtree(mine, pivot->left);
+  Subtree right = childSubtree(mine, pivot->right);
+  SplitParts parts = splitNodes(theirs, pivot->key());
+  if (parts.equal != nullptr) {
+    combineValues(pivot, parts.equal, combine);
+    destroyNode(parts.equal);
+    ++duplicates;
+  }
+
+  RBTree worker(comp_, get_allocator());
+  size_type rightDuplicates = 0;
+  pool.invoke(
+      [&] {
+        left = parallelUnionNodes(left, parts.less, combine, duplicates, pool);
+      },
+      [&] {
+        right = worker.parallelUnionNodes(right, parts.greater, combine,
+                                          rightDuplicates, pool);
+      });
+  worker.releaseNodes();
+  duplicates += rightDuplicates;
+  return joinNodes(left, pivot, right);
+}
+
+/**
+ * @brief Параллельное пересечение узлов двух поддеревьев
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево ключей, которые нужно оставить
+ * @param combine Функтор объединения значений
+ * @param kept Счетчик оставшихся узлов
+ * @param pool Пул потоков
+ * @return Пересечение
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::parallelIntersectNodes(
+    Subtree mine, Subtree theirs, Combine& combine, size_type& kept,
+    TaskPool& pool) {
+  if (!shouldFork(mine, theirs)) {
+    return intersectNodes(mine, theirs, combine, kept);
+  }
+  RBTreeNode* pivot = mine.root;
+  Subtree left = childSubtree(mine, pivot->left);
+  Subtree right = childSubtree(mine, pivot->right);
+  SplitParts parts = splitNodes(theirs, pivot->key());
+  bool found = parts.equal != nullptr;
+  if (found) {
+    combineValues(pivot, parts.equal, combine);
+    destroyNode(parts.equal);
+  }
+
+  RBTree worker(comp_, get_allocator());
+  size_type rightKept = 0;
+  pool.invoke(
+      [&] {
+        left = parallelIntersectNodes(left, parts.less, combine, kept, pool);
+      },
+      [&] {
+        right = worker.parallelIntersectNodes(right, parts.greater, combine,
+                                              rightKept, pool);
+      });
+  worker.releaseNodes();
+  kept += rightKept;
+  if (!found) {
+    destroyNode(pivot);
+    return joinNodes(left, right);
+  }
+  ++kept;
+  return joinNodes(left, pivot, right);
+}
+
+/**
+ * @brief Параллельная разность узлов двух поддеревьев
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево удаляемых ключей
+ * @param removed Счетчик удаленных узлов
+ * @param pool Пул потоков
+ * @return Разность
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::parallelDifferenceNodes(
+    Subtree mine, Subtree theirs, size_type& removed, TaskPool& pool) {
+  if (!shouldFork(mine, theirs)) {
+    return differenceNodes(mine, theirs, removed);
+  }
+  RBTreeNode* pivot = theirs.root;
+  Subtree left = childSubtree(theirs, pivot->left);
+  Subtree right = childSubtree(theirs, pivot->right);
+  SplitParts parts = splitNodes(mine, pivot->key());
+  if (parts.equal != nullptr) {
+    destroyNode(parts.equal);
+    ++removed;
+  }
+  destroyNode(pivot);
+
+  RBTree worker(comp_, get_allocator());
+  size_type rightRemoved = 0;
+  pool.invoke(
+      [&] {
+        left = parallelDifferenceNodes(parts.less, left, removed, pool);
+      },
+      [&] {
+        right = worker.parallelDifferenceNodes(parts.greater, right,
+                                               rightRemoved, pool);
+      });
+  worker.releaseNodes();
+  removed += rightRemoved;
+  return joinNodes(left, right);
+}
+
+/**
+ * @brief Построить дерево из диапазона, деля его между потоками пула
+ * @param first Начало диапазона
+ * @param count Число элементов
+ * @param pool Пул потоков
+ * @return Дерево с компаратором и аллокатором текущего
+ * @details Левая половина диапазона объединяется с правой так, что при
+ * повторах остается элемент левой половины
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename RandomIt>
+RBTree<Key, Value, Compare, Allocator, Policy>
+RBTree<Key, Value, Compare, Allocator, Policy>::buildParallel(
+    RandomIt first, size_type count, TaskPool& pool) const {
+  if (!kParallelNodes || pool.size() == 1 || count < kParallelCutoff) {
+    return RBTree(first, first + count, comp_, get_allocator());
+  }
+  size_type half = count / 2;
+  RBTree left(comp_, get_allocator());
+  RBTree right(comp_, get_allocator());
+  pool.invoke([&] { left = buildParallel(first, half, pool); },
+              [&] { right = buildParallel(first + half, count - half, pool); });
+  left.parallel_union(std::move(right), pool);
+  return left;
+}
+
+}  // namespace s21
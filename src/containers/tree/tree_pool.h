@@ -0,0 +1,228 @@
+/**
+ * @file tree_pool.h
+ * @brief Хранилища памяти для узлов красно-черного дерева
+ */
+
+#ifndef TREE_POOL_H
+#define TREE_POOL_H
+
+namespace s21 {
+
+/**
+ * @brief Хранилище узлов на аллокаторе контейнера
+ * @details Каждый узел выделяется и освобождается отдельно через аллокатор,
+ * перепривязанный к типу узла
+ * @tparam Node Тип узла
+ * @tparam Allocator Аллокатор элементов контейнера
+ */
+template <typename Node, typename Allocator>
+class HeapNodeStorage {
+ public:
+  /// @brief Аллокатор, перепривязанный к типу узла
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  /// @brief Освобождает ли хранилище все узлы разом
+  static constexpr bool kBulkRelease = false;
+
+  /**
+   * @brief Конструктор
+   * @param alloc Аллокатор элементов контейнера
+   */
+  explicit HeapNodeStorage(const Allocator& alloc = Allocator())
+      : alloc_(alloc) {}
+
+  HeapNodeStorage(const HeapNodeStorage&) = delete;
+  HeapNodeStorage& operator=(const HeapNodeStorage&) = delete;
+  HeapNodeStorage(HeapNodeStorage&& other) noexcept = default;
+
+  /**
+   * @brief Оператор присваивания перемещением
+   * @details Аллокатор переносится, только если этого требует
+   * propagate_on_container_move_assignment
+   * @param other Хранилище, узлы которого переходят к текущему
+   * @return Ссылка на текущее хранилище
+   */
+  HeapNodeStorage& operator=(HeapNodeStorage&& other) noexcept;
+
+  /**
+   * @brief Выделить память под один узел
+   * @return Указатель на неинициализированную память
+   */
+  void* allocate();
+
+  /**
+   * @brief Освободить память узла
+   * @param memory Память, полученная из allocate()
+   */
+  void deallocate(void* memory) noexcept;
+
+  /**
+   * @brief Освободить всю память хранилища (ничего не делает)
+   */
+  void release() noexcept {}
+
+  /**
+   * @brief Обменять содержимое с другим хранилищем
+   * @details Аллокаторы обмениваются, только если этого требует
+   * propagate_on_container_swap
+   * @param other Хранилище для обмена
+   */
+  void swap(HeapNodeStorage& other) noexcept;
+
+  /**
+   * @brief Аллокатор хранилища
+   * @return Копия аллокатора узлов
+   */
+  const NodeAllocator& get_allocator() const noexcept { return alloc_; }
+
+  /**
+   * @brief Заменить аллокатор (хранилище должно быть пустым)
+   * @param alloc Новый аллокатор
+   */
+  void set_allocator(const NodeAllocator& alloc) { alloc_ = alloc; }
+
+ private:
+  NodeAllocator alloc_;  ///< Аллокатор узлов
+};
+
+/**
+ * @brief Пул узлов на основе слэбов
+ * @details Память выделяется крупными блоками (слэбами) через аллокатор
+ * контейнера, размер слэба растет вдвое до kMaxSlabNodes. Освобожденные узлы
+ * попадают в интрузивный список свободных блоков и переиспользуются. Весь
+ * пул освобождается за время, пропорциональное числу слэбов, а не узлов.
+ * @tparam Node Тип узла
+ * @tparam Allocator Аллокатор элементов контейнера
+ */
+template <typename Node, typename Allocator>
+class NodePool {
+  union Block;
+
+ public:
+  /// @brief Аллокатор, перепривязанный к блоку пула
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  /// @brief Освобождает ли хранилище все узлы разом
+  static constexpr bool kBulkRelease = true;
+  /// @brief Число узлов в первом слэбе
+  static constexpr size_t kMinSlabNodes = 32;
+  /// @brief Максимальное число узлов в одном слэбе
+  static constexpr size_t kMaxSlabNodes = 4096;
+
+  /**
+   * @brief Конструктор
+   * @param alloc Аллокатор, из которого выделяются слэбы
+   */
+  explicit NodePool(const Allocator& alloc = Allocator()) : alloc_(alloc) {}
+
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+
+  /**
+   * @brief Конструктор перемещения
+   * @param other Пул, слэбы и аллокатор которого переходят к новому пулу
+   */
+  NodePool(NodePool&& other) noexcept;
+
+  /**
+   * @brief Оператор присваивания перемещением
+   * @details Аллокатор переносится, только если этого требует
+   * propagate_on_container_move_assignment
+   * @param other Пул, слэбы которого переходят к текущему
+   * @return Ссылка на текущий пул
+   */
+  NodePool& operator=(NodePool&& other) noexcept;
+
+  /**
+   * @brief Деструктор
+   * @details Освобождает все слэбы пула
+   */
+  ~NodePool() { release(); }
+
+  /**
+   * @brief Выделить память под один узел
+   * @return Указатель на неинициализированную память
+   * @details Берет блок из списка свободных, иначе из текущего слэба
+   */
+  void* allocate();
+
+  /**
+   * @brief Вернуть память узла в пул
+   * @param memory Память, полученная из allocate()
+   */
+  void deallocate(void* memory) noexcept;
+
+  /**
+   * @brief Освободить все слэбы разом
+   * @details Объекты в памяти пула к этому моменту должны быть разрушены
+   */
+  void release() noexcept;
+
+  /**
+   * @brief Обменять содержимое с другим пулом
+   * @details Аллокаторы обмениваются, только если этого требует
+   * propagate_on_container_swap
+   * @param other Пул для обмена
+   */
+  void swap(NodePool& other) noexcept;
+
+  /**
+   * @brief Аллокатор пула
+   * @return Аллокатор, из которого выделяются слэбы
+   */
+  const NodeAllocator& get_allocator() const noexcept { return alloc_; }
+
+  /**
+   * @brief Заменить аллокатор (пул должен быть пустым)
+   * @param alloc Новый аллокатор
+   */
+  void set_allocator(const NodeAllocator& alloc) { alloc_ = alloc; }
+
+ private:
+  /**
+   * @brief Заголовок слэба, хранится в его нулевом блоке
+   */
+  struct SlabHeader {
+    Block* previous;  ///< Предыдущий выделенный слэб
+    size_t blocks;    ///< Число блоков в слэбе вместе с заголовком
+  };
+
+  /**
+   * @brief Блок памяти под один узел
+   * @details Свободный блок хранит указатель на следующий свободный блок.
+   * Нулевой блок каждого слэба хранит заголовок слэба
+   */
+  union Block {
+    Block* next;
+    SlabHeader slab;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  /**
+   * @brief Выделить новый слэб и сделать его текущим
+   */
+  void grow();
+
+  /**
+   * @brief Забрать слэбы другого пула, оставив его пустым
+   * @param other Пул-источник
+   */
+  void steal(NodePool& other) noexcept;
+
+  NodeAllocator alloc_;         ///< Аллокатор слэбов
+  Block* free_list_ = nullptr;  ///< Список свободных блоков
+  Block* slabs_ = nullptr;      ///< Последний выделенный слэб
+  Block* cursor_ = nullptr;     ///< Первый нетронутый блок текущего слэба
+  Block* slab_end_ = nullptr;   ///< Конец текущего слэба
+  size_t next_slab_nodes_ = kMinSlabNodes;  ///< Размер следующего слэба
+};
+
+}  // namespace s21
+
+#include "tree_pool.tpp"
+
+#endif  // TREE_POOL_H
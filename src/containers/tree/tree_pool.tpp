@@ -0,0 +1,168 @@
+/**
+ * @file tree_pool.tpp
+ * @brief Реализация хранилищ памяти для узлов красно-черного дерева
+ */
+
+namespace s21 {
+
+// === HeapNodeStorage ===
+
+/**
+ * @brief Оператор присваивания перемещением
+ * @param other Хранилище, узлы которого переходят к текущему
+ * @return Ссылка на текущее хранилище
+ */
+template <typename Node, typename Allocator>
+HeapNodeStorage<Node, Allocator>& HeapNodeStorage<Node, Allocator>::operator=(
+    HeapNodeStorage&& other) noexcept {
+  if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(other.alloc_);
+  }
+  return *this;
+}
+
+/**
+ * @brief Выделить память под один узел через аллокатор
+ * @return Указатель на неинициализированную память
+ */
+template <typename Node, typename Allocator>
+void* HeapNodeStorage<Node, Allocator>::allocate() {
+  return std::addressof(*NodeTraits::allocate(alloc_, 1));
+}
+
+/**
+ * @brief Освободить память узла
+ * @param memory Память, полученная из allocate()
+ */
+template <typename Node, typename Allocator>
+void HeapNodeStorage<Node, Allocator>::deallocate(void* memory) noexcept {
+  NodeTraits::deallocate(alloc_, static_cast<Node*>(memory), 1);
+}
+
+/**
+ * @brief Обменять содержимое с другим хранилищем
+ * @param other Хранилище для обмена
+ */
+template <typename Node, typename Allocator>
+void HeapNodeStorage<Node, Allocator>::swap(HeapNodeStorage& other) noexcept {
+  if constexpr (NodeTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+}
+
+// === NodePool ===
+
+/**
+ * @brief Конструктор перемещения
+ * @param other Пул, слэбы и аллокатор которого переходят к новому пулу
+ */
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>::NodePool(NodePool&& other) noexcept
+    : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+/**
+ * @brief Оператор присваивания перемещением
+ * @param other Пул, слэбы которого переходят к текущему
+ * @return Ссылка на текущий пул
+ */
+template <typename Node, typename Allocator>
+NodePool<Node, Allocator>& NodePool<Node, Allocator>::operator=(
+    NodePool&& other) noexcept {
+  if (this != &other) {
+    release();
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(other.alloc_);
+    }
+    steal(other);
+  }
+  return *this;
+}
+
+/**
+ * @brief Выделить память под один узел
+ * @return Указатель на неинициализированную память
+ */
+template <typename Node, typename Allocator>
+void* NodePool<Node, Allocator>::allocate() {
+  if (free_list_ != nullptr) {
+    Block* block = free_list_;
+    free_list_ = block->next;
+    return block->storage;
+  }
+  if (cursor_ == slab_end_) grow();
+  return (cursor_++)->storage;
+}
+
+/**
+ * @brief Вернуть память узла в пул
+ * @param memory Память, полученная из allocate()
+ */
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::deallocate(void* memory) noexcept {
+  Block* block = static_cast<Block*>(memory);
+  block->next = free_list_;
+  free_list_ = block;
+}
+
+/**
+ * @brief Освободить все слэбы разом
+ */
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::release() noexcept {
+  while (slabs_ != nullptr) {
+    SlabHeader header = slabs_->slab;
+    NodeTraits::deallocate(alloc_, slabs_, header.blocks);
+    slabs_ = header.previous;
+  }
+  free_list_ = cursor_ = slab_end_ = nullptr;
+  next_slab_nodes_ = kMinSlabNodes;
+}
+
+/**
+ * @brief Обменять содержимое с другим пулом
+ * @param other Пул для обмена
+ */
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::swap(NodePool& other) noexcept {
+  if constexpr (NodeTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(free_list_, other.free_list_);
+  std::swap(slabs_, other.slabs_);
+  std::swap(cursor_, other.cursor_);
+  std::swap(slab_end_, other.slab_end_);
+  std::swap(next_slab_nodes_, other.next_slab_nodes_);
+}
+
+/**
+ * @brief Выделить новый слэб и сделать его текущим
+ * @details Нулевой блок слэба хранит заголовок, остальные блоки раздаются по
+ * порядку
+ */
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::grow() {
+  size_t blocks = next_slab_nodes_ + 1;
+  Block* slab = std::addressof(*NodeTraits::allocate(alloc_, blocks));
+  slab->slab = SlabHeader{slabs_, blocks};
+  slabs_ = slab;
+  cursor_ = slab + 1;
+  slab_end_ = slab + blocks;
+  if (next_slab_nodes_ < kMaxSlabNodes) next_slab_nodes_ *= 2;
+}
+
+/**
+ * @brief Забрать слэбы другого пула, оставив его пустым
+ * @param other Пул-источник
+ */
+template <typename Node, typename Allocator>
+void NodePool<Node, Allocator>::steal(NodePool& other) noexcept {
+  free_list_ = std::exchange(other.free_list_, nullptr);
+  slabs_ = std::exchange(other.slabs_, nullptr);
+  cursor_ = std::exchange(other.cursor_, nullptr);
+  slab_end_ = std::exchange(other.slab_end_, nullptr);
+  next_slab_nodes_ = std::exchange(other.next_slab_nodes_, kMinSlabNodes);
+}
+
+}  // namespace s21
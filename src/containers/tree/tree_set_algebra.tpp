@@ -0,0 +1,195 @@
+/**
+ * @file tree_set_algebra.tpp
+ * @brief Реализация объединения, пересечения и разности деревьев для класса
+ * RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Объединить дерево с другим
+ * @param other Добавляемое дерево
+ * @param combine Функтор объединения значений совпавших ключей
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void RBTree<Key, Value, Compare, Allocator, Policy>::set_union(
+    RBTree other, Combine combine) {
+  if (other.root == nullptr) return;
+  size_type total = tree_size + other.tree_size;
+  RBTreeNode* theirs = takeNodes(other);
+  size_type duplicates = 0;
+  Subtree joined = unionNodes({root, blackHeight(root)},
+                              {theirs, blackHeight(theirs)}, combine,
+                              duplicates);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size = total - duplicates;
+}
+
+/**
+ * @brief Оставить в дереве только ключи, которые есть в other
+ * @param other Дерево ключей, которые нужно оставить
+ * @param combine Функтор объединения значений совпавших ключей
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void RBTree<Key, Value, Compare, Allocator, Policy>::set_intersection(
+    RBTree other, Combine combine) {
+  if (root == nullptr) return;
+  RBTreeNode* theirs = takeNodes(other);
+  size_type kept = 0;
+  Subtree joined = intersectNodes({root, blackHeight(root)},
+                                  {theirs, blackHeight(theirs)}, combine,
+                                  kept);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size = kept;
+}
+
+/**
+ * @brief Удалить из дерева ключи, которые есть в other
+ * @param other Дерево удаляемых ключей
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::set_difference(
+    RBTree other) {
+  if (root == nullptr || other.root == nullptr) return;
+  RBTreeNode* theirs = takeNodes(other);
+  size_type removed = 0;
+  Subtree joined = differenceNodes({root, blackHeight(root)},
+                                   {theirs, blackHeight(theirs)}, removed);
+  attachRoot(joined.root, GetMin(joined.root), GetMax(joined.root));
+  tree_size -= removed;
+}
+
+/**
+ * @brief Объединить узлы двух поддеревьев
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево добавляемых узлов
+ * @param combine Функтор объединения значений
+ * @param duplicates Счетчик совпавших ключей
+ * @return Объединенное поддерево
+ * @details Корень mine делит theirs по своему ключу, совпавший узел theirs
+ * удаляется. Когда одно из поддеревьев пусто, другое возвращается целиком,
+ * поэтому узлы большого дерева вдали от ключей малого не посещаются
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::unionNodes(
+    Subtree mine, Subtree theirs, Combine& combine, size_type& duplicates) {
+  if (theirs.root == nullptr) return mine;
+  if (mine.root == nullptr) return theirs;
+  RBTreeNode* pivot = mine.root;
+  Subtree left = childSubtree(mine, pivot->left);
+  Subtree right = childSubtree(mine, pivot->right);
+  SplitParts parts = splitNodes(theirs, pivot->key());
+  if (parts.equal != nullptr) {
+    combineValues(pivot, parts.equal, combine);
+    destroyNode(parts.equal);
+    ++duplicates;
+  }
+  left = unionNodes(left, parts.less, combine, duplicates);
+  right = unionNodes(right, parts.greater, combine, duplicates);
+  return joinNodes(left, pivot, right);
+}
+
+/**
+ * @brief Пересечь узлы двух поддеревьев
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево ключей, которые нужно оставить
+ * @param combine Функтор объединения значений
+ * @param kept Счетчик оставшихся узлов
+ * @return Пересечение
+ * @details Корень mine остается опорным узлом, только если его ключ найден
+ * в theirs, иначе половины соединяются без него
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::intersectNodes(
+    Subtree mine, Subtree theirs, Combine& combine, size_type& kept) {
+  if (mine.root == nullptr || theirs.root == nullptr) {
+    deleteSubtree(mine.root);
+    deleteSubtree(theirs.root);
+    return {nullptr, 0};
+  }
+  RBTreeNode* pivot = mine.root;
+  Subtree left = childSubtree(mine, pivot->left);
+  Subtree right = childSubtree(mine, pivot->right);
+  SplitParts parts = splitNodes(theirs, pivot->key());
+  bool found = parts.equal != nullptr;
+  if (found) {
+    combineValues(pivot, parts.equal, combine);
+    destroyNode(parts.equal);
+  }
+  left = intersectNodes(left, parts.less, combine, kept);
+  right = intersectNodes(right, parts.greater, combine, kept);
+  if (!found) {
+    destroyNode(pivot);
+    return joinNodes(left, right);
+  }
+  ++kept;
+  return joinNodes(left, pivot, right);
+}
+
+/**
+ * @brief Удалить из поддерева ключи другого поддерева
+ * @param mine Поддерево текущего дерева
+ * @param theirs Поддерево удаляемых ключей
+ * @param removed Счетчик удаленных узлов
+ * @return Разность
+ * @details Рекурсия идет по узлам theirs: его корень делит mine по своему
+ * ключу, поэтому стоимость определяется размером удаляемого дерева
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Subtree
+RBTree<Key, Value, Compare, Allocator, Policy>::differenceNodes(
+    Subtree mine, Subtree theirs, size_type& removed) {
+  if (mine.root == nullptr || theirs.root == nullptr) {
+    deleteSubtree(theirs.root);
+    return mine;
+  }
+  RBTreeNode* pivot = theirs.root;
+  Subtree left = childSubtree(theirs, pivot->left);
+  Subtree right = childSubtree(theirs, pivot->right);
+  SplitParts parts = splitNodes(mine, pivot->key());
+  if (parts.equal != nullptr) {
+    destroyNode(parts.equal);
+    ++removed;
+  }
+  destroyNode(pivot);
+  left = differenceNodes(parts.less, left, removed);
+  right = differenceNodes(parts.greater, right, removed);
+  return joinNodes(left, right);
+}
+
+/**
+ * @brief Записать в узел дерева результат объединения значений
+ * @param ours Остающийся узел
+ * @param theirs Совпавший узел другого дерева
+ * @param combine Функтор объединения значений
+ * @details У множества значения нет, а функтор по умолчанию оставляет
+ * значение дерева, в этих случаях узел не меняется
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Combine>
+void RBTree<Key, Value, Compare, Allocator, Policy>::combineValues(
+    RBTreeNode* ours, const RBTreeNode* theirs, Combine& combine) {
+  if constexpr (!std::is_void_v<Value> &&
+                !std::is_same_v<Combine, KeepExistingValue>) {
+    ours->value() = combine(std::as_const(ours->value()), theirs->value());
+  } else {
+    static_cast<void>(ours);
+    static_cast<void>(theirs);
+    static_cast<void>(combine);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,225 @@
+/**
+ * @file tree_statistics.tpp
+ * @brief Реализация порядковой статистики для класса RBTree
+ */
+
+namespace s21 {
+
+/**
+ * @brief Вес поддерева
+ * @param node Корень поддерева (может быть nullptr)
+ * @return Суммарный вес элементов поддерева, 0 без порядковой статистики
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::subtreeWeight(
+    const RBTreeNode* node) noexcept {
+  if constexpr (Policy::order_statistics) {
+    return node != nullptr ? node->subtree_weight : 0;
+  } else {
+    return 0;
+  }
+}
+
+/**
+ * @brief Пересчитать вес поддерева узла
+ * @param node Узел с корректными весами потомков
+ * @details Без порядковой статистики ничего не делает, поэтому повороты и
+ * вставка обычного дерева не платят за поддержку весов
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::updateWeight(
+    RBTreeNode* node) noexcept {
+  if constexpr (Policy::order_statistics) {
+    node->subtree_weight = Policy::element_weight(node->data) +
+                           subtreeWeight(node->left) +
+                           subtreeWeight(node->right);
+  }
+}
+
+/**
+ * @brief Пересчитать веса на пути от узла до корня
+ * @param node Нижний измененный узел
+ * @details Все узлы, чьи поддеревья изменились при вставке или удалении,
+ * лежат на этом пути, поэтому хватает O(log n) пересчетов
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::updateWeightsToRoot(
+    RBTreeNode* node) noexcept {
+  if constexpr (Policy::order_statistics) {
+    for (; node != &header_; node = node->getParent()) updateWeight(node);
+  }
+}
+
+/**
+ * @brief Позиция узла в порядке обхода
+ * @param node Узел или заголовок дерева
+ * @return Суммарный вес элементов перед узлом
+ * @details Подъем к корню: каждый раз, когда узел оказывается правым
+ * потомком, к позиции добавляются родитель и его левое поддерево. Заголовок
+ * узнается так же, как в prevNode, у пустого дерева у него нет родителя
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::indexOf(
+    const RBTreeNode* node) noexcept {
+  if (node->getParent() == nullptr) return 0;
+  if (node->getColor() == RED && node->getParent()->getParent() == node) {
+    return subtreeWeight(node->getParent());
+  }
+  size_type index = subtreeWeight(node->left);
+  while (node->getParent()->getParent() != node) {
+    const RBTreeNode* parent = node->getParent();
+    if (node == parent->right) {
+      index += subtreeWeight(parent->left) +
+               Policy::element_weight(parent->data);
+    }
+    node = parent;
+  }
+  return index;
+}
+
+/**
+ * @brief Найти узел, содержащий k-й по порядку элемент
+ * @param k Номер элемента, начиная с 0
+ * @return Узел или заголовок, если k не меньше веса дерева
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::selectNode(
+    size_type k) const noexcept {
+  RBTreeNode* node = root;
+  while (node != nullptr) {
+    size_type leftWeight = subtreeWeight(node->left);
+    if (k < leftWeight) {
+      node = node->left;
+      continue;
+    }
+    k -= leftWeight;
+    size_type weight = Policy::element_weight(node->data);
+    if (k < weight) return node;
+    k -= weight;
+    node = node->right;
+  }
+  return GetHeader();
+}
+
+/**
+ * @brief Найти k-й по порядку элемент
+ * @param k Номер элемента, начиная с 0
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::nth(size_type k) {
+  static_assert(Policy::order_statistics,
+                "nth() requires a policy with order_statistics");
+  return Iterator(selectNode(k));
+}
+
+/**
+ * @brief Найти k-й по порядку элемент (константный)
+ * @param k Номер элемента, начиная с 0
+ * @return Константный итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::nth(size_type k) const {
+  static_assert(Policy::order_statistics,
+                "nth() requires a policy with order_statistics");
+  return ConstIterator(selectNode(k));
+}
+
+/**
+ * @brief Количество элементов с ключом меньше key
+ * @param key Ключ
+ * @return Суммарный вес элементов, строго меньших key
+ * @details Каждый раз, когда спуск уходит вправо, узел и его левое поддерево
+ * меньше key и добавляются к результату
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::rank(const Key& key) const {
+  static_assert(Policy::order_statistics,
+                "rank() requires a policy with order_statistics");
+  size_type result = 0;
+  for (RBTreeNode* node = root; node != nullptr;) {
+    if (comp_(node->key(), key)) {
+      result += subtreeWeight(node->left) + Policy::element_weight(node->data);
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Пересчитать веса после изменения веса элемента
+ * @param pos Итератор на измененный элемент
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::update_weight(
+    Iterator pos) noexcept {
+  updateWeightsToRoot(pos.iter_node_);
+}
+
+/**
+ * @brief Расстояние между итераторами
+ * @param other Итератор того же дерева
+ * @return Разность позиций текущего итератора и other
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::
+    difference_type
+    RBTree<Key, Value, Compare, Allocator, Policy>::Iterator::operator-(
+        const Iterator& other) const {
+  static_assert(Policy::order_statistics,
+                "iterator difference requires a policy with order_statistics");
+  return static_cast<difference_type>(indexOf(iter_node_)) -
+         static_cast<difference_type>(indexOf(other.iter_node_));
+}
+
+/**
+ * @brief Расстояние между итераторами множества
+ * @param other Итератор того же дерева
+ * @return Разность позиций текущего итератора и other
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+std::ptrdiff_t
+RBTree<Key, Value, Compare, Allocator, Policy>::SetIterator::operator-(
+    const SetIterator& other) const {
+  static_assert(Policy::order_statistics,
+                "iterator difference requires a policy with order_statistics");
+  return static_cast<std::ptrdiff_t>(indexOf(node_)) -
+         static_cast<std::ptrdiff_t>(indexOf(other.node_));
+}
+
+/**
+ * @brief Расстояние между константными итераторами множества
+ * @param other Итератор того же дерева
+ * @return Разность позиций текущего итератора и other
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+std::ptrdiff_t
+RBTree<Key, Value, Compare, Allocator, Policy>::SetConstIterator::operator-(
+    const SetConstIterator& other) const {
+  static_assert(Policy::order_statistics,
+                "iterator difference requires a policy with order_statistics");
+  return static_cast<std::ptrdiff_t>(indexOf(node_)) -
+         static_cast<std::ptrdiff_t>(indexOf(other.node_));
+}
+
+}  // namespace s21
@@ -0,0 +1,123 @@
+/**
+ * @file tree_task_pool.h
+ * @brief Пул потоков с перехватом задач для параллельных операций над
+ * деревьями
+ */
+
+#ifndef TREE_TASK_POOL_H
+#define TREE_TASK_POOL_H
+
+namespace s21 {
+
+/**
+ * @brief Пул потоков с перехватом задач (work stealing) для fork-join
+ * @details У каждого рабочего потока своя очередь: свои задачи он берет с
+ * конца (последняя созданная задача - самая "горячая"), а чужие перехватывает
+ * с начала, где лежат крупные подзадачи верхних уровней рекурсии. Потоки вне
+ * пула кладут задачи в общую нулевую очередь. Поток, ожидающий задачу, не
+ * засыпает, а выполняет другие задачи, поэтому вложенные invoke не блокируют
+ * пул
+ */
+class TaskPool {
+ public:
+  /**
+   * @brief Конструктор
+   * @param threads Общее число потоков вместе с вызывающим: создается
+   * threads - 1 рабочих потоков. При threads <= 1 задачи выполняются
+   * последовательно в вызывающем потоке
+   */
+  explicit TaskPool(size_t threads = std::thread::hardware_concurrency());
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  /**
+   * @brief Деструктор
+   * @details Дожидается завершения рабочих потоков
+   */
+  ~TaskPool();
+
+  /**
+   * @brief Число потоков вместе с вызывающим
+   * @return Число потоков
+   */
+  size_t size() const noexcept { return workers_.size() + 1; }
+
+  /**
+   * @brief Выполнить две функции, возможно параллельно
+   * @details second становится задачей, которую может перехватить другой
+   * поток, first выполняется сразу. Исключение любой из функций
+   * пробрасывается после завершения обеих
+   * @param first Функция, выполняемая в текущем потоке
+   * @param second Функция, отдаваемая пулу
+   */
+  template <typename First, typename Second>
+  void invoke(First&& first, Second&& second);
+
+ private:
+  /**
+   * @brief Задача пула, живет в кадре стека invoke до своего завершения
+   */
+  struct Task {
+    std::function<void()> run;      ///< Тело задачи
+    std::atomic<bool> done{false};  ///< Задача выполнена
+    std::exception_ptr error;       ///< Исключение, выброшенное задачей
+  };
+
+  /**
+   * @brief Очередь задач одного потока
+   */
+  struct Queue {
+    std::mutex mutex;         ///< Защищает tasks
+    std::deque<Task*> tasks;  ///< Задачи: свои с конца, чужие с начала
+  };
+
+  /**
+   * @brief Положить задачу в очередь текущего потока и разбудить пул
+   * @param task Задача
+   */
+  void push(Task* task);
+
+  /**
+   * @brief Взять задачу: свою с конца очереди или чужую с начала
+   * @return Задача или nullptr, если очереди пусты
+   */
+  Task* pop();
+
+  /**
+   * @brief Выполнить задачу и отметить ее завершение
+   * @param task Задача
+   */
+  static void execute(Task* task) noexcept;
+
+  /**
+   * @brief Цикл рабочего потока
+   * @param index Номер очереди потока
+   */
+  void workerLoop(size_t index);
+
+  /**
+   * @brief Номер очереди текущего потока
+   * @return Номер очереди рабочего потока или 0 для внешних потоков
+   */
+  size_t currentQueue() const noexcept;
+
+  std::vector<std::thread> workers_;  ///< Рабочие потоки
+  std::unique_ptr<Queue[]> queues_;   ///< Очереди: 0 - внешние потоки
+  size_t queue_count_;                ///< Число очередей
+  std::atomic<size_t> pending_{0};    ///< Число задач в очередях
+  std::mutex sleep_mutex_;            ///< Защищает stop_ и ожидание
+  std::condition_variable wake_;      ///< Будит спящие рабочие потоки
+  bool stop_ = false;                 ///< Пул останавливается
+
+  /// @brief Пул, которому принадлежит текущий поток
+  inline static thread_local const TaskPool* current_pool_ = nullptr;
+  /// @brief Номер очереди текущего рабочего потока
+  inline static thread_local size_t current_index_ = 0;
+};
+
+}  // namespace s21
+
+#include "tree_task_pool.tpp"
+
+#endif  // TREE_TASK_POOL_H
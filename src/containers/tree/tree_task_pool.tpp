@@ -0,0 +1,150 @@
+/**
+ * @file tree_task_pool.tpp
+ * @brief Реализация пула потоков с перехватом задач
+ */
+
+namespace s21 {
+
+/**
+ * @brief Конструктор
+ * @param threads Общее число потоков вместе с вызывающим
+ */
+inline TaskPool::TaskPool(size_t threads)
+    : queues_(new Queue[threads > 1 ? threads : 1]),
+      queue_count_(threads > 1 ? threads : 1) {
+  for (size_t index = 1; index < queue_count_; ++index) {
+    workers_.emplace_back([this, index] { workerLoop(index); });
+  }
+}
+
+/**
+ * @brief Деструктор
+ */
+inline TaskPool::~TaskPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+/**
+ * @brief Выполнить две функции, возможно параллельно
+ * @param first Функция, выполняемая в текущем потоке
+ * @param second Функция, отдаваемая пулу
+ * @details Пока second не выполнена, текущий поток берет задачи из очередей.
+ * Чаще всего первой ему попадается сама second, если ее никто не перехватил
+ */
+template <typename First, typename Second>
+void TaskPool::invoke(First&& first, Second&& second) {
+  if (workers_.empty()) {
+    first();
+    second();
+    return;
+  }
+  Task task;
+  task.run = [&second] { second(); };
+  push(&task);
+
+  std::exception_ptr error;
+  try {
+    first();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  while (!task.done.load(std::memory_order_acquire)) {
+    if (Task* other = pop()) {
+      execute(other);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+  if (task.error) std::rethrow_exception(task.error);
+}
+
+/**
+ * @brief Положить задачу в очередь текущего потока и разбудить пул
+ * @param task Задача
+ */
+inline void TaskPool::push(Task* task) {
+  Queue& queue = queues_[currentQueue()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+  }
+  pending_.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+  }
+  wake_.notify_one();
+}
+
+/**
+ * @brief Взять задачу: свою с конца очереди или чужую с начала
+ * @return Задача или nullptr, если очереди пусты
+ */
+inline TaskPool::Task* TaskPool::pop() {
+  size_t own = currentQueue();
+  for (size_t step = 0; step < queue_count_; ++step) {
+    Queue& queue = queues_[(own + step) % queue_count_];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) continue;
+    Task* task = nullptr;
+    if (step == 0) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Выполнить задачу и отметить ее завершение
+ * @param task Задача
+ */
+inline void TaskPool::execute(Task* task) noexcept {
+  try {
+    task->run();
+  } catch (...) {
+    task->error = std::current_exception();
+  }
+  task->done.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Цикл рабочего потока
+ * @param index Номер очереди потока
+ * @details Поток засыпает, только когда во всех очередях пусто
+ */
+inline void TaskPool::workerLoop(size_t index) {
+  current_pool_ = this;
+  current_index_ = index;
+  while (true) {
+    if (Task* task = pop()) {
+      execute(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] {
+      return stop_ || pending_.load(std::memory_order_acquire) > 0;
+    });
+    if (stop_) return;
+  }
+}
+
+/**
+ * @brief Номер очереди текущего потока
+ * @return Номер очереди рабочего потока или 0 для внешних потоков
+ */
+inline size_t TaskPool::currentQueue() const noexcept {
+  return current_pool_ == this ? current_index_ : 0;
+}
+
+}  // namespace s21
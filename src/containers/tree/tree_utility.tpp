@@ -11,20 +11,22 @@ namespace s21 {
  * @return Константная ссылка на пару ключ-значение
  * @throw std::out_of_range Если ключ не найден
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::const_reference RBTree<Key, Value>::get(
-    const Key& key) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::const_reference
+RBTree<Key, Value, Compare, Allocator, Policy>::get(const Key& key) const {
   RBTreeNode* node = findNode(key);
   if (!node) throw std::out_of_range("Key not found");
-  return node->pair;
+  return node->data;
 }
 
 /**
  * @brief Проверка на пустоту дерева
  * @return true если дерево пустое, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::empty() const noexcept {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::empty() const noexcept {
   return tree_size == 0;
 }
 
@@ -32,87 +34,234 @@ bool RBTree<Key, Value>::empty() const noexcept {
  * @brief Получить количество элементов в дереве
  * @return Количество элементов
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::size_type RBTree<Key, Value>::size()
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::size()
     const noexcept {
   return tree_size;
 }
 
 /**
  * @brief Очистить дерево
+ * @details Если узлы лежат в пуле и элементы не требуют деструктора, обход
+ * дерева не нужен: все слэбы пула освобождаются разом
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::clear() {
-  deleteSubtree(root);
-  root = nullptr;
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::clear() {
+  if constexpr (!NodeStorage::kBulkRelease ||
+                !std::is_trivially_destructible_v<value_type>) {
+    deleteSubtree(root);
+  }
+  nodes_.release();
+  attachRoot(nullptr, nullptr, nullptr);
   tree_size = 0;
 }
 
 /**
  * @brief Удалить поддерево
  * @param node Корень удаляемого поддерева
- * @details Рекурсивно удаляет все узлы в поддереве
- */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::deleteSubtree(RBTreeNode* node) {
-  if (node) {
-    deleteSubtree(node->left);
-    deleteSubtree(node->right);
-    delete node;
+ * @return Количество удаленных узлов
+ * @details Рекурсии нет: пока у узла есть левый потомок, правый поворот
+ * поднимает его наверх, иначе узел удаляется и обход переходит к правому
+ * потомку. Каждый поворот уменьшает длину левого края на один, поэтому
+ * удаление занимает O(n) без дополнительной памяти при любой глубине
+ * дерева и не опирается на указатели на родителя
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::deleteSubtree(
+    RBTreeNode* node) noexcept {
+  size_type count = 0;
+  while (node != nullptr) {
+    if (node->left != nullptr) {
+      RBTreeNode* left = node->left;
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      destroyNode(std::exchange(node, node->right));
+      ++count;
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief Элемент узла для построения нового узла
+ * @tparam Node RBTreeNode или const RBTreeNode
+ * @param node Узел
+ * @return Ссылка на элемент константного узла или rvalue-ссылка на элемент
+ * изменяемого
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Node>
+decltype(auto) RBTree<Key, Value, Compare, Allocator, Policy>::nodeData(
+    Node* node) noexcept {
+  if constexpr (std::is_const_v<Node>) {
+    return (node->data);
+  } else {
+    return std::move(node->data);
   }
 }
 
 /**
  * @brief Копировать узлы из одного дерева в другое
+ * @tparam Node const RBTreeNode для копирования элементов, RBTreeNode для
+ * их перемещения
  * @param dest Узел назначения
  * @param src Исходный узел
- * @details Рекурсивно копирует все узлы из исходного дерева в дерево назначения
+ * @details Обход в прямом порядке без рекурсии и без дополнительной памяти.
+ * Пока копируется левое поддерево, поле right копии хранит правого потомка
+ * исходного узла. Когда левое поддерево готово, подъем по указателям на
+ * родителя в копии доходит до первого узла, в который пришли слева, и
+ * копирование продолжается с отложенного правого потомка. Исходное дерево
+ * читается по одному разу на узел, а подъем идет только по копии, которая
+ * лежит в хранилище почти последовательно: узлы выделяются в прямом порядке.
+ * Веса поддеревьев у копии те же, что у исходных узлов. При исключении
+ * отложенные ссылки на исходные узлы стираются на пути к dest, и копию
+ * можно удалить через deleteSubtree
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::copyNodes(RBTreeNode* dest, RBTreeNode* src) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename Node>
+void RBTree<Key, Value, Compare, Allocator, Policy>::copyNodes(RBTreeNode* dest,
+                                                               Node* src) {
   if (src == nullptr) return;
+  RBTreeNode* const top = dest;
+  try {
+    while (true) {
+      if constexpr (Policy::order_statistics) {
+        dest->subtree_weight = src->subtree_weight;
+      }
+      dest->right = src->right;
+      if (src->left != nullptr) {
+        dest->left = createNode(src->left->getColor(), nodeData(src->left));
+        dest->left->setParent(dest);
+        dest = dest->left;
+        src = src->left;
+        continue;
+      }
+      while (dest->right == nullptr) {
+        RBTreeNode* child = nullptr;
+        do {
+          if (dest == top) return;
+          child = dest;
+          dest = dest->getParent();
+        } while (dest->left != child);
+      }
+      src = dest->right;
+      dest->right = createNode(src->getColor(), nodeData(src));
+      dest->right->setParent(dest);
+      dest = dest->right;
+    }
+  } catch (...) {
+    dest->right = nullptr;
+    for (; dest != top; dest = dest->getParent()) {
+      if (dest->getParent()->left == dest) dest->getParent()->right = nullptr;
+    }
+    throw;
+  }
+}
 
-  if (src->left != nullptr) {
-    dest->left =
-        new RBTreeNode(src->left->key, src->left->value, src->left->color);
-    dest->left->parent = dest;
-    copyNodes(dest->left, src->left);
+/**
+ * @brief Создать копию поддерева в хранилище текущего дерева
+ * @param src Корень копируемого поддерева (не nullptr)
+ * @return Корень копии, еще не подвешенный к заголовку
+ * @details Если копирование элемента бросает исключение, уже созданные
+ * узлы удаляются. Копия прошитого дерева прошивается заново
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::copySubtree(
+    const RBTreeNode* src) {
+  RBTreeNode* copy = createNode(src->getColor(), src->data);
+  try {
+    copyNodes(copy, src);
+  } catch (...) {
+    deleteSubtree(copy);
+    throw;
   }
+  threadNodes(copy);
+  return copy;
+}
 
-  if (src->right != nullptr) {
-    dest->right =
-        new RBTreeNode(src->right->key, src->right->value, src->right->color);
-    dest->right->parent = dest;
-    copyNodes(dest->right, src->right);
+/**
+ * @brief Перенести элементы поддерева в новые узлы текущего дерева
+ * @param src Корень поддерева (не nullptr)
+ * @return Корень нового поддерева, еще не подвешенный к заголовку
+ * @details Нужно, когда узлы другого дерева нельзя забрать из-за разных
+ * аллокаторов: элементы перемещаются, поэтому подходят и типы только с
+ * перемещением. Исходные узлы остаются с перемещенными элементами, их
+ * удаляет владелец. При исключении уже созданные узлы удаляются
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::RBTreeNode*
+RBTree<Key, Value, Compare, Allocator, Policy>::moveSubtree(RBTreeNode* src) {
+  RBTreeNode* copy = createNode(src->getColor(), std::move(src->data));
+  try {
+    copyNodes(copy, src);
+  } catch (...) {
+    deleteSubtree(copy);
+    throw;
   }
+  threadNodes(copy);
+  return copy;
 }
 
 /**
  * @brief Обменять содержимое двух деревьев
  * @param other Дерево для обмена
- * @details Обменивает корни и размеры деревьев
+ * @details Обменивает корни, размеры и память узлов деревьев. Заголовки
+ * остаются на месте, корни подвешиваются к ним заново
  */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::swap(RBTree& other) noexcept {
-  std::swap(root, other.root);
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::swap(
+    RBTree& other) noexcept {
+  RBTreeNode* otherRoot = other.root;
+  RBTreeNode* otherLeft = other.header_.left;
+  RBTreeNode* otherRight = other.header_.right;
+  other.attachRoot(root, header_.left, header_.right);
+  attachRoot(otherRoot, otherLeft, otherRight);
   std::swap(tree_size, other.tree_size);
+  std::swap(comp_, other.comp_);
+  nodes_.swap(other.nodes_);
 }
 
 /**
  * @brief Объединить два дерева
  * @param other Дерево для объединения
- * @details Переносит все элементы из другого дерева в текущее
- */
-template <typename Key, typename Value>
-void RBTree<Key, Value>::merge(RBTree& other) {
-  if (this != &other) {
-    auto it = other.begin();
-    while (it != other.end()) {
-      auto current_pair = *it;
-      insert(current_pair.first, current_pair.second);
-      ++it;
+ * @details Переносит из other узлы с ключами, которых нет в текущем дереве.
+ * При общем хранилище узлов узел отвязывается от other и подвешивается к
+ * текущему дереву без выделения памяти, иначе элемент перемещается в новый
+ * узел
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+void RBTree<Key, Value, Compare, Allocator, Policy>::merge(RBTree& other) {
+  if (this == &other) return;
+  bool shared = sharesNodeStorage(other);
+  RBTreeNode* node = other.header_.left;
+  while (node != &other.header_) {
+    RBTreeNode* next = nextNode(node);
+    InsertPosition position = findInsertPosition(node->key());
+    if (position.existing == nullptr) {
+      if (shared) {
+        other.unlinkNode(node);
+        relinkNode(node, position);
+      } else {
+        RBTreeNode* copy = createNode(RED, std::move(node->data));
+        linkNode(copy, position.parent, position.toLeft);
+        other.eraseNode(node);
+      }
     }
-    other.clear();
+    node = next;
   }
 }
 
@@ -121,8 +270,10 @@ void RBTree<Key, Value>::merge(RBTree& other) {
  * @param key Ключ для поиска
  * @return true если ключ найден, иначе false
  */
-template <typename Key, typename Value>
-bool RBTree<Key, Value>::contains(const Key& key) const {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::contains(
+    const Key& key) const {
   return findNode(key) != nullptr;
 }
 
@@ -131,8 +282,10 @@ bool RBTree<Key, Value>::contains(const Key& key) const {
  * @param key Ключ для поиска
  * @return Итератор на найденный элемент или end()
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::Iterator RBTree<Key, Value>::find(const Key& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::find(const Key& key) {
   RBTreeNode* node = findNode(key);
   return node ? Iterator(node) : end();
 }
@@ -142,22 +295,257 @@ typename RBTree<Key, Value>::Iterator RBTree<Key, Value>::find(const Key& key) {
  * @param key Ключ для поиска
  * @return Константный итератор на найденный элемент или cend()
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::ConstIterator RBTree<Key, Value>::find(
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::find(const Key& key) const {
+  RBTreeNode* node = findNode(key);
+  return node ? ConstIterator(node) : end();
+}
+
+/**
+ * @brief Проверка наличия ключа, сравнимого с key
+ * @param key Значение, сравнимое с ключами дерева
+ * @return true если найден эквивалентный ключ, иначе false
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+bool RBTree<Key, Value, Compare, Allocator, Policy>::contains(
+    const K& key) const {
+  return findNode(key) != nullptr;
+}
+
+/**
+ * @brief Найти элемент по ключу, сравнимому с key
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор на найденный элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::find(const K& key) {
+  RBTreeNode* node = findNode(key);
+  return node ? Iterator(node) : end();
+}
+
+/**
+ * @brief Найти элемент по ключу, сравнимому с key (константный)
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Константный итератор на найденный элемент или cend()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::find(const K& key) const {
+  RBTreeNode* node = findNode(key);
+  return node ? ConstIterator(node) : end();
+}
+
+/**
+ * @brief Первый элемент с ключом не меньше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::lower_bound(const Key& key) {
+  return Iterator(lowerBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом не меньше key (константный)
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::lower_bound(
     const Key& key) const {
-  return ConstIterator(findNode(key));
+  return ConstIterator(lowerBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом больше key
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::upper_bound(const Key& key) {
+  return Iterator(upperBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом больше key (константный)
+ * @param key Ключ
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::upper_bound(
+    const Key& key) const {
+  return ConstIterator(upperBoundNode(key));
+}
+
+/**
+ * @brief Диапазон элементов с ключом, эквивалентным key
+ * @param key Ключ
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator,
+          typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator>
+RBTree<Key, Value, Compare, Allocator, Policy>::equal_range(const Key& key) {
+  auto [first, last] = equalRangeNodes(key);
+  return {Iterator(first), Iterator(last)};
+}
+
+/**
+ * @brief Диапазон элементов с ключом, эквивалентным key (константный)
+ * @param key Ключ
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+std::pair<
+    typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator,
+    typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator>
+RBTree<Key, Value, Compare, Allocator, Policy>::equal_range(
+    const Key& key) const {
+  auto [first, last] = equalRangeNodes(key);
+  return {ConstIterator(first), ConstIterator(last)};
+}
+
+/**
+ * @brief Первый элемент с ключом не меньше key при прозрачном компараторе
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::lower_bound(const K& key) {
+  return Iterator(lowerBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом не меньше key при прозрачном компараторе
+ * (константный)
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::lower_bound(
+    const K& key) const {
+  return ConstIterator(lowerBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом больше key при прозрачном компараторе
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator
+RBTree<Key, Value, Compare, Allocator, Policy>::upper_bound(const K& key) {
+  return Iterator(upperBoundNode(key));
+}
+
+/**
+ * @brief Первый элемент с ключом больше key при прозрачном компараторе
+ * (константный)
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Итератор на элемент или end()
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator
+RBTree<Key, Value, Compare, Allocator, Policy>::upper_bound(
+    const K& key) const {
+  return ConstIterator(upperBoundNode(key));
+}
+
+/**
+ * @brief Диапазон элементов с ключом, эквивалентным key при прозрачном
+ * компараторе
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator,
+          typename RBTree<Key, Value, Compare, Allocator, Policy>::Iterator>
+RBTree<Key, Value, Compare, Allocator, Policy>::equal_range(const K& key) {
+  auto [first, last] = equalRangeNodes(key);
+  return {Iterator(first), Iterator(last)};
+}
+
+/**
+ * @brief Диапазон элементов с ключом, эквивалентным key при прозрачном
+ * компараторе (константный)
+ * @param key Значение, сравнимое с ключами дерева
+ * @return Пара lower_bound(key) и upper_bound(key)
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+template <typename K, typename C, typename>
+std::pair<
+    typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator,
+    typename RBTree<Key, Value, Compare, Allocator, Policy>::ConstIterator>
+RBTree<Key, Value, Compare, Allocator, Policy>::equal_range(
+    const K& key) const {
+  auto [first, last] = equalRangeNodes(key);
+  return {ConstIterator(first), ConstIterator(last)};
 }
 
 /**
  * @brief Максимальный размер дерева
  * @return Максимальное количество элементов
  */
-template <typename Key, typename Value>
-typename RBTree<Key, Value>::size_type RBTree<Key, Value>::max_size()
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::size_type
+RBTree<Key, Value, Compare, Allocator, Policy>::max_size()
     const noexcept {
-  return std::numeric_limits<size_type>::max() /
-         (std::is_same_v<Key, Value> ? sizeof(Key)
-                                     : sizeof(std::pair<const Key, Value>));
+  return std::numeric_limits<size_type>::max() / sizeof(RBTreeNode);
+}
+
+/**
+ * @brief Получить аллокатор дерева
+ * @return Копия аллокатора элементов
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::allocator_type
+RBTree<Key, Value, Compare, Allocator, Policy>::get_allocator() const noexcept {
+  return allocator_type(nodes_.get_allocator());
+}
+
+/**
+ * @brief Получить компаратор ключей
+ * @return Копия компаратора
+ */
+template <typename Key, typename Value, typename Compare, typename Allocator,
+          typename Policy>
+typename RBTree<Key, Value, Compare, Allocator, Policy>::key_compare
+RBTree<Key, Value, Compare, Allocator, Policy>::key_comp() const {
+  return comp_;
 }
 
 }  // namespace s21
@@ -12,8 +12,9 @@ namespace s21 {
  * @brief Шаблонный класс vector, реализующий динамический массив
  * @details Реализация контейнера vector, аналогичного std::vector из STL
  * @tparam T Тип элементов, хранящихся в векторе
+ * @tparam Allocator Аллокатор элементов
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   /**
@@ -66,7 +67,22 @@ class vector {
    */
   using const_pointer = const pointer;
 
+  /**
+   * @brief Определение типа аллокатора
+   */
+  using allocator_type = Allocator;
+
  private:
+  /**
+   * @brief Свойства аллокатора
+   */
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  /**
+   * @brief Аллокатор, из которого выделяется массив элементов
+   */
+  allocator_type alloc_;
+
   /**
    * @brief Текущее количество элементов в векторе
    */
@@ -90,22 +106,34 @@ class vector {
    */
   explicit vector();
 
+  /**
+   * @brief Конструктор с аллокатором
+   * @details Создает пустой вектор с минимальной емкостью в памяти аллокатора
+   * @param[in] alloc Аллокатор элементов
+   * @throw std::bad_alloc при ошибке выделения памяти
+   */
+  explicit vector(const allocator_type& alloc);
+
   /**
    * @brief Конструктор с указанием размера
    * @details Создает вектор заданного размера, заполненный значениями по
    * умолчанию
    * @param[in] n Начальный размер вектора
+   * @param[in] alloc Аллокатор элементов
    * @throw std::bad_alloc при ошибке выделения памяти
    */
-  explicit vector(const size_type n);
+  explicit vector(const size_type n,
+                  const allocator_type& alloc = allocator_type());
 
   /**
    * @brief Конструктор из списка инициализации
    * @details Создает вектор и инициализирует его элементами из списка
    * @param[in] items Список инициализации
+   * @param[in] alloc Аллокатор элементов
    * @throw std::bad_alloc при ошибке выделения памяти
    */
-  vector(std::initializer_list<value_type> const& items);
+  vector(std::initializer_list<value_type> const& items,
+         const allocator_type& alloc = allocator_type());
 
   /**
    * @brief Конструктор копирования
@@ -115,6 +143,15 @@ class vector {
    */
   vector(const vector& v);
 
+  /**
+   * @brief Конструктор копирования с аллокатором
+   * @details Создает копию существующего вектора в памяти аллокатора alloc
+   * @param[in] v Копируемый вектор
+   * @param[in] alloc Аллокатор элементов
+   * @throw std::bad_alloc при ошибке выделения памяти
+   */
+  vector(const vector& v, const allocator_type& alloc);
+
   /**
    * @brief Конструктор перемещения
    * @details Перемещает ресурсы из другого вектора
@@ -123,14 +160,26 @@ class vector {
    */
   vector(vector&& v) noexcept;
 
+  /**
+   * @brief Конструктор перемещения с аллокатором
+   * @details Забирает массив v, если аллокаторы равны, иначе перемещает
+   * элементы в новый массив аллокатора alloc
+   * @param[in] v Перемещаемый вектор
+   * @param[in] alloc Аллокатор элементов
+   * @throw std::bad_alloc при ошибке выделения памяти
+   */
+  vector(vector&& v, const allocator_type& alloc);
+
   /**
    * @brief Конструктор с размером и значением
    * @details Создает вектор заданного размера, заполненный указанным значением
    * @param[in] n Размер вектора
    * @param[in] value Значение для инициализации элементов
+   * @param[in] alloc Аллокатор элементов
    * @throw std::bad_alloc при ошибке выделения памяти
    */
-  vector(size_type n, const_reference value);
+  vector(size_type n, const_reference value,
+         const allocator_type& alloc = allocator_type());
 
   /**
    * @brief Деструктор
@@ -143,9 +192,12 @@ class vector {
    * @details Перемещает ресурсы из другого вектора
    * @param[in] v Перемещаемый вектор
    * @return Ссылка на текущий вектор
-   * @note Не выбрасывает исключений (noexcept)
+   * @note Не выбрасывает исключений, если аллокатор переносится или все его
+   * экземпляры равны
    */
-  vector& operator=(vector&& v) noexcept;
+  vector& operator=(vector&& v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
 
   /**
    * @brief Оператор копирующего присваивания
@@ -390,7 +442,7 @@ class vector {
     /**
      * @brief Тип значения
      */
-    using value_type = typename vector<T>::value_type;
+    using value_type = typename vector<T, Allocator>::value_type;
 
     /**
      * @brief Тип разности
@@ -400,12 +452,12 @@ class vector {
     /**
      * @brief Тип указателя
      */
-    using pointer = vector<T>::pointer;
+    using pointer = vector<T, Allocator>::pointer;
 
     /**
      * @brief Тип ссылки
      */
-    using reference = vector<T>::reference;
+    using reference = vector<T, Allocator>::reference;
 
     /**
      * @brief Конструктор с указателем
@@ -515,14 +567,37 @@ class vector {
    * @return true если векторы не равны
    */
   bool operator!=(const vector& other) const;
+
+  /**
+   * @brief Получение аллокатора
+   * @return Копия аллокатора элементов
+   */
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+ private:
+  /**
+   * @brief Выделить массив и создать в нем элементы по умолчанию
+   * @details Все элементы в пределах емкости вектора всегда созданы
+   * @param[in] n Количество элементов
+   * @return Указатель на массив
+   * @throw std::bad_alloc при ошибке выделения памяти
+   */
+  value_type* allocateStorage(size_type n);
+
+  /**
+   * @brief Разрушить элементы массива и вернуть память аллокатору
+   * @param[in] data Массив, полученный из allocateStorage (может быть nullptr)
+   * @param[in] n Количество элементов массива
+   */
+  void deallocateStorage(value_type* data, size_type n) noexcept;
 };
 
 /**
  * @brief Класс итератора
  * @details Предоставляет доступ для чтения и записи к элементам вектора
  */
-template <typename T>
-class vector<T>::VectorIterator {
+template <typename T, typename Allocator>
+class vector<T, Allocator>::VectorIterator {
  public:
   /**
    * @brief Категория итератора
@@ -532,7 +607,7 @@ class vector<T>::VectorIterator {
   /**
    * @brief Тип значения
    */
-  using value_type = typename vector<T>::value_type;
+  using value_type = typename vector<T, Allocator>::value_type;
 
   /**
    * @brief Тип разности
@@ -542,12 +617,12 @@ class vector<T>::VectorIterator {
   /**
    * @brief Тип указателя
    */
-  using pointer = vector<T>::pointer;
+  using pointer = vector<T, Allocator>::pointer;
 
   /**
    * @brief Тип ссылки
    */
-  using reference = vector<T>::reference;
+  using reference = vector<T, Allocator>::reference;
 
   /**
    * @brief Конструктор по умолчанию
@@ -644,6 +719,14 @@ class vector<T>::VectorIterator {
   pointer ptr_;
 };
 
+namespace pmr {
+
+/// Вектор, выделяющий память из std::pmr::memory_resource
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 // clang-format off
@@ -12,8 +12,9 @@ namespace s21 {
  * @return Константная ссылка на текущий элемент
  * @throw std::out_of_range Если итератор указывает на невалидную позицию
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::VectorConstIterator::operator*()
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference
+vector<T, Allocator>::VectorConstIterator::operator*()
     const {
   return *ptr_;
 }
@@ -25,9 +26,9 @@ typename vector<T>::const_reference vector<T>::VectorConstIterator::operator*()
  * @throw std::out_of_range Если следующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator++() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator++() {
   ++ptr_;
   return *this;
 }
@@ -39,9 +40,9 @@ vector<T>::VectorConstIterator::operator++() {
  * @throw std::out_of_range Если предыдущая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator--() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator--() {
   --ptr_;
   return *this;
 }
@@ -55,9 +56,9 @@ vector<T>::VectorConstIterator::operator--() {
  * @throw std::out_of_range Если следующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator++(int) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator++(int) {
   VectorConstIterator tmp = *this;
   ++ptr_;
   return tmp;
@@ -72,9 +73,9 @@ vector<T>::VectorConstIterator::operator++(int) {
  * @throw std::out_of_range Если предыдущая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator--(int) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator--(int) {
   VectorConstIterator tmp = *this;
   --ptr_;
   return tmp;
@@ -88,9 +89,9 @@ vector<T>::VectorConstIterator::operator--(int) {
  * @throw std::out_of_range Если результирующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator+(int n) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator+(int n) {
   return VectorConstIterator(ptr_ + n);
 }
 
@@ -102,9 +103,9 @@ vector<T>::VectorConstIterator::operator+(int n) {
  * @throw std::out_of_range Если результирующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorConstIterator
-vector<T>::VectorConstIterator::operator-(int n) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorConstIterator
+vector<T, Allocator>::VectorConstIterator::operator-(int n) {
   return VectorConstIterator(ptr_ - n);
 }
 
@@ -114,8 +115,9 @@ vector<T>::VectorConstIterator::operator-(int n) {
  * @param[in] other Другой итератор для сравнения
  * @return Количество элементов между текущим и другим итератором
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::VectorConstIterator::operator-(
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::VectorConstIterator::operator-(
     const VectorConstIterator& other) {
   return ptr_ - other.ptr_;
 }
@@ -126,8 +128,8 @@ typename vector<T>::size_type vector<T>::VectorConstIterator::operator-(
  * @param[in] other Другой итератор для сравнения
  * @return true если итераторы равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::VectorConstIterator::operator==(
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::VectorConstIterator::operator==(
     const VectorConstIterator& other) const {
   return ptr_ == other.ptr_;
 }
@@ -138,8 +140,8 @@ bool vector<T>::VectorConstIterator::operator==(
  * @param[in] other Другой итератор для сравнения
  * @return true если итераторы не равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::VectorConstIterator::operator!=(
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::VectorConstIterator::operator!=(
     const VectorConstIterator& other) const {
   return ptr_ != other.ptr_;
 }
@@ -149,8 +151,9 @@ bool vector<T>::VectorConstIterator::operator!=(
  * @details Создает константный итератор на основе обычного итератора
  * @param[in] other Обычный итератор для преобразования
  */
-template <typename T>
-vector<T>::VectorConstIterator::VectorConstIterator(const VectorIterator& other)
+template <typename T, typename Allocator>
+vector<T, Allocator>::VectorConstIterator::VectorConstIterator(
+    const VectorIterator& other)
     : ptr_(other.ptr_) {}
 
 /**
@@ -158,8 +161,9 @@ vector<T>::VectorConstIterator::VectorConstIterator(const VectorIterator& other)
  * @details Возвращает внутренний указатель итератора
  * @return Указатель на текущий элемент
  */
-template <typename T>
-typename vector<T>::pointer vector<T>::VectorConstIterator::get_ptr() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::pointer
+vector<T, Allocator>::VectorConstIterator::get_ptr() const {
   return ptr_;
 }
 
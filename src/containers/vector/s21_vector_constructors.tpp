@@ -10,13 +10,16 @@ namespace s21 {
  * @details Создает вектор и инициализирует его элементами из списка
  * инициализации
  * @param[in] items Список инициализации с элементами для вектора
+ * @param[in] alloc Аллокатор элементов
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T>::vector(std::initializer_list<T> const &items)
-    : size_(items.size()),
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<T> const &items,
+                             const allocator_type &alloc)
+    : alloc_(alloc),
+      size_(items.size()),
       capacity_(items.size()),
-      data_(new value_type[items.size()]) {
+      data_(allocateStorage(items.size())) {
   s21::copy(items.begin(), items.end(), data_);
 }
 
@@ -24,13 +27,15 @@ vector<T>::vector(std::initializer_list<T> const &items)
  * @brief Конструктор с указанием размера
  * @details Создает вектор заданного размера с элементами по умолчанию
  * @param[in] n Начальный размер вектора
+ * @param[in] alloc Аллокатор элементов
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T>::vector(const size_type n)
-    : size_(n),
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const size_type n, const allocator_type &alloc)
+    : alloc_(alloc),
+      size_(n),
       capacity_(n == 0 ? 1 : n),
-      data_(new value_type[n == 0 ? 1 : n]) {
+      data_(allocateStorage(n == 0 ? 1 : n)) {
   s21::fill(data_, data_ + size_, T());
 }
 
@@ -39,13 +44,16 @@ vector<T>::vector(const size_type n)
  * @details Создает вектор заданного размера и заполняет его указанным значением
  * @param[in] n Размер вектора
  * @param[in] value Значение для инициализации элементов
+ * @param[in] alloc Аллокатор элементов
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T>::vector(const size_type n, const_reference value)
-    : size_(n),
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const size_type n, const_reference value,
+                             const allocator_type &alloc)
+    : alloc_(alloc),
+      size_(n),
       capacity_(n == 0 ? 1 : n),
-      data_(new value_type[n == 0 ? 1 : n]) {
+      data_(allocateStorage(n == 0 ? 1 : n)) {
   for (size_type i = 0; i < size_; ++i) {
     data_[i] = value;
   }
@@ -53,60 +61,132 @@ vector<T>::vector(const size_type n, const_reference value)
 
 /**
  * @brief Конструктор копирования
- * @details Создает копию существующего вектора
+ * @details Создает копию существующего вектора. Аллокатор выбирается через
+ * select_on_container_copy_construction
  * @param[in] v Вектор для копирования
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T>::vector(const vector &v)
-    : size_(v.size_),
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &v)
+    : alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)),
+      size_(v.size_),
       capacity_(v.capacity_),
-      data_(new value_type[v.capacity_]) {
+      data_(allocateStorage(v.capacity_)) {
+  s21::copy(v.data_, v.data_ + v.size_, data_);
+}
+
+/**
+ * @brief Конструктор копирования с аллокатором
+ * @details Создает копию существующего вектора в памяти аллокатора alloc
+ * @param[in] v Вектор для копирования
+ * @param[in] alloc Аллокатор элементов
+ * @throw std::bad_alloc В случае ошибки выделения памяти
+ */
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &v, const allocator_type &alloc)
+    : alloc_(alloc),
+      size_(v.size_),
+      capacity_(v.capacity_),
+      data_(allocateStorage(v.capacity_)) {
   s21::copy(v.data_, v.data_ + v.size_, data_);
 }
 
 /**
  * @brief Конструктор перемещения
- * @details Перемещает ресурсы из другого вектора
+ * @details Перемещает ресурсы и аллокатор из другого вектора
  * @param[in] v Вектор для перемещения
  * @note Не выбрасывает исключений (noexcept)
  */
-template <typename T>
-vector<T>::vector(vector &&v) noexcept
-    : size_(v.size_), capacity_(v.capacity_), data_(v.data_) {
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&v) noexcept
+    : alloc_(std::move(v.alloc_)),
+      size_(v.size_),
+      capacity_(v.capacity_),
+      data_(v.data_) {
   v.size_ = 0;
   v.capacity_ = 0;
   v.data_ = nullptr;
 }
 
+/**
+ * @brief Конструктор перемещения с аллокатором
+ * @details Забирает массив v, если аллокаторы равны. Иначе массив нельзя
+ * освободить чужим аллокатором: элементы перемещаются в новый массив
+ * аллокатора alloc, а v сохраняет свой массив
+ * @param[in] v Вектор для перемещения
+ * @param[in] alloc Аллокатор элементов
+ * @throw std::bad_alloc В случае ошибки выделения памяти
+ */
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&v, const allocator_type &alloc)
+    : alloc_(alloc), size_(v.size_), capacity_(v.capacity_), data_(nullptr) {
+  if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+    data_ = std::exchange(v.data_, nullptr);
+    v.capacity_ = 0;
+  } else {
+    data_ = allocateStorage(capacity_);
+    s21::move(v.data_, v.data_ + v.size_, data_);
+  }
+  v.size_ = 0;
+}
+
 /**
  * @brief Конструктор по умолчанию
  * @details Создает пустой вектор с минимальной емкостью
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T>::vector() : size_(0), capacity_(1), data_(new value_type[1]) {}
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector()
+    : alloc_(), size_(0), capacity_(1), data_(allocateStorage(1)) {}
+
+/**
+ * @brief Конструктор с аллокатором
+ * @details Создает пустой вектор с минимальной емкостью в памяти аллокатора
+ * @param[in] alloc Аллокатор элементов
+ * @throw std::bad_alloc В случае ошибки выделения памяти
+ */
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const allocator_type &alloc)
+    : alloc_(alloc), size_(0), capacity_(1), data_(allocateStorage(1)) {}
 
 /**
  * @brief Деструктор
  * @details Освобождает выделенную память
  */
-template <typename T>
-vector<T>::~vector() {
-  delete[] data_;
+template <typename T, typename Allocator>
+vector<T, Allocator>::~vector() {
+  deallocateStorage(data_, capacity_);
 }
 
 /**
  * @brief Оператор перемещающего присваивания
- * @details Перемещает ресурсы из другого вектора
+ * @details Перемещает ресурсы из другого вектора. Если аллокатор не
+ * переносится и не равен аллокатору v, массив нельзя забрать: элементы
+ * перемещаются в новый массив текущего аллокатора
  * @param[in] v Вектор для перемещения
  * @return Ссылка на текущий вектор
- * @note Не выбрасывает исключений (noexcept)
  */
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&v) noexcept {
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(vector &&v) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
   if (this != &v) {
-    delete[] data_;
+    using pocma = typename alloc_traits::propagate_on_container_move_assignment;
+    if constexpr (!pocma::value && !alloc_traits::is_always_equal::value) {
+      if (alloc_ != v.alloc_) {
+        value_type *new_data = allocateStorage(v.capacity_);
+        s21::move(v.data_, v.data_ + v.size_, new_data);
+        deallocateStorage(data_, capacity_);
+        data_ = new_data;
+        size_ = v.size_;
+        capacity_ = v.capacity_;
+        return *this;
+      }
+    }
+    deallocateStorage(data_, capacity_);
+    if constexpr (pocma::value) {
+      alloc_ = std::move(v.alloc_);
+    }
     data_ = v.data_;
     size_ = v.size_;
     capacity_ = v.capacity_;
@@ -124,11 +204,16 @@ vector<T> &vector<T>::operator=(vector &&v) noexcept {
  * @return Ссылка на текущий вектор
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-vector<T> &vector<T>::operator=(const vector &v) {
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(const vector &v) {
   if (this != &v) {
-    delete[] data_;
-    data_ = new value_type[v.capacity_];
+    deallocateStorage(data_, capacity_);
+    data_ = nullptr;
+    size_ = capacity_ = 0;
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      alloc_ = v.alloc_;
+    }
+    data_ = allocateStorage(v.capacity_);
     size_ = v.size_;
     capacity_ = v.capacity_;
     s21::copy(v.data_, v.data_ + v.size_, data_);
@@ -136,4 +221,40 @@ vector<T> &vector<T>::operator=(const vector &v) {
   return *this;
 }
 
+/**
+ * @brief Выделить массив и создать в нем элементы по умолчанию
+ * @details Элементы создаются через allocator_traits::construct, при
+ * исключении уже созданные элементы разрушаются, а память освобождается
+ * @param[in] n Количество элементов
+ * @return Указатель на массив
+ * @throw std::bad_alloc В случае ошибки выделения памяти
+ */
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::value_type *
+vector<T, Allocator>::allocateStorage(size_type n) {
+  value_type *data = alloc_traits::allocate(alloc_, n);
+  size_type built = 0;
+  try {
+    for (; built < n; ++built) alloc_traits::construct(alloc_, data + built);
+  } catch (...) {
+    while (built > 0) alloc_traits::destroy(alloc_, data + --built);
+    alloc_traits::deallocate(alloc_, data, n);
+    throw;
+  }
+  return data;
+}
+
+/**
+ * @brief Разрушить элементы массива и вернуть память аллокатору
+ * @param[in] data Массив, полученный из allocateStorage (может быть nullptr)
+ * @param[in] n Количество элементов массива
+ */
+template <typename T, typename Allocator>
+void vector<T, Allocator>::deallocateStorage(value_type *data,
+                                             size_type n) noexcept {
+  if (data == nullptr) return;
+  for (size_type i = 0; i < n; ++i) alloc_traits::destroy(alloc_, data + i);
+  alloc_traits::deallocate(alloc_, data, n);
+}
+
 }  // namespace s21
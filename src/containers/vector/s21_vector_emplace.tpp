@@ -16,9 +16,10 @@ namespace s21 {
  * @throw std::bad_alloc В случае ошибки выделения памяти
  * @throw Любые исключения, которые может выбросить конструктор элемента
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
+typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
+    const_iterator pos,
                                                 Args&&... args) {
   return insert(iterator(pos.get_ptr()),
                 value_type(std::forward<Args>(args)...));
@@ -34,9 +35,9 @@ typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
  * @throw Любые исключения, которые могут выбросить конструкторы копирования
  * элементов
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename InputIt>
-void vector<T>::assign(InputIt first, InputIt last) {
+void vector<T, Allocator>::assign(InputIt first, InputIt last) {
   clear();
   for (auto it = first; it != last; ++it) {
     push_back(*it);
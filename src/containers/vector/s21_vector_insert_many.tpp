@@ -17,9 +17,10 @@ namespace s21 {
  * @throw Любые исключения, которые могут выбросить конструкторы копирования
  * элементов
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert_many(
+    const_iterator pos,
                                                     Args&&... args) {
   size_type index = pos - cbegin();
   size_type insert_count = sizeof...(Args);
@@ -49,9 +50,9 @@ typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
  * @throw Любые исключения, которые могут выбросить конструкторы копирования
  * элементов
  */
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void vector<T>::insert_many_back(Args&&... args) {
+void vector<T, Allocator>::insert_many_back(Args&&... args) {
   size_type insert_count = sizeof...(Args);
 
   if (size_ + insert_count > capacity_) {
@@ -11,8 +11,9 @@ namespace s21 {
  * @return Ссылка на текущий элемент
  * @throw std::out_of_range Если итератор указывает на невалидную позицию
  */
-template <typename T>
-typename vector<T>::reference vector<T>::VectorIterator::operator*() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference
+vector<T, Allocator>::VectorIterator::operator*() {
   return *ptr_;
 }
 
@@ -23,8 +24,9 @@ typename vector<T>::reference vector<T>::VectorIterator::operator*() {
  * @throw std::out_of_range Если следующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator& vector<T>::VectorIterator::operator++() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator&
+vector<T, Allocator>::VectorIterator::operator++() {
   ++ptr_;
   return *this;
 }
@@ -36,8 +38,9 @@ typename vector<T>::VectorIterator& vector<T>::VectorIterator::operator++() {
  * @throw std::out_of_range Если предыдущая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator& vector<T>::VectorIterator::operator--() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator&
+vector<T, Allocator>::VectorIterator::operator--() {
   --ptr_;
   return *this;
 }
@@ -51,8 +54,9 @@ typename vector<T>::VectorIterator& vector<T>::VectorIterator::operator--() {
  * @throw std::out_of_range Если следующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator++(int) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator
+vector<T, Allocator>::VectorIterator::operator++(int) {
   VectorIterator tmp = *this;
   ++ptr_;
   return tmp;
@@ -67,8 +71,9 @@ typename vector<T>::VectorIterator vector<T>::VectorIterator::operator++(int) {
  * @throw std::out_of_range Если предыдущая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator--(int) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator
+vector<T, Allocator>::VectorIterator::operator--(int) {
   VectorIterator tmp = *this;
   --ptr_;
   return tmp;
@@ -82,8 +87,9 @@ typename vector<T>::VectorIterator vector<T>::VectorIterator::operator--(int) {
  * @throw std::out_of_range Если результирующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator+(int n) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator
+vector<T, Allocator>::VectorIterator::operator+(int n) {
   return iterator(ptr_ + n);
 }
 
@@ -95,8 +101,9 @@ typename vector<T>::VectorIterator vector<T>::VectorIterator::operator+(int n) {
  * @throw std::out_of_range Если результирующая позиция находится за пределами
  * вектора
  */
-template <typename T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator-(int n) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::VectorIterator
+vector<T, Allocator>::VectorIterator::operator-(int n) {
   return iterator(ptr_ - n);
 }
 
@@ -106,8 +113,9 @@ typename vector<T>::VectorIterator vector<T>::VectorIterator::operator-(int n) {
  * @param[in] other Другой итератор для сравнения
  * @return true если итераторы равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::VectorIterator::operator==(const VectorIterator& other) const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::VectorIterator::operator==(
+    const VectorIterator& other) const {
   return ptr_ == other.ptr_;
 }
 
@@ -117,8 +125,9 @@ bool vector<T>::VectorIterator::operator==(const VectorIterator& other) const {
  * @param[in] other Другой итератор для сравнения
  * @return true если итераторы не равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::VectorIterator::operator!=(const VectorIterator& other) const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::VectorIterator::operator!=(
+    const VectorIterator& other) const {
   return ptr_ != other.ptr_;
 }
 
@@ -128,8 +137,9 @@ bool vector<T>::VectorIterator::operator!=(const VectorIterator& other) const {
  * @param[in] other Другой итератор для вычисления разности
  * @return Количество элементов между текущим и другим итератором
  */
-template <typename T>
-int vector<T>::VectorIterator::operator-(const VectorIterator& other) {
+template <typename T, typename Allocator>
+int vector<T, Allocator>::VectorIterator::operator-(
+    const VectorIterator& other) {
   return ptr_ - other.ptr_;
 }
 
@@ -141,8 +151,9 @@ int vector<T>::VectorIterator::operator-(const VectorIterator& other) {
  * @return true если текущий итератор указывает на элемент раньше в векторе,
  * false в противном случае
  */
-template <typename T>
-bool vector<T>::VectorIterator::operator<(const VectorIterator& other) const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::VectorIterator::operator<(
+    const VectorIterator& other) const {
   return ptr_ < other.ptr_;
 }
 
@@ -151,8 +162,8 @@ bool vector<T>::VectorIterator::operator<(const VectorIterator& other) const {
  * @details Возвращает итератор, указывающий на первый элемент вектора
  * @return Итератор на первый элемент
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() {
   return iterator(data_);
 }
 
@@ -162,8 +173,9 @@ typename vector<T>::iterator vector<T>::begin() {
  * вектора
  * @return Константный итератор на первый элемент
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::begin() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::begin() const {
   return const_iterator(data_);
 }
 
@@ -173,8 +185,8 @@ typename vector<T>::const_iterator vector<T>::begin() const {
  * элемента
  * @return Итератор на позицию после последнего элемента
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::end() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::end() {
   return iterator(data_ + size_);
 }
 
@@ -184,8 +196,9 @@ typename vector<T>::iterator vector<T>::end() {
  * последнего элемента
  * @return Константный итератор на позицию после последнего элемента
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::end() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::end() const {
   return const_iterator(data_ + size_);
 }
 
@@ -195,8 +208,9 @@ typename vector<T>::const_iterator vector<T>::end() const {
  * вектора
  * @return Константный итератор на первый элемент
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cbegin() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::cbegin() const {
   return VectorConstIterator(data_);
 }
 
@@ -206,8 +220,9 @@ typename vector<T>::const_iterator vector<T>::cbegin() const {
  * последнего элемента
  * @return Константный итератор на позицию после последнего элемента
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cend() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::cend() const {
   return VectorConstIterator(data_ + size_);
 }
 
@@ -216,7 +231,8 @@ typename vector<T>::const_iterator vector<T>::cend() const {
  * @details Создает итератор, указывающий на заданный элемент
  * @param[in] ptr Указатель на элемент вектора
  */
-template <typename T>
-vector<T>::VectorIterator::VectorIterator(const pointer ptr) : ptr_(ptr) {}
+template <typename T, typename Allocator>
+vector<T, Allocator>::VectorIterator::VectorIterator(
+    const pointer ptr) : ptr_(ptr) {}
 
 }  // namespace s21
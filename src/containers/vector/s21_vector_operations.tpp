@@ -13,8 +13,9 @@ namespace s21 {
  * @return Ссылка на элемент
  * @throw std::out_of_range Если индекс выходит за границы вектора
  */
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::at(
+    size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("Vector Error: Index out of range");
   }
@@ -28,8 +29,9 @@ typename vector<T>::reference vector<T>::at(size_type pos) {
  * @param[in] pos Индекс элемента
  * @return Ссылка на элемент
  */
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::operator[](
+    size_type pos) {
   return data_[pos];
 }
 
@@ -39,8 +41,8 @@ typename vector<T>::reference vector<T>::operator[](size_type pos) {
  * @return Константная ссылка на первый элемент
  * @throw std::out_of_range Если вектор пуст
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::front() {
   if (size_ > 0) return data_[0];
   throw std::out_of_range("Vector Error: Index out of range");
 }
@@ -51,8 +53,9 @@ typename vector<T>::const_reference vector<T>::front() {
  * @return Константная ссылка на последний элемент
  * @throw std::out_of_range Если вектор пуст
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference
+vector<T, Allocator>::back() const {
   if (size_ > 0) return data_[size_ - 1];
   throw std::out_of_range("Vector Error: Index out of range");
 }
@@ -62,8 +65,8 @@ typename vector<T>::const_reference vector<T>::back() const {
  * @details Возвращает прямой указатель на массив данных
  * @return Указатель на данные
  */
-template <typename T>
-typename vector<T>::pointer vector<T>::data() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::pointer vector<T, Allocator>::data() const {
   return data_;
 }
 
@@ -72,8 +75,8 @@ typename vector<T>::pointer vector<T>::data() const {
  * @details Проверяет, является ли вектор пустым
  * @return true если вектор пуст, false в противном случае
  */
-template <typename T>
-bool vector<T>::empty() const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
@@ -82,8 +85,8 @@ bool vector<T>::empty() const {
  * @details Возвращает текущее количество элементов в векторе
  * @return Количество элементов
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const {
   return size_;
 }
 
@@ -92,8 +95,9 @@ typename vector<T>::size_type vector<T>::size() const {
  * @details Возвращает максимально возможное количество элементов
  * @return Максимальный размер
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::max_size() const {
   return capacity_;
 }
 
@@ -103,12 +107,12 @@ typename vector<T>::size_type vector<T>::max_size() const {
  * @param[in] size Требуемая емкость
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-void vector<T>::reserve(const size_type size) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reserve(const size_type size) {
   if (size > capacity_) {
-    value_type *new_data = new value_type[size];
+    value_type *new_data = allocateStorage(size);
     s21::move(data_, data_ + size_, new_data);
-    delete[] data_;
+    deallocateStorage(data_, capacity_);
     data_ = new_data;
     capacity_ = size;
   }
@@ -119,8 +123,9 @@ void vector<T>::reserve(const size_type size) {
  * @details Возвращает текущую емкость вектора
  * @return Емкость вектора
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::capacity() const {
   return capacity_;
 }
 
@@ -129,12 +134,12 @@ typename vector<T>::size_type vector<T>::capacity() const {
  * @details Уменьшает емкость вектора до его размера
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-void vector<T>::shrink_to_fit() {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
   if (size_ < capacity_) {
-    value_type *new_data = new value_type[size_];
+    value_type *new_data = allocateStorage(size_);
     s21::move(data_, data_ + size_, new_data);
-    delete[] data_;
+    deallocateStorage(data_, capacity_);
     data_ = new_data;
     capacity_ = size_;
   }
@@ -144,8 +149,8 @@ void vector<T>::shrink_to_fit() {
  * @brief Очистка вектора
  * @details Удаляет все элементы из вектора
  */
-template <typename T>
-void vector<T>::clear() {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::clear() {
   for (int i = 0; i < size_; ++i) this->data_[i] = T();
   size_ = 0;
 }
@@ -158,9 +163,9 @@ void vector<T>::clear() {
  * @return Итератор на вставленный элемент
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    iterator pos, const_reference value) {
   int index = pos - this->begin();
   if (index >= capacity_)
     this->reserve(index + 1);
@@ -184,8 +189,8 @@ typename vector<T>::iterator vector<T>::insert(iterator pos,
  * @param[in] pos Итератор на удаляемый элемент
  * @throw std::out_of_range Если позиция находится за пределами вектора
  */
-template <typename T>
-void vector<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::erase(iterator pos) {
   int index = pos - this->begin();
 
   if (index >= size_)
@@ -206,8 +211,8 @@ void vector<T>::erase(iterator pos) {
  * @param[in] value Добавляемое значение
  * @throw std::bad_alloc В случае ошибки выделения памяти
  */
-template <typename T>
-void vector<T>::push_back(const_reference value) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::push_back(const_reference value) {
   if (size_ == capacity_) {
     reserve(capacity_ * 2);
   }
@@ -221,8 +226,8 @@ void vector<T>::push_back(const_reference value) {
  * @details Удаляет последний элемент вектора
  * @throw std::out_of_range Если вектор пуст
  */
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::pop_back() {
   if (size_ == 0) throw std::out_of_range("Vector Error: Index out of range");
   data_[size_ - 1] = T();
   size_--;
@@ -233,11 +238,14 @@ void vector<T>::pop_back() {
  * @details Обменивает содержимое с другим вектором
  * @param[in,out] other Другой вектор для обмена
  */
-template <typename T>
-void vector<T>::swap(vector &other) noexcept {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::swap(vector &other) noexcept {
   s21::swap(size_, other.size_);
   s21::swap(data_, other.data_);
   s21::swap(capacity_, other.capacity_);
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    s21::swap(alloc_, other.alloc_);
+  }
 }
 
 /**
@@ -246,8 +254,8 @@ void vector<T>::swap(vector &other) noexcept {
  * @param[in] other Другой вектор для сравнения
  * @return true если векторы равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::operator==(const vector &other) const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::operator==(const vector &other) const {
   return size_ == other.size_ &&
          std::equal(begin(), end(), other.begin(), other.end());
 }
@@ -258,8 +266,8 @@ bool vector<T>::operator==(const vector &other) const {
  * @param[in] other Другой вектор для сравнения
  * @return true если векторы не равны, false в противном случае
  */
-template <typename T>
-bool vector<T>::operator!=(const vector &other) const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::operator!=(const vector &other) const {
   return !(*this == other);
 }
 
@@ -8,6 +8,31 @@
 
 namespace s21 {
 
+/**
+ * @brief Политика дерева multiset
+ *
+ * Узел дерева multiset хранит ключ и число его копий, поэтому в порядковой
+ * статистике элемент весит столько, сколько у него копий. Остальные
+ * параметры берутся из пользовательской политики.
+ *
+ * @tparam Policy политика, заданная пользователем multiset
+ */
+template <typename Policy>
+struct MultisetTreePolicy : Policy {
+  static constexpr bool unit_weights = false;  ///< Вес узла - число копий
+
+  /**
+   * @brief Вес элемента дерева
+   *
+   * @param value пара ключ и число копий
+   * @return число копий ключа
+   */
+  template <typename V>
+  static constexpr size_t element_weight(const V &value) noexcept {
+    return value.second;
+  }
+};
+
 /**
  * @brief Контейнер multiset, реализующий мультимножество
  *
@@ -17,8 +42,16 @@ namespace s21 {
  * контейнер map.
  *
  * @tparam T тип данных элементов в мультимножестве
+ * @tparam Compare компаратор элементов (прозрачный компаратор включает поиск
+ * по сравнимым с T типам)
+ * @tparam Allocator аллокатор элементов, для узлов дерева он перепривязывается
+ * к типу узла
+ * @tparam Policy политика дерева (DefaultTreePolicy, PooledTreePolicy или
+ * OrderStatisticTreePolicy, при которой nth() и rank() учитывают дубликаты)
  */
-template <typename T>
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>,
+          typename Policy = DefaultTreePolicy>
 class multiset {
  public:
   class Iterator;
@@ -36,10 +69,22 @@ class multiset {
   using iterator = Iterator;
   /** @brief Тип константного итератора */
   using const_iterator = ConstIterator;
+  /** @brief Тип обратного итератора */
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  /** @brief Тип константного обратного итератора */
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
   /** @brief Тип для представления размера контейнера */
   using size_type = size_t;
+  /** @brief Тип компаратора элементов */
+  using key_compare = Compare;
+  /** @brief Тип аллокатора */
+  using allocator_type = Allocator;
   /** @brief Тип дерева, используемого для хранения элементов */
-  using TreeType = s21::map<T, size_type>;
+  using TreeType = s21::map<
+      T, size_type, Compare,
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          std::pair<const T, size_type>>,
+      MultisetTreePolicy<Policy>>;
   /** @brief Тип узла красно-черного дерева */
   using RBTreeNode = typename TreeType::RBTreeNode;
 
@@ -50,6 +95,22 @@ class multiset {
    */
   multiset();
 
+  /**
+   * @brief Конструктор с аллокатором
+   *
+   * @param alloc аллокатор, из которого выделяются узлы дерева
+   */
+  explicit multiset(const allocator_type &alloc);
+
+  /**
+   * @brief Конструктор с компаратором
+   *
+   * @param comp компаратор элементов
+   * @param alloc аллокатор, из которого выделяются узлы дерева
+   */
+  explicit multiset(const key_compare &comp,
+                    const allocator_type &alloc = allocator_type());
+
   /**
    * @brief Конструктор со списком инициализации
    *
@@ -71,6 +132,22 @@ class multiset {
    */
   multiset(multiset &&ms) noexcept;
 
+  /**
+   * @brief Конструктор копирования с аллокатором
+   *
+   * @param ms другой объект multiset для копирования
+   * @param alloc аллокатор, из которого выделяются узлы копии
+   */
+  multiset(const multiset &ms, const allocator_type &alloc);
+
+  /**
+   * @brief Конструктор перемещения с аллокатором
+   *
+   * @param ms другой объект multiset для перемещения
+   * @param alloc аллокатор, из которого выделяются узлы
+   */
+  multiset(multiset &&ms, const allocator_type &alloc);
+
   /**
    * @brief Деструктор
    *
@@ -92,7 +169,8 @@ class multiset {
    * @param ms другой объект multiset для перемещения
    * @return multiset& ссылка на текущий объект
    */
-  multiset &operator=(multiset &&ms) noexcept;
+  multiset &operator=(multiset &&ms) noexcept(
+      std::is_nothrow_move_assignable_v<TreeType>);
 
   /**
    * @brief Возвращает итератор на начало контейнера
@@ -138,6 +216,51 @@ class multiset {
    */
   const_iterator end() const;
 
+  /**
+   * @brief Возвращает обратный итератор на последний элемент
+   *
+   * @return reverse_iterator обратный итератор, указывающий на наибольший
+   * элемент
+   */
+  reverse_iterator rbegin();
+
+  /**
+   * @brief Возвращает обратный итератор на позицию перед первым элементом
+   *
+   * @return reverse_iterator обратный итератор конца обратного обхода
+   */
+  reverse_iterator rend();
+
+  /**
+   * @brief Возвращает константный обратный итератор на последний элемент
+   *
+   * @return const_reverse_iterator константный обратный итератор
+   */
+  const_reverse_iterator rbegin() const;
+
+  /**
+   * @brief Возвращает константный обратный итератор на позицию перед первым
+   * элементом
+   *
+   * @return const_reverse_iterator константный обратный итератор
+   */
+  const_reverse_iterator rend() const;
+
+  /**
+   * @brief Возвращает константный обратный итератор на последний элемент
+   *
+   * @return const_reverse_iterator константный обратный итератор
+   */
+  const_reverse_iterator crbegin() const;
+
+  /**
+   * @brief Возвращает константный обратный итератор на позицию перед первым
+   * элементом
+   *
+   * @return const_reverse_iterator константный обратный итератор
+   */
+  const_reverse_iterator crend() const;
+
   /**
    * @brief Проверяет, пуст ли контейнер
    *
@@ -160,6 +283,13 @@ class multiset {
    */
   [[nodiscard]] size_type max_size() const;
 
+  /**
+   * @brief Возвращает аллокатор контейнера
+   *
+   * @return allocator_type копия аллокатора элементов
+   */
+  allocator_type get_allocator() const noexcept;
+
   /**
    * @brief Удаляет все элементы из контейнера
    */
@@ -181,6 +311,30 @@ class multiset {
    */
   iterator insert_(value_type value);
 
+  /**
+   * @brief Вставляет элемент по подсказке
+   *
+   * Если ключ должен стоять прямо перед hint или совпадает с ключом hint,
+   * место находится без спуска от корня: вставка неубывающих ключей с
+   * hint = end() выполняется за амортизированное O(1).
+   *
+   * @param hint итератор, перед которым ожидается элемент
+   * @param value значение для вставки
+   * @return iterator итератор, указывающий на вставленный элемент
+   */
+  iterator insert(const_iterator hint, const value_type &value);
+
+  /**
+   * @brief Строит элемент и вставляет его по подсказке
+   *
+   * @tparam Args типы аргументов конструктора элемента
+   * @param hint итератор, перед которым ожидается элемент
+   * @param args аргументы конструктора элемента
+   * @return iterator итератор, указывающий на вставленный элемент
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
+
   /**
    * @brief Удаляет элемент из контейнера по итератору
    *
@@ -202,6 +356,37 @@ class multiset {
    */
   void merge(multiset &ms);
 
+  /**
+   * @brief Разделяет контейнер по ключу за O(log n)
+   *
+   * Все копии элементов меньше key остаются в контейнере.
+   *
+   * @param key граница разделения
+   * @return multiset копии элементов не меньше key
+   */
+  multiset split(const key_type &key);
+
+  /**
+   * @brief Присоединяет контейнер с большими элементами за O(log n)
+   *
+   * Наибольший элемент текущего контейнера может совпадать с наименьшим
+   * элементом ms: их копии объединяются в одном узле.
+   *
+   * @param ms другой контейнер multiset, который будет опустошен после операции
+   * @throw std::invalid_argument если диапазоны элементов пересекаются
+   */
+  void join(multiset &ms);
+
+  /**
+   * @brief Присоединяет опорный элемент и контейнер с большими элементами
+   *
+   * @param pivot элемент не меньше элементов контейнера и не больше
+   * элементов ms
+   * @param ms другой контейнер multiset, который будет опустошен после операции
+   * @throw std::invalid_argument если элементы нарушают порядок
+   */
+  void join(const value_type &pivot, multiset &ms);
+
   /**
    * @brief Возвращает количество элементов с заданным ключом
    *
@@ -210,6 +395,18 @@ class multiset {
    */
   size_type count(const key_type &value) const;
 
+  /**
+   * @brief Возвращает количество элементов, эквивалентных value
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param value значение, сравнимое с элементами
+   * @return size_type количество элементов
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &value) const;
+
   /**
    * @brief Находит элемент с заданным ключом
    *
@@ -218,6 +415,18 @@ class multiset {
    */
   iterator find(const key_type &key);
 
+  /**
+   * @brief Находит элемент, эквивалентный key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return iterator итератор на найденный элемент или end() если не найден
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
   /**
    * @brief Проверяет наличие элемента с заданным ключом
    *
@@ -227,6 +436,26 @@ class multiset {
    */
   bool contains(const key_type &value) const;
 
+  /**
+   * @brief Проверяет наличие элемента, эквивалентного value
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param value значение, сравнимое с элементами
+   * @return true если элемент найден
+   * @return false если элемент не найден
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &value) const;
+
+  /**
+   * @brief Возвращает компаратор элементов
+   *
+   * @return key_compare копия компаратора
+   */
+  key_compare key_comp() const;
+
   /**
    * @brief Возвращает диапазон элементов с заданным ключом
    *
@@ -239,6 +468,8 @@ class multiset {
   /**
    * @brief Возвращает итератор на первый элемент, не меньший заданного ключа
    *
+   * Спуск по дереву за O(log n), итератор указывает на первую копию ключа.
+   *
    * @param key искомый ключ
    * @return iterator итератор на найденный элемент или end() если не найден
    */
@@ -273,6 +504,117 @@ class multiset {
   std::pair<const_iterator, const_iterator> equal_range(
       const key_type &key) const;
 
+  /**
+   * @brief Возвращает константный итератор на первый элемент, не меньший key
+   *
+   * @param key искомый ключ
+   * @return const_iterator итератор на найденный элемент или end()
+   */
+  const_iterator lower_bound(const key_type &key) const;
+
+  /**
+   * @brief Возвращает константный итератор на первый элемент, больший key
+   *
+   * @param key искомый ключ
+   * @return const_iterator итератор на найденный элемент или end()
+   */
+  const_iterator upper_bound(const key_type &key) const;
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return std::pair<iterator, iterator> пара итераторов, ограничивающих
+   * диапазон
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key);
+
+  /**
+   * @brief Возвращает диапазон константных итераторов, эквивалентных key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return std::pair<const_iterator, const_iterator> пара константных
+   * итераторов
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+
+  /**
+   * @brief Возвращает итератор на первый элемент, не меньший key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return iterator итератор на найденный элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+
+  /**
+   * @brief Возвращает константный итератор на первый элемент, не меньший key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return const_iterator итератор на найденный элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const;
+
+  /**
+   * @brief Возвращает итератор на первый элемент, больший key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return iterator итератор на найденный элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+
+  /**
+   * @brief Возвращает константный итератор на первый элемент, больший key
+   *
+   * Доступно только при прозрачном компараторе.
+   *
+   * @param key значение, сравнимое с элементами
+   * @return const_iterator итератор на найденный элемент или end()
+   */
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const;
+
+  /**
+   * @brief Находит k-й по порядку элемент с учетом дубликатов
+   *
+   * Требует политики с порядковой статистикой (OrderStatisticTreePolicy),
+   * работает за O(log n).
+   *
+   * @param k номер элемента, начиная с 0
+   * @return iterator итератор на элемент или end() если k >= size()
+   */
+  iterator nth(size_type k);
+
+  /**
+   * @brief Возвращает количество элементов меньше key с учетом дубликатов
+   *
+   * Требует политики с порядковой статистикой, работает за O(log n).
+   *
+   * @param key искомый ключ
+   * @return size_type позиция первой копии key в порядке обхода
+   */
+  size_type rank(const key_type &key) const;
+
   /**
    * @brief Класс итератора для контейнера multiset
    *
@@ -286,10 +628,10 @@ class multiset {
     using value_type = T;
     /** @brief Тип разности между итераторами */
     using difference_type = std::ptrdiff_t;
-    /** @brief Тип указателя на итератор базового дерева */
-    using pointer = typename TreeType::Iterator;
+    /** @brief Тип указателя на значение */
+    using pointer = const T *;
     /** @brief Тип ссылки на значение */
-    using reference = T &;
+    using reference = const T &;
 
     /** @brief Конструктор по умолчанию */
     Iterator() = default;
@@ -312,9 +654,9 @@ class multiset {
     /**
      * @brief Оператор разыменования
      *
-     * @return value_type значение текущего элемента
+     * @return reference константная ссылка на текущий элемент
      */
-    value_type operator*();
+    reference operator*() const;
 
     /**
      * @brief Оператор префиксного инкремента
@@ -362,6 +704,16 @@ class multiset {
      */
     bool operator!=(const Iterator &other) const;
 
+    /**
+     * @brief Расстояние между итераторами
+     *
+     * Требует политики с порядковой статистикой, работает за O(log n).
+     *
+     * @param other итератор того же контейнера
+     * @return difference_type разность позиций текущего итератора и other
+     */
+    difference_type operator-(const Iterator &other) const;
+
     /** @brief Итератор базового дерева */
     typename TreeType::Iterator it_;
     /** @brief Индекс текущего элемента в узле */
@@ -383,21 +735,21 @@ class multiset {
  *
  * @tparam T тип данных элементов в мультимножестве
  */
-template <typename T>
-class multiset<T>::ConstIterator {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+class multiset<T, Compare, Allocator, Policy>::ConstIterator {
  public:
   /** @brief Тип для представления размера */
-  using size_type = multiset<T>::size_type;
+  using size_type = multiset<T, Compare, Allocator, Policy>::size_type;
   /** @brief Категория итератора */
   using iterator_category = std::bidirectional_iterator_tag;
   /** @brief Тип значения */
-  using value_type = multiset<T>::key_type;
+  using value_type = multiset<T, Compare, Allocator, Policy>::key_type;
   /** @brief Тип разности между итераторами */
   using difference_type = std::ptrdiff_t;
-  /** @brief Тип указателя на константный итератор базового дерева */
-  using pointer = typename map<T, size_type>::const_iterator;
+  /** @brief Тип указателя на значение */
+  using pointer = const T *;
   /** @brief Тип ссылки на значение */
-  using reference = T &;
+  using reference = const T &;
 
   /**
    * @brief Конструктор из константного итератора базового дерева
@@ -405,9 +757,16 @@ class multiset<T>::ConstIterator {
    * @param it константный итератор базового дерева
    * @param index индекс элемента в узле
    */
-  explicit ConstIterator(typename map<T, size_type>::const_iterator it,
+  explicit ConstIterator(typename TreeType::const_iterator it,
                          size_type index = 1);
 
+  /**
+   * @brief Конструктор из неконстантного итератора
+   *
+   * @param other итератор того же контейнера
+   */
+  ConstIterator(const Iterator &other);
+
   /**
    * @brief Оператор разыменования
    *
@@ -461,12 +820,32 @@ class multiset<T>::ConstIterator {
    */
   bool operator!=(const ConstIterator &other) const;
 
+  /**
+   * @brief Расстояние между итераторами
+   *
+   * Требует политики с порядковой статистикой, работает за O(log n).
+   *
+   * @param other итератор того же контейнера
+   * @return difference_type разность позиций текущего итератора и other
+   */
+  difference_type operator-(const ConstIterator &other) const;
+
   /** @brief Константный итератор базового дерева */
-  typename map<T, multiset<T>::size_type>::const_iterator it_;
+  typename TreeType::const_iterator it_;
   /** @brief Индекс текущего элемента в узле */
   size_type index_;
 };
 
+namespace pmr {
+
+/// Мультимножество, выделяющее узлы из std::pmr::memory_resource
+template <typename T, typename Compare = std::less<T>,
+          typename Policy = DefaultTreePolicy>
+using multiset =
+    s21::multiset<T, Compare, std::pmr::polymorphic_allocator<T>, Policy>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 // clang-format off
@@ -13,11 +13,11 @@ namespace s21 {
  * @return typename multiset<T>::size_type количество элементов с заданным
  * ключом
  */
-template <typename T>
-typename multiset<T>::size_type multiset<T>::count(
-    const key_type &value) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type
+multiset<T, Compare, Allocator, Policy>::count(const key_type &value) const {
   auto it = map_.find(value);
-  return it != map_.end() ? it.iter_node_->value
+  return it != map_.end() ? it.iter_node_->value()
                           : 0;  // Возвращаем количество дубликатов или 0
 }
 
@@ -29,8 +29,9 @@ typename multiset<T>::size_type multiset<T>::count(
  * @return typename multiset<T>::iterator итератор на найденный элемент или
  * end() если не найден
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::find(const key_type &key) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::find(const key_type &key) {
   auto it = map_.find(key);
   return it != map_.end()
              ? iterator(it, 1)
@@ -45,42 +46,135 @@ typename multiset<T>::iterator multiset<T>::find(const key_type &key) {
  * @return true если элемент найден
  * @return false если элемент не найден
  */
-template <typename T>
-bool multiset<T>::contains(const key_type &value) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::contains(
+    const key_type &value) const {
   return map_.contains(value);  // Делегируем проверку базовому дереву
 }
 
+/**
+ * @brief Возвращает количество элементов, эквивалентных value
+ *
+ * @tparam K тип, сравнимый с T прозрачным компаратором
+ * @param value искомое значение
+ * @return size_type количество элементов
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::size_type
+multiset<T, Compare, Allocator, Policy>::count(const K &value) const {
+  auto it = map_.find(value);
+  return it != map_.end() ? it.iter_node_->value() : 0;
+}
+
+/**
+ * @brief Находит элемент, эквивалентный key
+ *
+ * @tparam K тип, сравнимый с T прозрачным компаратором
+ * @param key искомое значение
+ * @return iterator итератор на найденный элемент или end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::find(const K &key) {
+  auto it = map_.find(key);
+  return it != map_.end() ? iterator(it, 1) : end();
+}
+
+/**
+ * @brief Проверяет наличие элемента, эквивалентного value
+ *
+ * @tparam K тип, сравнимый с T прозрачным компаратором
+ * @param value искомое значение
+ * @return true если элемент найден
+ * @return false если элемент не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+bool multiset<T, Compare, Allocator, Policy>::contains(const K &value) const {
+  return map_.contains(value);
+}
+
+/**
+ * @brief Возвращает компаратор элементов
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return key_compare копия компаратора
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::key_compare
+multiset<T, Compare, Allocator, Policy>::key_comp() const {
+  return map_.key_comp();
+}
+
 /**
  * @brief Возвращает диапазон элементов с заданным ключом
  *
+ * Ключи в дереве уникальны, поэтому диапазон - это все копии одного узла
+ * и находится одним спуском.
+ *
  * @tparam T тип данных элементов в мультимножестве
  * @param key искомый ключ
  * @return std::pair<typename multiset<T>::iterator, typename
  * multiset<T>::iterator> пара итераторов, ограничивающих диапазон
  */
-template <typename T>
-std::pair<typename multiset<T>::iterator, typename multiset<T>::iterator>
-multiset<T>::equal_range(const key_type &key) {
-  auto lower = lower_bound(key);  // Нижняя граница
-  auto upper = upper_bound(key);  // Верхняя граница
-  return {lower, upper};
+template <typename T, typename Compare, typename Allocator, typename Policy>
+std::pair<typename multiset<T, Compare, Allocator, Policy>::iterator,
+          typename multiset<T, Compare, Allocator, Policy>::iterator>
+multiset<T, Compare, Allocator, Policy>::equal_range(const key_type &key) {
+  auto range = map_.equal_range(key);
+  return {iterator(range.first, 1), iterator(range.second, 1)};
+}
+
+/**
+ * @brief Возвращает диапазон константных итераторов с заданным ключом
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param key искомый ключ
+ * @return std::pair<typename multiset<T>::const_iterator, typename
+ * multiset<T>::const_iterator> пара константных итераторов, ограничивающих
+ * диапазон
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+std::pair<typename multiset<T, Compare, Allocator, Policy>::const_iterator,
+          typename multiset<T, Compare, Allocator, Policy>::const_iterator>
+multiset<T, Compare, Allocator, Policy>::equal_range(
+    const key_type &key) const {
+  auto range = map_.equal_range(key);
+  return {const_iterator(range.first, 1), const_iterator(range.second, 1)};
 }
 
 /**
  * @brief Возвращает итератор на первый элемент, не меньший заданного ключа
  *
+ * Спуск по дереву за O(log n), итератор указывает на первую копию ключа.
+ *
  * @tparam T тип данных элементов в мультимножестве
  * @param key искомый ключ
  * @return typename multiset<T>::iterator итератор на найденный элемент или
  * end() если не найден
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::lower_bound(const key_type &key) {
-  auto it = begin();
-  while (it != end() && *it < key) {
-    ++it;  // Ищем первый элемент, не меньший key
-  }
-  return it;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::lower_bound(const key_type &key) {
+  return iterator(map_.lower_bound(key), 1);
+}
+
+/**
+ * @brief Возвращает константный итератор на первый элемент, не меньший
+ * заданного ключа
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param key искомый ключ
+ * @return typename multiset<T>::const_iterator итератор на найденный
+ * элемент или end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::lower_bound(
+    const key_type &key) const {
+  return const_iterator(map_.lower_bound(key), 1);
 }
 
 /**
@@ -91,32 +185,161 @@ typename multiset<T>::iterator multiset<T>::lower_bound(const key_type &key) {
  * @return typename multiset<T>::iterator итератор на найденный элемент или
  * end() если не найден
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::upper_bound(const key_type &key) {
-  auto it = begin();
-  while (it != end() && *it <= key) {
-    ++it;  // Ищем первый элемент, больший key
-  }
-  return it;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::upper_bound(const key_type &key) {
+  return iterator(map_.upper_bound(key), 1);
 }
 
 /**
- * @brief Возвращает диапазон константных итераторов с заданным ключом
+ * @brief Возвращает константный итератор на первый элемент, больший
+ * заданного ключа
  *
  * @tparam T тип данных элементов в мультимножестве
  * @param key искомый ключ
+ * @return typename multiset<T>::const_iterator итератор на найденный
+ * элемент или end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::upper_bound(
+    const key_type &key) const {
+  return const_iterator(map_.upper_bound(key), 1);
+}
+
+/**
+ * @brief Возвращает диапазон элементов, эквивалентных key
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
+ * @return std::pair<typename multiset<T>::iterator, typename
+ * multiset<T>::iterator> пара итераторов, ограничивающих диапазон
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename multiset<T, Compare, Allocator, Policy>::iterator,
+          typename multiset<T, Compare, Allocator, Policy>::iterator>
+multiset<T, Compare, Allocator, Policy>::equal_range(const K &key) {
+  auto range = map_.equal_range(key);
+  return {iterator(range.first, 1), iterator(range.second, 1)};
+}
+
+/**
+ * @brief Возвращает диапазон константных итераторов, эквивалентных key
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
  * @return std::pair<typename multiset<T>::const_iterator, typename
  * multiset<T>::const_iterator> пара константных итераторов, ограничивающих
  * диапазон
  */
-template <typename T>
-std::pair<typename multiset<T>::const_iterator,
-          typename multiset<T>::const_iterator>
-multiset<T>::equal_range(const key_type &key) const {
-  auto lower = const_iterator(map_.find(key), 1);  // Нижняя граница
-  auto it = lower;
-  while (it != end() && *it == key) ++it;  // Ищем верхнюю границу
-  return {lower, it};
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+std::pair<typename multiset<T, Compare, Allocator, Policy>::const_iterator,
+          typename multiset<T, Compare, Allocator, Policy>::const_iterator>
+multiset<T, Compare, Allocator, Policy>::equal_range(const K &key) const {
+  auto range = map_.equal_range(key);
+  return {const_iterator(range.first, 1), const_iterator(range.second, 1)};
+}
+
+/**
+ * @brief Возвращает итератор на первый элемент, не меньший заданного ключа
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
+ * @return typename multiset<T>::iterator итератор на найденный элемент или
+ * end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::lower_bound(const K &key) {
+  return iterator(map_.lower_bound(key), 1);
+}
+
+/**
+ * @brief Возвращает константный итератор на первый элемент, не меньший
+ * заданного ключа
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
+ * @return typename multiset<T>::const_iterator итератор на найденный
+ * элемент или end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::lower_bound(const K &key) const {
+  return const_iterator(map_.lower_bound(key), 1);
+}
+
+/**
+ * @brief Возвращает итератор на первый элемент, больший заданного ключа
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
+ * @return typename multiset<T>::iterator итератор на найденный элемент или
+ * end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::upper_bound(const K &key) {
+  return iterator(map_.upper_bound(key), 1);
+}
+
+/**
+ * @brief Возвращает константный итератор на первый элемент, больший
+ * заданного ключа
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @tparam K тип, сравнимый с элементами прозрачным компаратором
+ * @param key значение, сравнимое с элементами
+ * @return typename multiset<T>::const_iterator итератор на найденный
+ * элемент или end() если не найден
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K, typename C, typename>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::upper_bound(const K &key) const {
+  return const_iterator(map_.upper_bound(key), 1);
+}
+
+/**
+ * @brief Находит k-й по порядку элемент с учетом дубликатов
+ *
+ * Узел, в который попадает k, находится спуском по весам, номер копии внутри
+ * узла - разность k и позиции первой копии ключа.
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param k номер элемента, начиная с 0
+ * @return typename multiset<T>::iterator итератор на элемент или end()
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::nth(size_type k) {
+  auto it = map_.nth(k);
+  if (it == map_.end()) return end();
+  size_type first = static_cast<size_type>(it - map_.begin());
+  return iterator(it, k - first + 1);
+}
+
+/**
+ * @brief Возвращает количество элементов меньше key с учетом дубликатов
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param key искомый ключ
+ * @return size_type позиция первой копии key в порядке обхода
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type
+multiset<T, Compare, Allocator, Policy>::rank(const key_type &key) const {
+  return map_.rank(key);
 }
 
 /**
@@ -126,8 +349,8 @@ multiset<T>::equal_range(const key_type &key) const {
  * @return true если контейнер пуст
  * @return false если контейнер содержит элементы
  */
-template <typename T>
-bool multiset<T>::empty() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::empty() const {
   return copies_ == 0;  // Проверяем счетчик элементов
 }
 
@@ -137,8 +360,9 @@ bool multiset<T>::empty() const {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::size_type количество элементов
  */
-template <typename T>
-typename multiset<T>::size_type multiset<T>::size() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type
+multiset<T, Compare, Allocator, Policy>::size() const {
   return copies_;  // Возвращаем счетчик элементов
 }
 
@@ -148,9 +372,22 @@ typename multiset<T>::size_type multiset<T>::size() const {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::size_type максимальный размер контейнера
  */
-template <typename T>
-typename multiset<T>::size_type multiset<T>::max_size() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type
+multiset<T, Compare, Allocator, Policy>::max_size() const {
   return map_.max_size();  // Делегируем базовому дереву
 }
 
+/**
+ * @brief Возвращает аллокатор контейнера
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return allocator_type копия аллокатора элементов
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::allocator_type
+multiset<T, Compare, Allocator, Policy>::get_allocator() const noexcept {
+  return allocator_type(map_.get_allocator());
+}
+
 }  // namespace s21
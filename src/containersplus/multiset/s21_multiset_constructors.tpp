@@ -12,8 +12,31 @@ namespace s21 {
  *
  * @tparam T тип данных элементов в мультимножестве
  */
-template <typename T>
-multiset<T>::multiset() : map_(), copies_(0) {}
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset() : map_(), copies_(0) {}
+
+/**
+ * @brief Конструктор с аллокатором
+ *
+ * Создает пустой контейнер multiset, узлы которого выделяются из alloc
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param alloc аллокатор элементов
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(const allocator_type &alloc)
+    : map_(typename TreeType::allocator_type(alloc)), copies_(0) {}
+
+/**
+ * @brief Конструктор с компаратором
+ *
+ * @param comp компаратор элементов
+ * @param alloc аллокатор, из которого выделяются узлы дерева
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(const key_compare &comp,
+                                                  const allocator_type &alloc)
+    : map_(comp, typename TreeType::allocator_type(alloc)), copies_(0) {}
 
 /**
  * @brief Конструктор копирования
@@ -23,8 +46,8 @@ multiset<T>::multiset() : map_(), copies_(0) {}
  * @tparam T тип данных элементов в мультимножестве
  * @param ms другой объект multiset для копирования
  */
-template <typename T>
-multiset<T>::multiset(const multiset &ms)
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(const multiset &ms)
     : map_(ms.map_), copies_(ms.copies_) {}
 
 /**
@@ -35,12 +58,43 @@ multiset<T>::multiset(const multiset &ms)
  * @tparam T тип данных элементов в мультимножестве
  * @param ms другой объект multiset для перемещения
  */
-template <typename T>
-multiset<T>::multiset(multiset &&ms) noexcept
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(multiset &&ms) noexcept
     : map_(std::move(ms.map_)), copies_(ms.copies_) {
   ms.copies_ = 0;  // Обнуляем количество элементов в исходном контейнере
 }
 
+/**
+ * @brief Конструктор копирования с аллокатором
+ *
+ * Создает копию существующего контейнера multiset в памяти аллокатора alloc
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param ms другой объект multiset для копирования
+ * @param alloc аллокатор, из которого выделяются узлы копии
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(const multiset &ms,
+                                                  const allocator_type &alloc)
+    : map_(ms.map_, typename TreeType::allocator_type(alloc)),
+      copies_(ms.copies_) {}
+
+/**
+ * @brief Конструктор перемещения с аллокатором
+ *
+ * Забирает узлы ms, если аллокаторы равны, иначе перемещает элементы в
+ * новые узлы аллокатора alloc
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param ms другой объект multiset для перемещения
+ * @param alloc аллокатор, из которого выделяются узлы
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(multiset &&ms,
+                                                  const allocator_type &alloc)
+    : map_(std::move(ms.map_), typename TreeType::allocator_type(alloc)),
+      copies_(std::exchange(ms.copies_, 0)) {}
+
 /**
  * @brief Конструктор со списком инициализации
  *
@@ -49,8 +103,9 @@ multiset<T>::multiset(multiset &&ms) noexcept
  * @tparam T тип данных элементов в мультимножестве
  * @param items список элементов для инициализации
  */
-template <typename T>
-multiset<T>::multiset(std::initializer_list<value_type> const &items)
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(
+    std::initializer_list<value_type> const &items)
     : multiset() {
   for (const auto &item : items) {
     insert(item);  // Вставляем каждый элемент из списка
@@ -66,8 +121,9 @@ multiset<T>::multiset(std::initializer_list<value_type> const &items)
  * @param other другой объект multiset для копирования
  * @return multiset& ссылка на текущий объект
  */
-template <typename T>
-multiset<T> &multiset<T>::operator=(const multiset &other) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy> &
+multiset<T, Compare, Allocator, Policy>::operator=(const multiset &other) {
   if (this != &other) {  // Проверка на самоприсваивание
     map_ = other.map_;
     copies_ = other.copies_;
@@ -84,8 +140,10 @@ multiset<T> &multiset<T>::operator=(const multiset &other) {
  * @param ms другой объект multiset для перемещения
  * @return multiset& ссылка на текущий объект
  */
-template <typename T>
-multiset<T> &multiset<T>::operator=(multiset &&ms) noexcept {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy> &
+multiset<T, Compare, Allocator, Policy>::operator=(
+    multiset &&ms) noexcept(std::is_nothrow_move_assignable_v<TreeType>) {
   if (this != &ms) {  // Проверка на самоприсваивание
     map_ = std::move(ms.map_);
     copies_ = ms.copies_;
@@ -18,10 +18,11 @@ namespace s21 {
  * @return vector<std::pair<typename multiset<T>::iterator, bool>> вектор пар
  * (итератор, успех вставки)
  */
-template <typename T>
+template <typename T, typename Compare, typename Allocator, typename Policy>
 template <typename... Args>
-vector<std::pair<typename multiset<T>::iterator, bool>>
-multiset<T>::insert_many(Args &&...args) {
+vector<std::pair<typename multiset<T, Compare, Allocator, Policy>::iterator,
+                 bool>>
+multiset<T, Compare, Allocator, Policy>::insert_many(Args &&...args) {
   vector<std::pair<iterator, bool>> results;
   (results.push_back(std::make_pair(insert(std::forward<Args>(args)), true)),
    ...);
@@ -13,8 +13,9 @@ namespace s21 {
  * @return typename multiset<T>::iterator итератор, указывающий на первый
  * элемент
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::begin() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::begin() {
   return iterator(map_.begin(), 1);
 }
 
@@ -25,8 +26,9 @@ typename multiset<T>::iterator multiset<T>::begin() {
  * @return typename multiset<T>::iterator итератор, указывающий на позицию после
  * последнего элемента
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::end() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::end() {
   return iterator(map_.end(), 1);
 }
 
@@ -37,8 +39,9 @@ typename multiset<T>::iterator multiset<T>::end() {
  * @return typename multiset<T>::const_iterator константный итератор,
  * указывающий на первый элемент
  */
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::cbegin() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::cbegin() const {
   return const_iterator(map_.cbegin(), 1);
 }
 
@@ -49,8 +52,9 @@ typename multiset<T>::const_iterator multiset<T>::cbegin() const {
  * @return typename multiset<T>::const_iterator константный итератор,
  * указывающий на позицию после последнего элемента
  */
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::cend() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::cend() const {
   return const_iterator(map_.cend(), 1);
 }
 
@@ -61,8 +65,9 @@ typename multiset<T>::const_iterator multiset<T>::cend() const {
  * @return typename multiset<T>::const_iterator константный итератор,
  * указывающий на первый элемент
  */
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::begin() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::begin() const {
   return const_iterator(map_.cbegin(), 1);
 }
 
@@ -73,11 +78,92 @@ typename multiset<T>::const_iterator multiset<T>::begin() const {
  * @return typename multiset<T>::const_iterator константный итератор,
  * указывающий на позицию после последнего элемента
  */
-template <typename T>
-typename multiset<T>::const_iterator multiset<T>::end() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator
+multiset<T, Compare, Allocator, Policy>::end() const {
   return const_iterator(map_.cend(), 1);
 }
 
+/**
+ * @brief Возвращает обратный итератор на последний элемент
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::reverse_iterator обратный итератор на
+ * наибольший элемент
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::reverse_iterator
+multiset<T, Compare, Allocator, Policy>::rbegin() {
+  return reverse_iterator(end());
+}
+
+/**
+ * @brief Возвращает обратный итератор на позицию перед первым элементом
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::reverse_iterator обратный итератор конца
+ * обратного обхода
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::reverse_iterator
+multiset<T, Compare, Allocator, Policy>::rend() {
+  return reverse_iterator(begin());
+}
+
+/**
+ * @brief Возвращает константный обратный итератор на последний элемент
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::const_reverse_iterator константный обратный
+ * итератор на наибольший элемент
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator
+multiset<T, Compare, Allocator, Policy>::rbegin() const {
+  return const_reverse_iterator(end());
+}
+
+/**
+ * @brief Возвращает константный обратный итератор на позицию перед первым
+ * элементом
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::const_reverse_iterator константный обратный
+ * итератор конца обратного обхода
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator
+multiset<T, Compare, Allocator, Policy>::rend() const {
+  return const_reverse_iterator(begin());
+}
+
+/**
+ * @brief Возвращает константный обратный итератор на последний элемент
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::const_reverse_iterator константный обратный
+ * итератор на наибольший элемент
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator
+multiset<T, Compare, Allocator, Policy>::crbegin() const {
+  return rbegin();
+}
+
+/**
+ * @brief Возвращает константный обратный итератор на позицию перед первым
+ * элементом
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @return typename multiset<T>::const_reverse_iterator константный обратный
+ * итератор конца обратного обхода
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator
+multiset<T, Compare, Allocator, Policy>::crend() const {
+  return rend();
+}
+
 /**
  * @brief Оператор префиксного инкремента для итератора
  *
@@ -88,11 +174,10 @@ typename multiset<T>::const_iterator multiset<T>::end() const {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::Iterator& ссылка на текущий итератор
  */
-template <typename T>
-typename multiset<T>::Iterator &multiset<T>::Iterator::operator++() {
-  if (it_.iter_node_ == nullptr) return *this;
-
-  if (index_ < it_.iter_node_->value) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator &
+multiset<T, Compare, Allocator, Policy>::Iterator::operator++() {
+  if (index_ < it_.iter_node_->value()) {
     ++index_;  // Увеличиваем индекс, если есть еще дубликаты в текущем узле
   } else {
     ++it_;       // Переходим к следующему узлу
@@ -107,30 +192,20 @@ typename multiset<T>::Iterator &multiset<T>::Iterator::operator++() {
  * Перемещает итератор к предыдущему элементу в контейнере.
  * Если текущий индекс больше 1, уменьшает индекс.
  * Иначе переходит к предыдущему узлу и устанавливает индекс на последний
- * дубликат.
+ * дубликат. Из end() итератор переходит к последнему дубликату
+ * максимального ключа.
  *
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::Iterator& ссылка на текущий итератор
  */
-template <typename T>
-typename multiset<T>::Iterator &multiset<T>::Iterator::operator--() {
-  if (it_.iter_node_ == nullptr) {
-    if (it_.past_node_ != nullptr) {
-      it_.iter_node_ = it_.past_node_;
-      index_ =
-          it_.iter_node_->value;  // Устанавливаем индекс на последний дубликат
-    }
-    return *this;
-  }
-
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator &
+multiset<T, Compare, Allocator, Policy>::Iterator::operator--() {
   if (index_ > 1) {
     --index_;  // Уменьшаем индекс, если не первый дубликат
   } else {
     --it_;  // Переходим к предыдущему узлу
-    if (it_.iter_node_ != nullptr) {
-      index_ =
-          it_.iter_node_->value;  // Устанавливаем индекс на последний дубликат
-    }
+    index_ = it_.iter_node_->value();  // Индекс последнего дубликата
   }
   return *this;
 }
@@ -141,8 +216,9 @@ typename multiset<T>::Iterator &multiset<T>::Iterator::operator--() {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::Iterator копия итератора до инкремента
  */
-template <typename T>
-typename multiset<T>::Iterator multiset<T>::Iterator::operator++(int) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator
+multiset<T, Compare, Allocator, Policy>::Iterator::operator++(int) {
   Iterator tmp = *this;
   ++(*this);
   return tmp;
@@ -154,8 +230,9 @@ typename multiset<T>::Iterator multiset<T>::Iterator::operator++(int) {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::Iterator копия итератора до декремента
  */
-template <typename T>
-typename multiset<T>::Iterator multiset<T>::Iterator::operator--(int) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator
+multiset<T, Compare, Allocator, Policy>::Iterator::operator--(int) {
   Iterator tmp = *this;
   --(*this);
   return tmp;
@@ -172,8 +249,9 @@ typename multiset<T>::Iterator multiset<T>::Iterator::operator--(int) {
  * @return true если итераторы равны
  * @return false если итераторы не равны
  */
-template <typename T>
-bool multiset<T>::Iterator::operator==(const Iterator &other) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::Iterator::operator==(
+    const Iterator &other) const {
   return it_.iter_node_ == other.it_.iter_node_ && index_ == other.index_;
 }
 
@@ -185,8 +263,9 @@ bool multiset<T>::Iterator::operator==(const Iterator &other) const {
  * @return true если итераторы не равны
  * @return false если итераторы равны
  */
-template <typename T>
-bool multiset<T>::Iterator::operator!=(const Iterator &other) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::Iterator::operator!=(
+    const Iterator &other) const {
   return !(*this == other);
 }
 
@@ -197,8 +276,9 @@ bool multiset<T>::Iterator::operator!=(const Iterator &other) const {
  * @return typename multiset<T>::ConstIterator& ссылка на текущий константный
  * итератор
  */
-template <typename T>
-typename multiset<T>::ConstIterator &multiset<T>::ConstIterator::operator++() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::ConstIterator &
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator++() {
   if (index_ < (*it_).second)
     index_++;  // Увеличиваем индекс, если есть еще дубликаты
   else {
@@ -215,15 +295,14 @@ typename multiset<T>::ConstIterator &multiset<T>::ConstIterator::operator++() {
  * @return typename multiset<T>::ConstIterator& ссылка на текущий константный
  * итератор
  */
-template <typename T>
-typename multiset<T>::ConstIterator &multiset<T>::ConstIterator::operator--() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::ConstIterator &
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator--() {
   if (index_ > 1) {
     index_--;  // Уменьшаем индекс, если не первый дубликат
   } else {
-    --it_;  // Переходим к предыдущему узлу
-    if (it_ != typename TreeType::const_iterator()) {
-      index_ = (*it_).second;  // Устанавливаем индекс на последний дубликат
-    }
+    --it_;                   // Переходим к предыдущему узлу
+    index_ = (*it_).second;  // Устанавливаем индекс на последний дубликат
   }
   return *this;
 }
@@ -234,9 +313,9 @@ typename multiset<T>::ConstIterator &multiset<T>::ConstIterator::operator--() {
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::ConstIterator копия итератора до инкремента
  */
-template <typename T>
-typename multiset<T>::ConstIterator multiset<T>::ConstIterator::operator++(
-    int) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::ConstIterator
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator++(int) {
   ConstIterator tmp = *this;
   ++(*this);
   return tmp;
@@ -248,9 +327,9 @@ typename multiset<T>::ConstIterator multiset<T>::ConstIterator::operator++(
  * @tparam T тип данных элементов в мультимножестве
  * @return typename multiset<T>::ConstIterator копия итератора до декремента
  */
-template <typename T>
-typename multiset<T>::ConstIterator multiset<T>::ConstIterator::operator--(
-    int) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::ConstIterator
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator--(int) {
   ConstIterator tmp = *this;
   --(*this);
   return tmp;
@@ -264,8 +343,9 @@ typename multiset<T>::ConstIterator multiset<T>::ConstIterator::operator--(
  * @return true если итераторы равны
  * @return false если итераторы не равны
  */
-template <typename T>
-bool multiset<T>::ConstIterator::operator==(const ConstIterator &other) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::ConstIterator::operator==(
+    const ConstIterator &other) const {
   return it_.iter_node_ == other.it_.iter_node_ && index_ == other.index_;
 }
 
@@ -277,8 +357,9 @@ bool multiset<T>::ConstIterator::operator==(const ConstIterator &other) const {
  * @return true если итераторы не равны
  * @return false если итераторы равны
  */
-template <typename T>
-bool multiset<T>::ConstIterator::operator!=(const ConstIterator &other) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::ConstIterator::operator!=(
+    const ConstIterator &other) const {
   return !(*this == other);
 }
 
@@ -288,8 +369,9 @@ bool multiset<T>::ConstIterator::operator!=(const ConstIterator &other) const {
  * @tparam T тип данных элементов в мультимножестве
  * @param it итератор базового дерева
  */
-template <typename T>
-multiset<T>::Iterator::Iterator(typename TreeType::Iterator it)
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::Iterator::Iterator(
+    typename TreeType::Iterator it)
     : it_(it), index_(1) {}
 
 /**
@@ -299,19 +381,22 @@ multiset<T>::Iterator::Iterator(typename TreeType::Iterator it)
  * @param it итератор базового дерева
  * @param index индекс элемента в узле
  */
-template <typename T>
-multiset<T>::Iterator::Iterator(typename TreeType::Iterator it, size_type index)
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::Iterator::Iterator(
+    typename TreeType::Iterator it, size_type index)
     : it_(it), index_(index) {}
 
 /**
  * @brief Оператор разыменования для итератора
  *
  * @tparam T тип данных элементов в мультимножестве
- * @return typename multiset<T>::Iterator::value_type значение текущего элемента
+ * @return typename multiset<T>::Iterator::reference константная ссылка на
+ * текущий элемент
  */
-template <typename T>
-typename multiset<T>::Iterator::value_type multiset<T>::Iterator::operator*() {
-  return it_.iter_node_->key;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator::reference
+multiset<T, Compare, Allocator, Policy>::Iterator::operator*() const {
+  return it_.iter_node_->key();
 }
 
 /**
@@ -321,11 +406,22 @@ typename multiset<T>::Iterator::value_type multiset<T>::Iterator::operator*() {
  * @param it константный итератор базового дерева
  * @param index индекс элемента в узле
  */
-template <typename T>
-multiset<T>::ConstIterator::ConstIterator(
-    typename map<T, size_type>::const_iterator it, size_type index)
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::ConstIterator::ConstIterator(
+    typename TreeType::const_iterator it, size_type index)
     : it_(it), index_(index) {}
 
+/**
+ * @brief Конструктор константного итератора из неконстантного
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param other итератор того же контейнера
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::ConstIterator::ConstIterator(
+    const Iterator &other)
+    : it_(typename TreeType::iterator(other.it_)), index_(other.index_) {}
+
 /**
  * @brief Оператор разыменования для константного итератора
  *
@@ -333,10 +429,44 @@ multiset<T>::ConstIterator::ConstIterator(
  * @return const typename multiset<T>::ConstIterator::value_type& константная
  * ссылка на текущий элемент
  */
-template <typename T>
-const typename multiset<T>::ConstIterator::value_type &
-multiset<T>::ConstIterator::operator*() const {
-  return this->it_.iter_node_->key;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+const typename multiset<T, Compare, Allocator,
+                        Policy>::ConstIterator::value_type &
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator*() const {
+  return this->it_.iter_node_->key();
+}
+
+/**
+ * @brief Расстояние между итераторами
+ *
+ * Позиция итератора складывается из веса элементов перед его узлом в дереве
+ * и номера копии внутри узла.
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param other итератор того же контейнера
+ * @return difference_type разность позиций текущего итератора и other
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::Iterator::difference_type
+multiset<T, Compare, Allocator, Policy>::Iterator::operator-(
+    const Iterator &other) const {
+  return (it_ - other.it_) + static_cast<difference_type>(index_) -
+         static_cast<difference_type>(other.index_);
+}
+
+/**
+ * @brief Расстояние между константными итераторами
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param other итератор того же контейнера
+ * @return difference_type разность позиций текущего итератора и other
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::ConstIterator::difference_type
+multiset<T, Compare, Allocator, Policy>::ConstIterator::operator-(
+    const ConstIterator &other) const {
+  return (it_ - other.it_) + static_cast<difference_type>(index_) -
+         static_cast<difference_type>(other.index_);
 }
 
 }  // namespace s21
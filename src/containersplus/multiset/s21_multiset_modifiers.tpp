@@ -14,15 +14,16 @@ namespace s21 {
  * @tparam T тип данных элементов в мультимножестве
  * @param pos итератор, указывающий на удаляемый элемент
  */
-template <typename T>
-void multiset<T>::erase(iterator pos) {
-  if (pos.it_.iter_node_ == nullptr) return;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::erase(iterator pos) {
+  if (pos.it_.iter_node_ == nullptr || pos.it_ == map_.end()) return;
 
-  if (pos.it_.iter_node_->value > 1) {
-    --pos.it_.iter_node_->value;  // Уменьшаем количество дубликатов
-    --copies_;                    // Уменьшаем общее количество элементов
+  if (pos.it_.iter_node_->value() > 1) {
+    --pos.it_.iter_node_->value();  // Уменьшаем количество дубликатов
+    map_.update_weight(pos.it_);    // Вес узла в порядковой статистике
+    --copies_;                      // Уменьшаем общее количество элементов
   } else {
-    map_.remove(pos.it_.iter_node_->key);  // Удаляем узел полностью
+    map_.remove(pos.it_.iter_node_->key());  // Удаляем узел полностью
     --copies_;  // Уменьшаем общее количество элементов
   }
 }
@@ -33,8 +34,8 @@ void multiset<T>::erase(iterator pos) {
  * @tparam T тип данных элементов в мультимножестве
  * @param ms другой контейнер multiset
  */
-template <typename T>
-void multiset<T>::swap(multiset &ms) noexcept {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::swap(multiset &ms) noexcept {
   map_.swap(ms.map_);              // Обмениваем базовые деревья
   std::swap(copies_, ms.copies_);  // Обмениваем счетчики элементов
 }
@@ -44,8 +45,8 @@ void multiset<T>::swap(multiset &ms) noexcept {
  *
  * @tparam T тип данных элементов в мультимножестве
  */
-template <typename T>
-void multiset<T>::clear() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::clear() {
   if (!empty()) {
     map_.clear();  // Очищаем базовое дерево
     copies_ = 0;   // Сбрасываем счетчик элементов
@@ -63,17 +64,17 @@ void multiset<T>::clear() {
  * @return typename multiset<T>::iterator итератор, указывающий на вставленный
  * элемент
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::insert(const value_type &value) {
-  auto it = map_.find(value);
-  if (it != map_.end()) {
-    ++it.iter_node_->value;  // Увеличиваем количество дубликатов
-    ++copies_;               // Увеличиваем общее количество элементов
-    return iterator(it, it.iter_node_->value);
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::insert(const value_type &value) {
+  // Один спуск по дереву: либо новый узел со счетчиком 1, либо найденный
+  auto [it, inserted] = map_.insert(value, 1);
+  if (!inserted) {
+    ++it.iter_node_->value();  // Увеличиваем количество дубликатов
+    map_.update_weight(it);    // Вес узла в порядковой статистике
   }
-  auto result = map_.insert(value, 1);  // Создаем новый узел
   ++copies_;  // Увеличиваем общее количество элементов
-  return iterator(result.first, 1);
+  return iterator(it, it.iter_node_->value());
 }
 
 /**
@@ -86,17 +87,53 @@ typename multiset<T>::iterator multiset<T>::insert(const value_type &value) {
  * @return typename multiset<T>::iterator итератор, указывающий на вставленный
  * элемент
  */
-template <typename T>
-typename multiset<T>::iterator multiset<T>::insert_(value_type value) {
-  auto it = map_.find(value);
-  if (it != map_.end()) {
-    ++it.iter_node_->value;  // Увеличиваем количество дубликатов
-    ++copies_;               // Увеличиваем общее количество элементов
-    return iterator(it, it.iter_node_->value);
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::insert_(value_type value) {
+  return insert(value);
+}
+
+/**
+ * @brief Вставляет элемент по подсказке
+ *
+ * Узел ищется по подсказке в базовом дереве: новый ключ получает узел со
+ * счетчиком 1, у существующего увеличивается счетчик.
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param hint итератор, перед которым ожидается элемент
+ * @param value значение для вставки
+ * @return typename multiset<T>::iterator итератор, указывающий на вставленный
+ * элемент
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::insert(const_iterator hint,
+                                                const value_type &value) {
+  size_type nodes = map_.size();
+  auto it = map_.insert(hint.it_, {value, 1});
+  if (map_.size() == nodes) {
+    ++it.iter_node_->value();  // Ключ уже был, увеличиваем счетчик
+    map_.update_weight(it);
   }
-  auto result = map_.insert(value, 1);  // Создаем новый узел
-  ++copies_;  // Увеличиваем общее количество элементов
-  return iterator(result.first, 1);
+  ++copies_;
+  return iterator(it, it.iter_node_->value());
+}
+
+/**
+ * @brief Строит элемент и вставляет его по подсказке
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param hint итератор, перед которым ожидается элемент
+ * @param args аргументы конструктора элемента
+ * @return typename multiset<T>::iterator итератор, указывающий на вставленный
+ * элемент
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename... Args>
+typename multiset<T, Compare, Allocator, Policy>::iterator
+multiset<T, Compare, Allocator, Policy>::emplace_hint(const_iterator hint,
+                                                      Args &&...args) {
+  return insert(hint, value_type(std::forward<Args>(args)...));
 }
 
 /**
@@ -108,8 +145,8 @@ typename multiset<T>::iterator multiset<T>::insert_(value_type value) {
  * @tparam T тип данных элементов в мультимножестве
  * @param ms другой контейнер multiset
  */
-template <typename T>
-void multiset<T>::merge(multiset &ms) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::merge(multiset &ms) {
   for (auto it = ms.begin(); it != ms.end();) {
     auto current = it++;
     insert(*current);  // Вставляем каждый элемент из другого контейнера
@@ -117,4 +154,103 @@ void multiset<T>::merge(multiset &ms) {
   ms.clear();  // Очищаем другой контейнер
 }
 
+/**
+ * @brief Разделяет контейнер по ключу
+ *
+ * Узлы делятся за O(log n). Число копий в частях считается через веса
+ * порядковой статистики, а без нее - параллельным обходом обеих частей,
+ * который останавливается на меньшей.
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param key граница разделения
+ * @return multiset копии элементов не меньше key
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>
+multiset<T, Compare, Allocator, Policy>::split(const key_type &key) {
+  multiset right(key_comp(), get_allocator());
+  right.map_ = map_.split(key);
+  size_type total = copies_;
+  if constexpr (Policy::order_statistics) {
+    copies_ = static_cast<size_type>(map_.end() - map_.begin());
+  } else {
+    auto mine = map_.begin();
+    auto theirs = right.map_.begin();
+    size_type mineCopies = 0;
+    size_type theirCopies = 0;
+    for (; mine != map_.end() && theirs != right.map_.end(); ++mine, ++theirs) {
+      mineCopies += mine.iter_node_->value();
+      theirCopies += theirs.iter_node_->value();
+    }
+    copies_ = mine == map_.end() ? mineCopies : total - theirCopies;
+  }
+  right.copies_ = total - copies_;
+  return right;
+}
+
+/**
+ * @brief Присоединяет контейнер с большими элементами
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param ms другой контейнер multiset
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::join(multiset &ms) {
+  if (this == &ms || ms.empty()) return;
+  if (!empty()) {
+    auto last = --map_.end();
+    auto first = ms.map_.begin();
+    key_compare comp = key_comp();
+    if (comp(first->first, last->first)) {
+      throw std::invalid_argument("Key ranges overlap");
+    }
+    if (!comp(last->first, first->first)) {
+      // Граничный элемент есть в обоих контейнерах: копии переходят к нам
+      size_type moved = first.iter_node_->value();
+      last.iter_node_->value() += moved;
+      map_.update_weight(last);
+      ms.map_.erase(first);
+      copies_ += moved;
+      ms.copies_ -= moved;
+    }
+  }
+  map_.join(ms.map_);
+  copies_ += ms.copies_;
+  ms.copies_ = 0;
+}
+
+/**
+ * @brief Присоединяет опорный элемент и контейнер с большими элементами
+ *
+ * @tparam T тип данных элементов в мультимножестве
+ * @param pivot опорный элемент
+ * @param ms другой контейнер multiset
+ */
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::join(const value_type &pivot,
+                                                   multiset &ms) {
+  key_compare comp = key_comp();
+  auto last = empty() ? map_.end() : --map_.end();
+  auto first = ms.map_.begin();
+  if (this == &ms || (last != map_.end() && comp(pivot, last->first)) ||
+      (first != ms.map_.end() && comp(first->first, pivot))) {
+    throw std::invalid_argument("Pivot is out of order");
+  }
+  if (last != map_.end() && !comp(last->first, pivot)) {
+    ++last.iter_node_->value();
+    map_.update_weight(last);
+    ++copies_;
+  } else if (first != ms.map_.end() && !comp(pivot, first->first)) {
+    ++first.iter_node_->value();
+    ms.map_.update_weight(first);
+    ++ms.copies_;
+  } else {
+    map_.join({pivot, 1}, ms.map_);
+    copies_ += ms.copies_ + 1;
+    ms.copies_ = 0;
+    return;
+  }
+  join(ms);
+}
+
 }  // namespace s21
@@ -0,0 +1,11 @@
+BENCH_FLAGS=-std=c++17 -O2 -DNDEBUG -pthread
+# make benchmark BENCH=<имя> запускает только один бенчмарк
+BENCH_SOURCES=$(if $(BENCH),$(SRCDIR)/benchmarks/$(BENCH).cpp,$(wildcard $(SRCDIR)/benchmarks/*.cpp))
+
+_start_benchmark:
+	@mkdir -p $(BUILDDIR)/benchmarks
+	@for src in $(BENCH_SOURCES); do \
+		bin=$(BUILDDIR)/benchmarks/$$(basename $$src .cpp); \
+		echo "=== $$(basename $$src .cpp)"; \
+		$(CC) $(BENCH_FLAGS) -I$(SRCDIR) $$src -o $$bin && ./$$bin || exit 1; \
+	done
@@ -13,9 +13,21 @@
  * @brief Заголовочные файлы стандартной библиотеки C++
  * @{
  */
+#include <algorithm>  ///< Для std::min (сортировка узлов при построении)
+#include <atomic>  ///< Для std::atomic (счетчики ссылок persistent_map)
+#include <cstdint>  ///< Для std::uintptr_t (цвет в указателе на родителя)
+#include <functional>  ///< Для std::less (компаратор по умолчанию)
+#include <iterator>  ///< Для std::reverse_iterator и std::make_move_iterator
 #include <limits>  ///< Для работы с numeric_limits (max_size())
+#include <memory>  ///< Для std::allocator и std::allocator_traits
+#include <memory_resource>  ///< Для std::pmr::polymorphic_allocator
+#include <new>  ///< Для размещающего new (узлы дерева в пуле)
+#include <optional>  ///< Для аллокатора в дескрипторе узла (NodeHandle)
 #include <stdexcept>  ///< Для стандартных исключений (out_of_range, invalid_argument)
+#include <tuple>  ///< Для std::apply и std::make_tuple (insert_many)
+#include <type_traits>  ///< Для std::conditional_t (политики дерева)
 #include <utility>  ///< Для работы с std::pair (используется в map)
+#include <vector>  ///< Для буферов frozen и persistent_map
 /** @} */
 
 /**
@@ -29,8 +41,10 @@
 #include "./containers/vector/s21_vector.h" ///< Динамический массив (vector)
 #include "./containers/queue/s21_queue.h" ///< Очередь (queue)
 #include "./containers/stack/s21_stack.h" ///< Стек (stack)
+#include "./containers/frozen/s21_frozen.h" ///< Неизменяемые снимки (frozen_map, frozen_set)
 #include "./containers/map/s21_map.h"     ///< Ассоциативный массив (map)
 #include "./containers/set/s21_set.h"     ///< Множество (set)
+#include "./containers/persistent/s21_persistent_map.h" ///< Персистентный словарь (persistent_map)
 // clang-format on
 /** @} */
 
@@ -728,3 +728,65 @@ TEST_F(ListExceptionTest, MoveAssignmentAfterException) {
     EXPECT_EQ(lst2.size(), 1);
   }
 }
+
+// Список на монотонном буфере: элементы используют ресурс списка
+TEST(PmrListTest, MonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource buffer;
+  s21::pmr::list<std::pmr::string> l(&buffer);
+  EXPECT_EQ(l.get_allocator().resource(), &buffer);
+  l.push_back(std::pmr::string("node data that does not fit into SSO"));
+  l.push_front(std::pmr::string("front"));
+  EXPECT_EQ(l.size(), 2);
+  EXPECT_EQ(l.back().get_allocator().resource(), &buffer);
+  EXPECT_EQ(l.front(), "front");
+}
+
+// Присваивание между списками с разными ресурсами
+TEST(PmrListTest, AssignAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  s21::pmr::list<int> first(&first_pool);
+  s21::pmr::list<int> second(&second_pool);
+  for (int i = 0; i < 10; ++i) first.push_back(i);
+  second = first;
+  EXPECT_EQ(second.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(second.size(), 10);
+  second.clear();
+  second = std::move(first);
+  EXPECT_EQ(second.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(second.size(), 10);
+  EXPECT_EQ(second.back(), 9);
+  EXPECT_TRUE(first.empty());
+}
+
+// Конструкторы с аллокатором размещают узлы в заданном ресурсе
+TEST(PmrListTest, AllocatorExtendedConstructors) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  s21::pmr::list<int> sized(3, &first_pool);
+  s21::pmr::list<int> filled(4, 7, &first_pool);
+  s21::pmr::list<int> listed({1, 2, 3}, &first_pool);
+  EXPECT_EQ(sized.get_allocator().resource(), &first_pool);
+  EXPECT_EQ(sized.size(), 3);
+  EXPECT_EQ(sized.back(), 0);
+  EXPECT_EQ(filled.size(), 4);
+  EXPECT_EQ(filled.front(), 7);
+  EXPECT_EQ(listed.get_allocator().resource(), &first_pool);
+  EXPECT_EQ(listed.back(), 3);
+
+  s21::pmr::list<int> copy(listed, &second_pool);
+  EXPECT_EQ(copy.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(listed.size(), 3);
+
+  const int *front = &filled.front();
+  s21::pmr::list<int> same(std::move(filled), &first_pool);
+  EXPECT_EQ(&same.front(), front);
+  EXPECT_TRUE(filled.empty());
+  s21::pmr::list<int> other(std::move(same), &second_pool);
+  EXPECT_EQ(other.get_allocator().resource(), &second_pool);
+  EXPECT_NE(&other.front(), front);
+  EXPECT_EQ(other.size(), 4);
+  EXPECT_EQ(other.back(), 7);
+  EXPECT_TRUE(same.empty());
+}
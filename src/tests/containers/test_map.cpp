@@ -1,5 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #include "../../s21_containers.h"
 
 class MapTest : public ::testing::Test {
@@ -263,3 +273,831 @@ TEST_F(MapTest, MergeWithDuplicatesTest) {
   EXPECT_TRUE(map2.contains(2));
   EXPECT_EQ(map2.size(), 1);
 }
+
+// Проверка того, что элемент хранится в узле один раз
+TEST_F(MapTest, SingleStorageThroughIterators) {
+  auto it = my_map.find(2);
+  it->second = 'q';
+  EXPECT_EQ(my_map.at(2), 'q');
+  (*my_map.begin()).second = 'w';
+  EXPECT_EQ(my_map[1], 'w');
+  my_map[3] = 'e';
+  EXPECT_EQ((*my_map.find(3)).second, 'e');
+}
+
+// Ключ, подсчитывающий количество сравнений
+struct CountingKey {
+  int value;
+  static inline size_t comparisons = 0;
+  bool operator<(const CountingKey &other) const {
+    ++comparisons;
+    return value < other.value;
+  }
+  bool operator>(const CountingKey &other) const {
+    ++comparisons;
+    return value > other.value;
+  }
+};
+
+// Проверка того, что вставка выполняет один спуск по дереву
+TEST_F(MapTest, InsertDescendsOnce) {
+  s21::map<CountingKey, int> counted;
+  for (int i = 0; i < 1023; ++i) counted.insert({CountingKey{i * 2}, i});
+
+  // Не более двух сравнений на уровень при высоте не более 2 * log2(n + 1)
+  double max_per_insert = 2 * 2 * std::log2(counted.size() + 1);
+
+  CountingKey::comparisons = 0;
+  EXPECT_TRUE(counted.insert({CountingKey{501}, 0}).second);
+  EXPECT_LE(CountingKey::comparisons, max_per_insert);
+
+  CountingKey::comparisons = 0;
+  EXPECT_FALSE(counted.insert(CountingKey{500}, 1).second);
+  EXPECT_LE(CountingKey::comparisons, max_per_insert);
+
+  CountingKey::comparisons = 0;
+  counted[CountingKey{503}] = 7;
+  EXPECT_LE(CountingKey::comparisons, max_per_insert);
+  EXPECT_EQ(counted.size(), 1025);
+}
+
+template <typename K, typename V>
+using PooledMap =
+    s21::map<K, V, std::less<K>, std::allocator<std::pair<const K, V>>,
+             s21::PooledTreePolicy>;
+
+// Проверка обхода в обратном порядке от end()
+TEST_F(MapTest, DecrementFromEnd) {
+  s21::map<int, char> m = {{3, 'c'}, {1, 'a'}, {2, 'b'}};
+  auto it = m.end();
+  --it;
+  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ((*it--).first, 3);
+  EXPECT_EQ((*it).first, 2);
+  --it;
+  EXPECT_EQ(it, m.begin());
+  m.erase(--m.end());
+  EXPECT_EQ((*--m.end()).first, 2);
+  EXPECT_EQ(m.end(), ++(--m.end()));
+}
+
+// Проверка словаря с пулом узлов: вставка, удаление, повторное использование
+TEST(PooledMapTest, InsertEraseClearReuse) {
+  PooledMap<int, std::string> pooled;
+  for (int i = 0; i < 1000; ++i) pooled.insert(i, std::to_string(i));
+  for (int i = 0; i < 1000; i += 2) pooled.erase(pooled.find(i));
+  EXPECT_EQ(pooled.size(), 500);
+  EXPECT_EQ(pooled.at(999), "999");
+
+  for (int i = 0; i < 1000; i += 2) pooled[i] = "new";
+  EXPECT_EQ(pooled.size(), 1000);
+  EXPECT_EQ(pooled.at(10), "new");
+
+  pooled.clear();
+  EXPECT_TRUE(pooled.empty());
+  pooled.insert(7, "seven");
+  EXPECT_EQ(pooled.at(7), "seven");
+}
+
+// Проверка копирования, перемещения и обмена словарей с пулом узлов
+TEST(PooledMapTest, CopyMoveSwap) {
+  PooledMap<int, int> first;
+  for (int i = 0; i < 100; ++i) first.insert(i, i * i);
+
+  PooledMap<int, int> copy(first);
+  first.clear();
+  EXPECT_EQ(copy.size(), 100);
+  EXPECT_EQ(copy.at(9), 81);
+
+  PooledMap<int, int> moved(std::move(copy));
+  EXPECT_EQ(moved.at(9), 81);
+  moved.insert(1000, 1);
+
+  first.insert(-1, -1);
+  first.swap(moved);
+  EXPECT_EQ(first.size(), 101);
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved.at(-1), -1);
+
+  moved = first;
+  first = PooledMap<int, int>();
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(moved.at(1000), 1);
+}
+
+// Ресурс памяти, считающий выделения
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t align) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void *p, size_t bytes, size_t align) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Узлы и строки внутри них выделяются из ресурса словаря
+TEST(PmrMapTest, NodesAndElementsUseResource) {
+  CountingResource resource;
+  s21::pmr::map<int, std::pmr::string> dict(&resource);
+  EXPECT_EQ(dict.get_allocator().resource(), &resource);
+  for (int i = 0; i < 100; ++i) {
+    dict.insert(i, std::pmr::string(40, static_cast<char>('a' + i % 26)));
+  }
+  EXPECT_EQ(dict.size(), 100);
+  EXPECT_GE(resource.allocations, 200u);
+  auto it = dict.find(7);
+  EXPECT_EQ((*it).second.get_allocator().resource(), &resource);
+  EXPECT_EQ((*it).second, std::pmr::string(40, 'h'));
+}
+
+// Перемещение между разными ресурсами переносит элементы в свой ресурс
+TEST(PmrMapTest, MoveAssignAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  s21::pmr::map<int, int> first(&first_pool);
+  s21::pmr::map<int, int> second(&second_pool);
+  for (int i = 0; i < 50; ++i) first.insert(i, i * i);
+  second = std::move(first);
+  EXPECT_EQ(second.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(second.size(), 50);
+  EXPECT_EQ(second.at(7), 49);
+  EXPECT_TRUE(first.empty());
+
+  s21::pmr::map<int, int> copy(second);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(copy.at(49), 2401);
+}
+
+// Значение, считающее свои копирования
+struct CopyCounted {
+  static int copies;
+  int value = 0;
+  CopyCounted() = default;
+  explicit CopyCounted(int v) : value(v) {}
+  CopyCounted(const CopyCounted &other) : value(other.value) { ++copies; }
+  CopyCounted(CopyCounted &&other) noexcept = default;
+  CopyCounted &operator=(const CopyCounted &other) = default;
+  CopyCounted &operator=(CopyCounted &&other) noexcept = default;
+};
+int CopyCounted::copies = 0;
+
+// Перемещение между разными ресурсами не копирует элементы
+TEST(PmrMapTest, MoveAssignAcrossResourcesMovesElements) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  s21::pmr::map<int, CopyCounted> first(&first_pool);
+  s21::pmr::map<int, CopyCounted> second(&second_pool);
+  for (int i = 0; i < 50; ++i) first.insert(i, CopyCounted(i * i));
+  CopyCounted::copies = 0;
+  second = std::move(first);
+  EXPECT_EQ(CopyCounted::copies, 0);
+  EXPECT_EQ(second.size(), 50);
+  EXPECT_EQ(second.at(7).value, 49);
+  EXPECT_TRUE(first.empty());
+
+  s21::pmr::map<int, CopyCounted> third(std::move(second), &first_pool);
+  EXPECT_EQ(CopyCounted::copies, 0);
+  EXPECT_EQ(third.get_allocator().resource(), &first_pool);
+  EXPECT_EQ(third.at(9).value, 81);
+  EXPECT_TRUE(second.empty());
+}
+
+// Копирование и перемещение в словарь с заданным ресурсом
+TEST(PmrMapTest, AllocatorExtendedConstructors) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::map<int, std::pmr::string> other(&first_pool);
+  for (int i = 0; i < 20; ++i) {
+    other.insert(i, std::pmr::string(30, static_cast<char>('a' + i)));
+  }
+  s21::pmr::map<int, std::pmr::string> m(other, &arena);
+  EXPECT_EQ(m.get_allocator().resource(), &arena);
+  EXPECT_EQ(m.size(), 20);
+  EXPECT_EQ(m.at(3).get_allocator().resource(), &arena);
+  EXPECT_EQ(other.size(), 20);
+
+  const auto *node = &*other.find(5);
+  s21::pmr::map<int, std::pmr::string> same(std::move(other), &first_pool);
+  EXPECT_EQ(&*same.find(5), node);
+  EXPECT_TRUE(other.empty());
+  s21::pmr::map<int, std::pmr::string> moved(std::move(same), &arena);
+  EXPECT_EQ(moved.get_allocator().resource(), &arena);
+  EXPECT_EQ(moved.size(), 20);
+  EXPECT_EQ(moved.at(5), std::pmr::string(30, 'f'));
+  EXPECT_EQ(moved.at(5).get_allocator().resource(), &arena);
+  EXPECT_EQ((*--moved.end()).first, 19);
+  EXPECT_TRUE(same.empty());
+}
+
+// Между разными ресурсами элементы перемещаются, поэтому подходят значения
+// только с перемещением
+TEST(PmrMapTest, MoveOnlyValuesAcrossResources) {
+  using UniqueMap = s21::pmr::map<int, std::unique_ptr<int>>;
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  UniqueMap first(&first_pool);
+  UniqueMap second(&second_pool);
+  for (int i = 0; i < 50; ++i) first.emplace(i, std::make_unique<int>(i * i));
+  const int *seven = first.at(7).get();
+  second = std::move(first);
+  EXPECT_EQ(second.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(second.size(), 50);
+  EXPECT_EQ(second.at(7).get(), seven);
+  EXPECT_TRUE(first.empty());
+
+  UniqueMap high(&first_pool);
+  for (int i = 60; i < 80; ++i) high.emplace(i, std::make_unique<int>(-i));
+  second.join(high);
+  EXPECT_TRUE(high.empty());
+  EXPECT_EQ(second.size(), 70);
+  EXPECT_EQ(*second.at(79), -79);
+
+  UniqueMap delta(&first_pool);
+  delta.emplace(7, std::make_unique<int>(0));
+  delta.emplace(100, std::make_unique<int>(100));
+  second.set_union(std::move(delta));
+  EXPECT_EQ(second.size(), 71);
+  EXPECT_EQ(second.at(7).get(), seven);
+  EXPECT_EQ(*second.at(100), 100);
+
+  UniqueMap keys(&first_pool);
+  for (int i = 0; i < 10; ++i) keys.emplace(i, nullptr);
+  second.set_intersection(std::move(keys));
+  EXPECT_EQ(second.size(), 10);
+  UniqueMap odd(&first_pool);
+  for (int i = 1; i < 10; i += 2) odd.emplace(i, nullptr);
+  second.set_difference(std::move(odd));
+  EXPECT_EQ(second.size(), 5);
+  EXPECT_EQ(*second.at(8), 64);
+  for (const auto &item : second) {
+    EXPECT_EQ(*item.second, item.first * item.first);
+  }
+}
+
+// Словарь на монотонном буфере с пулом узлов
+TEST(PmrMapTest, PooledOnMonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource buffer;
+  s21::pmr::map<int, int, std::less<int>, s21::PooledTreePolicy> dict(&buffer);
+  for (int i = 0; i < 1000; ++i) dict.insert(i, -i);
+  for (int i = 0; i < 1000; i += 3) dict.erase(dict.find(i));
+  EXPECT_EQ(dict.size(), 666);
+  EXPECT_FALSE(dict.contains(999));
+  EXPECT_EQ(dict.at(998), -998);
+}
+
+// Поиск и вставка делают одно сравнение на уровень и одно в конце спуска
+TEST(MapCompareTest, OneComparisonPerLevel) {
+  s21::map<CountingKey, int> counted;
+  for (int i = 0; i < 1023; ++i) counted.insert({CountingKey{i * 2}, i});
+  double max_per_descent = 2 * std::log2(counted.size() + 1) + 1;
+
+  CountingKey::comparisons = 0;
+  EXPECT_TRUE(counted.contains(CountingKey{600}));
+  EXPECT_LE(CountingKey::comparisons, max_per_descent);
+
+  CountingKey::comparisons = 0;
+  EXPECT_EQ(counted.find(CountingKey{601}), counted.end());
+  EXPECT_LE(CountingKey::comparisons, max_per_descent);
+
+  CountingKey::comparisons = 0;
+  EXPECT_FALSE(counted.insert(CountingKey{602}, 0).second);
+  EXPECT_LE(CountingKey::comparisons, max_per_descent);
+}
+
+// Пользовательский компаратор задает порядок обхода
+TEST(MapCompareTest, CustomComparator) {
+  s21::map<int, char, std::greater<int>> desc;
+  desc.insert_many(std::pair<const int, char>{1, 'a'},
+                   std::pair<const int, char>{3, 'c'},
+                   std::pair<const int, char>{2, 'b'});
+  std::string order;
+  for (auto it = desc.begin(); it != desc.end(); ++it) order += (*it).second;
+  EXPECT_EQ(order, "cba");
+  EXPECT_TRUE(desc.contains(2));
+  EXPECT_FALSE(desc.insert(3, 'z').second);
+  EXPECT_EQ(desc.at(3), 'c');
+  EXPECT_TRUE(desc.key_comp()(3, 1));
+}
+
+// Компаратор с состоянием копируется вместе со словарем
+TEST(MapCompareTest, StatefulComparator) {
+  struct ModuloLess {
+    int modulo;
+    bool operator()(int a, int b) const { return a % modulo < b % modulo; }
+  };
+  s21::map<int, int, ModuloLess> by_mod(ModuloLess{10});
+  by_mod.insert(15, 1);
+  EXPECT_FALSE(by_mod.insert(25, 2).second);
+  s21::map<int, int, ModuloLess> copy(by_mod);
+  EXPECT_TRUE(copy.contains(5));
+  EXPECT_EQ(copy.key_comp().modulo, 10);
+}
+
+// Прозрачный компаратор: поиск по string_view и const char* без std::string
+TEST(MapCompareTest, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> dict;
+  dict.insert("alpha", 1);
+  dict.insert("beta", 2);
+  std::string_view view = "beta";
+  EXPECT_TRUE(dict.contains(view));
+  EXPECT_FALSE(dict.contains("gamma"));
+  EXPECT_EQ((*dict.find(view)).second, 2);
+  EXPECT_EQ((*dict.find("alpha")).second, 1);
+  EXPECT_EQ(dict.find(std::string_view("zeta")), dict.end());
+  const auto &cdict = dict;
+  EXPECT_EQ((*cdict.find("alpha")).second, 1);
+}
+
+// Построение словаря из отсортированного диапазона с повторами
+TEST(MapBulkTest, RangeConstructorFromSorted) {
+  std::vector<std::pair<int, std::string>> rows;
+  for (int i = 0; i < 1000; ++i) rows.push_back({i / 2, std::to_string(i)});
+  s21::map<int, std::string> index(rows.begin(), rows.end());
+  EXPECT_EQ(index.size(), 500);
+  EXPECT_EQ(index.at(0), "0");
+  EXPECT_EQ(index.at(499), "998");
+  int expected = 0;
+  for (auto it = index.begin(); it != index.end(); ++it) {
+    EXPECT_EQ((*it).first, expected++);
+  }
+  index.assign_sorted(rows.begin(), rows.begin() + 10);
+  EXPECT_EQ(index.size(), 5);
+  EXPECT_FALSE(index.contains(5));
+  index.insert(5, "five");
+  EXPECT_EQ(index.size(), 6);
+}
+
+// Диапазон с пользовательским компаратором и неупорядоченными ключами
+TEST(MapBulkTest, RangeConstructorUnsortedWithComparator) {
+  std::vector<std::pair<int, int>> rows = {{3, 0}, {1, 0}, {2, 0}, {3, 1}};
+  s21::map<int, int, std::greater<int>> desc(rows.begin(), rows.end());
+  EXPECT_EQ(desc.size(), 3);
+  EXPECT_EQ((*desc.begin()).first, 3);
+  EXPECT_EQ(desc.at(3), 0);
+}
+
+// Словарь с порядковой статистикой
+TEST(MapOrderStatisticTest, NthRankAndDistance) {
+  s21::map<int, std::string, std::less<int>,
+           std::allocator<std::pair<const int, std::string>>,
+           s21::OrderStatisticTreePolicy>
+      scores;
+  for (int i = 10; i > 0; --i) scores.insert(i * 10, std::to_string(i));
+  EXPECT_EQ((*scores.nth(0)).first, 10);
+  EXPECT_EQ((*scores.nth(9)).second, "10");
+  EXPECT_EQ(scores.nth(10), scores.end());
+  EXPECT_EQ(scores.rank(55), 5);
+  EXPECT_EQ(scores.find(70) - scores.begin(), 6);
+
+  scores.erase(scores.find(20));
+  EXPECT_EQ((*scores.nth(1)).first, 30);
+  EXPECT_EQ(scores.end() - scores.find(30), 8);
+
+  const auto &view = scores;
+  EXPECT_EQ((*view.nth(2)).first, 40);
+}
+
+// Границы словаря для выборки диапазона ключей
+TEST(MapBoundsTest, RangeScan) {
+  s21::map<int, std::string> prices;
+  for (int i = 0; i < 20; ++i) prices.insert(i * 5, std::to_string(i));
+  int sum = 0;
+  for (auto it = prices.lower_bound(23); it != prices.upper_bound(50); ++it) {
+    sum += (*it).first;
+  }
+  EXPECT_EQ(sum, 25 + 30 + 35 + 40 + 45 + 50);
+  EXPECT_EQ(prices.lower_bound(100), prices.end());
+  EXPECT_EQ((*prices.upper_bound(-1)).first, 0);
+
+  auto hit = prices.equal_range(35);
+  EXPECT_EQ((*hit.first).second, "7");
+  EXPECT_EQ((*hit.second).first, 40);
+  auto miss = prices.equal_range(36);
+  EXPECT_EQ(miss.first, miss.second);
+
+  const auto &view = prices;
+  EXPECT_EQ((*view.lower_bound(36)).first, 40);
+  EXPECT_EQ((*view.upper_bound(40)).first, 45);
+  EXPECT_EQ((*view.equal_range(45).first).second, "9");
+}
+
+// Границы словаря по сравнимому с ключом типу
+TEST(MapBoundsTest, TransparentBounds) {
+  s21::map<std::string, int, std::less<>> words;
+  words.insert("apple", 1);
+  words.insert("banana", 2);
+  words.insert("cherry", 3);
+  EXPECT_EQ((*words.lower_bound(std::string_view("b"))).first, "banana");
+  EXPECT_EQ((*words.upper_bound(std::string_view("banana"))).first, "cherry");
+  auto range = words.equal_range(std::string_view("cherry"));
+  EXPECT_EQ((*range.first).second, 3);
+  EXPECT_EQ(range.second, words.end());
+  const auto &view = words;
+  EXPECT_EQ((*view.lower_bound(std::string_view("a"))).first, "apple");
+}
+
+// Разделение словаря по ключу и обратное соединение
+TEST(MapSplitJoinTest, SplitAndJoinBack) {
+  s21::map<int, std::string> prices;
+  for (int i = 0; i < 20; ++i) prices.insert(i * 5, std::to_string(i));
+  auto high = prices.split(42);
+  EXPECT_EQ(prices.size(), 9);
+  EXPECT_EQ(high.size(), 11);
+  EXPECT_EQ((*high.begin()).first, 45);
+  EXPECT_FALSE(prices.contains(45));
+  EXPECT_EQ(prices.at(40), "8");
+
+  auto top = high.split(80);
+  s21::map<int, std::string> empty;
+  prices.join(empty);
+  prices.join({42, "pivot"}, high);
+  EXPECT_TRUE(high.empty());
+  EXPECT_EQ(prices.size(), 17);
+  EXPECT_EQ(prices.at(42), "pivot");
+  EXPECT_THROW(top.join(prices), std::invalid_argument);
+  prices.join(top);
+  EXPECT_EQ(prices.size(), 21);
+  EXPECT_EQ((*--prices.end()).first, 95);
+}
+
+// Разрезание по корню и ключам его левого края оставляет корни частей
+// черными: после него работают вставка и обратный обход от end()
+TEST(MapSplitJoinTest, SplitAtRootSpineKeepsBlackRoot) {
+  s21::map<int, int> small{{1, 1}, {2, 2}, {3, 3}};
+  auto upper = small.split(2);
+  small.insert({0, 0});
+  upper.insert({4, 4});
+  EXPECT_EQ((*--small.end()).first, 1);
+  EXPECT_EQ((*--upper.end()).first, 4);
+
+  for (int key : {1, 2, 3, 4, 5}) {
+    s21::map<int, int> map;
+    for (int i = 1; i <= 8; ++i) map.insert(i, i);
+    auto right = map.split(key);
+    std::vector<int> keys;
+    for (auto it = map.end(); it != map.begin();) keys.push_back((*--it).first);
+    std::vector<int> expected;
+    for (int i = key - 1; i >= 1; --i) expected.push_back(i);
+    EXPECT_EQ(keys, expected) << key;
+    keys.clear();
+    for (auto it = right.end(); it != right.begin();) {
+      keys.push_back((*--it).first);
+    }
+    expected.clear();
+    for (int i = 8; i >= key; --i) expected.push_back(i);
+    EXPECT_EQ(keys, expected) << key;
+
+    map.insert(0, 0);
+    right.insert(9, 9);
+    map.join(right);
+    keys.clear();
+    for (auto it = map.end(); it != map.begin();) keys.push_back((*--it).first);
+    EXPECT_EQ(keys, (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0})) << key;
+  }
+}
+
+// Словарь с пулом узлов не может передать узлы другой части, поэтому
+// разделение перемещает значения: подходят типы только с перемещением
+TEST(MapSplitJoinTest, PooledSplitMovesValues) {
+  s21::map<int, std::unique_ptr<int>, std::less<int>,
+           std::allocator<std::pair<const int, std::unique_ptr<int>>>,
+           s21::PooledTreePolicy>
+      pooled;
+  for (int i = 0; i < 30; ++i) pooled.emplace(i, std::make_unique<int>(i * i));
+  const int *square = pooled.at(20).get();
+  auto upper = pooled.split(12);
+  EXPECT_EQ(pooled.size(), 12);
+  EXPECT_EQ(upper.size(), 18);
+  EXPECT_EQ(upper.at(20).get(), square);
+  EXPECT_EQ(*upper.at(12), 144);
+  EXPECT_FALSE(pooled.contains(12));
+  EXPECT_EQ(*pooled.at(11), 121);
+
+  pooled.join(upper);
+  EXPECT_TRUE(upper.empty());
+  EXPECT_EQ(pooled.size(), 30);
+  EXPECT_EQ(pooled.at(20).get(), square);
+}
+
+// Вливание дельты в словарь и вычитание ключей
+TEST(MapSetAlgebraTest, UnionIntersectionDifference) {
+  s21::map<std::string, int> stock({{"apple", 3}, {"kiwi", 1}, {"pear", 7}});
+  s21::map<std::string, int> delta({{"kiwi", 4}, {"lime", 2}});
+  stock.set_union(delta, std::plus<int>());
+  EXPECT_EQ(stock.size(), 4);
+  EXPECT_EQ(stock.at("kiwi"), 5);
+  EXPECT_EQ(stock.at("lime"), 2);
+  EXPECT_EQ(delta.size(), 2);
+
+  s21::map<std::string, int> keep(stock);
+  keep.set_union(s21::map<std::string, int>({{"apple", 100}}));
+  EXPECT_EQ(keep.at("apple"), 3);
+
+  s21::map<std::string, int> wanted({{"apple", 0}, {"fig", 0}, {"pear", 1}});
+  keep.set_intersection(wanted, [](int ours, int theirs) {
+    return ours * 10 + theirs;
+  });
+  EXPECT_EQ(keep.size(), 2);
+  EXPECT_EQ(keep.at("apple"), 30);
+  EXPECT_EQ(keep.at("pear"), 71);
+
+  stock.set_difference(std::move(wanted));
+  EXPECT_EQ(stock.size(), 2);
+  EXPECT_FALSE(stock.contains("apple"));
+  EXPECT_EQ((*stock.begin()).first, "kiwi");
+}
+
+// Извлечение и вставка узлов, в том числе между разными ресурсами
+TEST(MapNodeHandleTest, ExtractInsertAcrossResources) {
+  s21::map<int, std::string> names({{1, "one"}, {2, "two"}, {3, "three"}});
+  s21::map<int, std::string>::node_type node = names.extract(names.find(2));
+  EXPECT_EQ(names.size(), 2);
+  EXPECT_EQ(node.key(), 2);
+  node.mapped() = "deux";
+  s21::map<int, std::string> french;
+  auto result = french.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ((*result.position).second, "deux");
+  EXPECT_TRUE(names.extract(5).empty());
+
+  CountingResource resource;
+  std::pmr::monotonic_buffer_resource other_pool;
+  s21::pmr::map<int, std::pmr::string> source(&resource);
+  s21::pmr::map<int, std::pmr::string> target(&other_pool);
+  source.insert(1, std::pmr::string("moved"));
+  source.insert(2, std::pmr::string("stays"));
+  target.insert(2, std::pmr::string("target"));
+  auto moved = target.insert(source.extract(1));
+  EXPECT_TRUE(moved.inserted);
+  EXPECT_EQ((*moved.position).second, "moved");
+  EXPECT_EQ((*moved.position).second.get_allocator().resource(), &other_pool);
+
+  target.merge(source);
+  EXPECT_EQ(target.size(), 2);
+  EXPECT_EQ(target.at(2), "target");
+  EXPECT_EQ(source.size(), 1);
+}
+
+// Вставка по подсказке возвращает элемент с ключом и не меняет найденный
+TEST(MapHintTest, InsertAndEmplaceHint) {
+  s21::map<int, std::string> log;
+  for (int i = 0; i < 100; ++i) {
+    auto it = log.emplace_hint(log.end(), i, std::to_string(i));
+    EXPECT_EQ((*it).first, i);
+  }
+  EXPECT_EQ(log.size(), 100);
+  auto it = log.insert(log.find(50), {50, "other"});
+  EXPECT_EQ((*it).second, "50");
+  it = log.insert(log.cbegin(), {-1, "first"});
+  EXPECT_TRUE(it == log.begin());
+  it = log.emplace_hint(log.find(10), 1000, "far");
+  EXPECT_EQ((*it).first, 1000);
+  EXPECT_EQ(log.size(), 102);
+  EXPECT_EQ((*log.find(1000)).second, "far");
+}
+
+// Значения только с перемещением вставляются без копий
+TEST(MapEmplaceTest, MoveOnlyValues) {
+  s21::map<int, std::unique_ptr<int>> owners;
+  EXPECT_TRUE(owners.insert(1, std::make_unique<int>(10)).second);
+  EXPECT_TRUE(owners.emplace(2, std::make_unique<int>(20)).second);
+  EXPECT_TRUE(owners.try_emplace(3, new int(30)).second);
+  std::pair<const int, std::unique_ptr<int>> entry(4, new int(40));
+  EXPECT_TRUE(owners.insert(std::move(entry)).second);
+  EXPECT_EQ(entry.second, nullptr);
+  auto it = owners.try_emplace(owners.cend(), 5, new int(50));
+  EXPECT_EQ(*(*it).second, 50);
+
+  auto spare = std::make_unique<int>(99);
+  auto [found, inserted] = owners.try_emplace(3, std::move(spare));
+  EXPECT_FALSE(inserted);
+  EXPECT_NE(spare, nullptr);
+  EXPECT_EQ(*(*found).second, 30);
+  EXPECT_FALSE(owners.emplace(2, std::make_unique<int>(0)).second);
+  EXPECT_EQ(*owners.at(2), 20);
+  EXPECT_EQ(owners.size(), 5);
+}
+
+// try_emplace перемещает ключ только при вставке
+TEST(MapEmplaceTest, TryEmplaceMovesKeyOnlyOnInsert) {
+  s21::map<std::string, std::vector<int>> index;
+  std::string key(64, 'k');
+  auto [it, inserted] = index.try_emplace(std::move(key), 3, 7);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ((*it).second, std::vector<int>(3, 7));
+
+  std::string again(64, 'k');
+  EXPECT_FALSE(index.try_emplace(std::move(again), 5, 1).second);
+  EXPECT_EQ(again, std::string(64, 'k'));
+  EXPECT_EQ(index.at(std::string(64, 'k')).size(), 3);
+
+  std::vector<int> payload(1000, 1);
+  EXPECT_TRUE(index.insert("big", std::move(payload)).second);
+  EXPECT_TRUE(payload.empty());
+  EXPECT_EQ(index.at("big").size(), 1000);
+}
+
+// Значение, считающее конструкторы и присваивания
+struct CountedValue {
+  static inline int constructed = 0;
+  static inline int copied = 0;
+  static inline int assigned = 0;
+  int value = 0;
+
+  CountedValue() { ++constructed; }
+  explicit CountedValue(int v) : value(v) { ++constructed; }
+  CountedValue(const CountedValue &other) : value(other.value) { ++copied; }
+  CountedValue &operator=(const CountedValue &other) {
+    value = other.value;
+    ++assigned;
+    return *this;
+  }
+  CountedValue &operator=(int v) {
+    value = v;
+    ++assigned;
+    return *this;
+  }
+};
+
+// operator[] и insert_or_assign строят значение в узле и присваивают на месте
+TEST(MapCounterTest, SubscriptAndInsertOrAssignInPlace) {
+  s21::map<int, CountedValue> counters;
+  CountedValue::constructed = CountedValue::copied = CountedValue::assigned = 0;
+  counters[1].value += 5;
+  counters[1].value += 5;
+  EXPECT_EQ(counters[1].value, 10);
+  EXPECT_EQ(CountedValue::constructed, 1);
+  EXPECT_EQ(CountedValue::copied, 0);
+
+  auto [it, inserted] = counters.insert_or_assign(2, 7);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ((*it).second.value, 7);
+  auto *address = &(*it).second;
+  auto [again, added] = counters.insert_or_assign(2, 9);
+  EXPECT_FALSE(added);
+  EXPECT_EQ(&(*again).second, address);
+  EXPECT_EQ(address->value, 9);
+  CountedValue eleven(11);
+  counters.insert_or_assign(1, eleven);
+  EXPECT_EQ(counters[1].value, 11);
+  EXPECT_EQ(CountedValue::constructed, 3);
+  EXPECT_EQ(CountedValue::copied, 0);
+  EXPECT_EQ(CountedValue::assigned, 2);
+  EXPECT_EQ(counters.size(), 2);
+
+  s21::map<std::string, int> words;
+  std::string word(64, 'x');
+  ++words[std::move(word)];
+  ++words[std::string(64, 'x')];
+  EXPECT_EQ(words.at(std::string(64, 'x')), 2);
+  EXPECT_EQ(words.insert_or_assign(std::string("y"), 4).second, true);
+  EXPECT_EQ(words.at("y"), 4);
+}
+
+// Константный обход возвращает ссылки на элементы в узлах, а не копии
+TEST(MapConstIterationTest, ReferencesIntoNodes) {
+  s21::map<int, std::string> config({{1, std::string(100, 'a')},
+                                     {2, std::string(100, 'b')},
+                                     {3, std::string(100, 'c')}});
+  const auto &view = config;
+  auto mutable_it = config.begin();
+  for (const auto &entry : view) {
+    EXPECT_EQ(&entry, &*mutable_it);
+    ++mutable_it;
+  }
+  auto it = view.find(2);
+  EXPECT_EQ(it->second.size(), 100);
+  EXPECT_EQ(&it->second, &config.at(2));
+  s21::map<int, std::string>::const_iterator first = view.begin();
+  EXPECT_EQ(&(*first).first, &(*config.begin()).first);
+  EXPECT_TRUE((std::is_same_v<decltype(*first),
+                              const std::pair<const int, std::string> &>));
+  EXPECT_TRUE((std::is_same_v<decltype(first.operator->()),
+                              const std::pair<const int, std::string> *>));
+}
+
+// Обратный обход: последние записи журнала без копирования в буфер
+TEST(MapReverseIteratorTest, LatestEntriesAndStdAlgorithms) {
+  using Log = s21::map<int, std::string>;
+  EXPECT_TRUE((std::is_same_v<
+               std::iterator_traits<Log::iterator>::iterator_category,
+               std::bidirectional_iterator_tag>));
+  EXPECT_TRUE((std::is_same_v<
+               std::iterator_traits<Log::const_iterator>::iterator_category,
+               std::bidirectional_iterator_tag>));
+  Log log;
+  for (int ts = 1; ts <= 10; ++ts) log.insert(ts * 10, std::to_string(ts));
+
+  std::vector<int> latest;
+  for (auto it = log.rbegin(); it != log.rend() && latest.size() < 3; ++it) {
+    latest.push_back(it->first);
+  }
+  EXPECT_EQ(latest, (std::vector<int>{100, 90, 80}));
+  EXPECT_EQ(std::prev(log.end())->first, 100);
+  EXPECT_EQ(std::prev(log.cend(), 2)->second, "9");
+
+  std::vector<std::pair<const int, std::string>> expected(log.begin(),
+                                                          log.end());
+  EXPECT_TRUE(std::equal(log.crbegin(), log.crend(), expected.rbegin()));
+  const Log &view = log;
+  EXPECT_EQ(std::distance(view.rbegin(), view.rend()), 10);
+  EXPECT_EQ(&*view.rbegin(), &*std::prev(log.end()));
+  log.rbegin()->second = "last";
+  EXPECT_EQ(log.at(100), "last");
+  Log empty;
+  EXPECT_TRUE(empty.rbegin() == empty.rend());
+}
+
+// Пакетный поиск совпадает с find для каждого ключа, включая повторы и
+// отсутствующие ключи, и сохраняет порядок ключей
+TEST(MapFindManyTest, MatchesFindInKeyOrder) {
+  s21::map<int, int> squares;
+  for (int i = 0; i < 1000; i += 3) squares.insert(i, i * i);
+  std::vector<int> keys;
+  for (int i = 1100; i >= -5; --i) keys.push_back(i);
+  keys.push_back(9);
+  keys.push_back(9);
+
+  std::vector<s21::map<int, int>::iterator> found;
+  squares.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == squares.find(keys[i])) << keys[i];
+  }
+  found[1100 - 999]->second = -1;  // keys[101] == 999
+  EXPECT_EQ(squares.at(999), -1);
+
+  const auto& view = squares;
+  std::vector<s21::map<int, int>::const_iterator> constFound(keys.size());
+  auto end = view.find_many(keys.begin(), keys.end(), constFound.begin());
+  EXPECT_TRUE(end == constFound.end());
+  std::vector<bool> present;
+  view.contains_many(keys.begin(), keys.end(), std::back_inserter(present));
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(present[i], squares.contains(keys[i])) << keys[i];
+    EXPECT_EQ(constFound[i] != view.end(), present[i]) << keys[i];
+  }
+
+  s21::map<int, int> empty;
+  std::vector<bool> none;
+  empty.contains_many(keys.begin(), keys.end(), std::back_inserter(none));
+  EXPECT_EQ(std::count(none.begin(), none.end(), true), 0);
+  EXPECT_EQ(none.size(), keys.size());
+}
+
+// Снимок словаря: поиск, границы и обход совпадают с исходным map при
+// любом размере, включая неполный последний уровень, а изменения map
+// снимок не затрагивают
+TEST(FrozenMapTest, MatchesSourceMap) {
+  for (int count : {0, 1, 2, 3, 7, 8, 100, 1000}) {
+    s21::map<int, std::string> source;
+    for (int i = 0; i < count; ++i) source.insert(i * 2, std::to_string(i));
+    s21::frozen_map<int, std::string> frozen = source.freeze();
+    ASSERT_EQ(frozen.size(), source.size());
+
+    std::vector<int> keys;
+    for (auto it = frozen.begin(); it != frozen.end(); ++it) {
+      EXPECT_EQ(it->second, source.at(it->first));
+      keys.push_back((*it).first);
+    }
+    std::vector<int> expected;
+    for (const auto& item : source) expected.push_back(item.first);
+    EXPECT_EQ(keys, expected);
+    std::vector<int> reversed;
+    for (auto it = frozen.rbegin(); it != frozen.rend(); ++it) {
+      reversed.push_back(it->first);
+    }
+    EXPECT_EQ(reversed, std::vector<int>(expected.rbegin(), expected.rend()));
+
+    for (int key = -1; key <= count * 2; ++key) {
+      EXPECT_EQ(frozen.contains(key), source.contains(key)) << key;
+      auto bound = frozen.lower_bound(key);
+      auto sourceBound = source.lower_bound(key);
+      if (sourceBound == source.end()) {
+        EXPECT_TRUE(bound == frozen.end()) << key;
+      } else {
+        ASSERT_TRUE(bound != frozen.end()) << key;
+        EXPECT_EQ(bound.key(), sourceBound->first);
+        EXPECT_EQ(bound.value(), sourceBound->second);
+      }
+    }
+    source.clear();
+    EXPECT_EQ(frozen.size(), static_cast<size_t>(count));
+  }
+
+  s21::map<std::string, int, std::less<>> words{{"one", 1}, {"two", 2}};
+  auto frozen = words.freeze();
+  EXPECT_EQ(frozen.at("two"), 2);
+  EXPECT_TRUE(frozen.find(std::string_view("one")) != frozen.end());
+  EXPECT_THROW(frozen.at("three"), std::out_of_range);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../s21_containers.h"
+
+namespace {
+
+// Словарь с проверкой свойств красно-черного дерева
+class CheckedMap : public s21::persistent_map<int, int> {
+ public:
+  using persistent_map::persistent_map;
+
+  // Корень черный, красный узел без красных потомков, черная высота
+  // одинакова на всех путях, ключи упорядочены
+  bool IsValid() const {
+    if (root_ && root_->color != s21::BLACK) return false;
+    return BlackHeight(root_.get()) >= 0;
+  }
+
+ private:
+  int BlackHeight(const Node* node) const {
+    if (node == nullptr) return 1;
+    const Node* left = node->left.get();
+    const Node* right = node->right.get();
+    if (node->color == s21::RED &&
+        ((left && left->color == s21::RED) ||
+         (right && right->color == s21::RED))) {
+      return -1;
+    }
+    if ((left && !comp_(left->data.first, node->data.first)) ||
+        (right && !comp_(node->data.first, right->data.first))) {
+      return -1;
+    }
+    int leftHeight = BlackHeight(left);
+    int rightHeight = BlackHeight(right);
+    if (leftHeight < 0 || leftHeight != rightHeight) return -1;
+    return leftHeight + (node->color == s21::BLACK ? 1 : 0);
+  }
+};
+
+template <typename Tree>
+std::map<int, int> Contents(const Tree& tree) {
+  std::map<int, int> result;
+  for (const auto& item : tree) result.emplace(item.first, item.second);
+  return result;
+}
+
+}  // namespace
+
+// Случайные вставки, замены и удаления совпадают с std::map, дерево
+// остается красно-черным
+TEST(PersistentMapTest, ChurnMatchesStdMap) {
+  std::mt19937 gen(25);
+  CheckedMap map;
+  std::map<int, int> reference;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 2000);
+    switch (gen() % 4) {
+      case 0:
+        EXPECT_EQ(map.erase(key), reference.erase(key));
+        break;
+      case 1:
+        EXPECT_EQ(map.insert_or_assign(key, i),
+                  reference.insert_or_assign(key, i).second);
+        break;
+      default:
+        EXPECT_EQ(map.insert(key, i), reference.emplace(key, i).second);
+    }
+    if (i % 1000 == 0) {
+      ASSERT_TRUE(map.IsValid()) << i;
+    }
+  }
+  ASSERT_TRUE(map.IsValid());
+  EXPECT_EQ(map.size(), reference.size());
+  EXPECT_EQ(Contents(map), reference);
+
+  for (int key = -1; key <= 2000; ++key) {
+    auto bound = map.lower_bound(key);
+    auto expected = reference.lower_bound(key);
+    if (expected == reference.end()) {
+      EXPECT_TRUE(bound == map.end());
+    } else {
+      EXPECT_EQ(bound->first, expected->first);
+    }
+    EXPECT_EQ(map.find(key) != map.end(), reference.count(key) == 1);
+  }
+
+  for (const auto& item : reference) ASSERT_EQ(map.erase(item.first), 1u);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+}
+
+// Снимки не меняются при последующих изменениях словаря и переживают его
+TEST(PersistentMapTest, SnapshotsAreIndependent) {
+  std::mt19937 gen(26);
+  std::vector<s21::persistent_map_snapshot<int, int>> snapshots;
+  std::vector<std::map<int, int>> expected;
+  {
+    s21::persistent_map<int, int> map{{1, 1}, {2, 2}, {1, 5}};
+    EXPECT_EQ(map.at(1), 1);
+    std::map<int, int> reference{{1, 1}, {2, 2}};
+    for (int round = 0; round < 20; ++round) {
+      snapshots.push_back(map.snapshot());
+      expected.push_back(reference);
+      for (int i = 0; i < 300; ++i) {
+        int key = static_cast<int>(gen() % 500);
+        if (gen() % 3 == 0) {
+          map.erase(key);
+          reference.erase(key);
+        } else {
+          map.insert_or_assign(key, round);
+          reference[key] = round;
+        }
+      }
+    }
+    map.clear();
+    EXPECT_TRUE(map.empty());
+  }
+  for (size_t i = 0; i < snapshots.size(); ++i) {
+    EXPECT_EQ(snapshots[i].size(), expected[i].size());
+    EXPECT_EQ(Contents(snapshots[i]), expected[i]) << i;
+  }
+  EXPECT_THROW(snapshots[0].at(1000), std::out_of_range);
+}
+
+// Изменение после снимка копирует только путь: остальные узлы общие
+TEST(PersistentMapTest, UpdateCopiesOnlyPath) {
+  s21::persistent_map<int, std::string> map;
+  for (int i = 0; i < 4096; ++i) map.insert(i, std::to_string(i));
+  auto snapshot = map.snapshot();
+  map.insert_or_assign(1234, "changed");
+  map.erase(77);
+  map.insert(5000, "new");
+
+  size_t shared = 0;
+  auto it = map.begin();
+  for (const auto& item : snapshot) {
+    if (item.first == 77) continue;
+    ASSERT_EQ(it->first, item.first);
+    if (&*it == &item) ++shared;
+    ++it;
+  }
+  EXPECT_GT(shared, 4096u - 3 * 30);
+  EXPECT_EQ(snapshot.at(1234), "1234");
+  EXPECT_EQ(map.at(1234), "changed");
+  EXPECT_TRUE(snapshot.contains(77));
+  EXPECT_FALSE(map.contains(77));
+  EXPECT_EQ(map.erase(77), 0u);
+
+  s21::persistent_map<int, std::string> moved(std::move(map));
+  EXPECT_EQ(moved.size(), 4096u);
+  EXPECT_TRUE(map.empty());
+}
+
+// Читатели обходят свои снимки, пока писатель меняет словарь
+TEST(PersistentMapTest, ReadersWhileWriterMutates) {
+  s21::persistent_map<int, int> map;
+  for (int i = 0; i < 1000; ++i) map.insert(i, i);
+  std::vector<std::thread> readers;
+  std::vector<long> sums(4, 0);
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([snapshot = map.snapshot(), &sum = sums[r]] {
+      for (int pass = 0; pass < 50; ++pass) {
+        for (const auto& item : snapshot) sum += item.second;
+      }
+    });
+    for (int i = 0; i < 1000; ++i) map.insert_or_assign(i, (r + 2) * i);
+  }
+  for (auto& reader : readers) reader.join();
+  for (int r = 0; r < 4; ++r) {
+    EXPECT_EQ(sums[r], 50L * (r + 1) * 999 * 1000 / 2) << r;
+  }
+}
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "../../s21_containers.h"
 
 class SetTest : public ::testing::Test {
@@ -235,3 +241,326 @@ TEST_F(SetTest, InitializerListConstructorFull) {
   ++it;
   EXPECT_EQ(*it, 8);
 }
+
+// Проверка того, что узел множества хранит ключ ровно один раз
+TEST_F(SetTest, NodeStoresKeyOnce) {
+  using Node = s21::set<std::string>::RBTreeNode;
+  EXPECT_LE(sizeof(Node), sizeof(std::string) + 4 * sizeof(void *));
+
+  s21::set<std::string> words{"b", "a", "c"};
+  auto it = words.begin();
+  EXPECT_EQ(*it, "a");
+  words.erase(words.find("b"));
+  EXPECT_FALSE(words.contains("b"));
+  EXPECT_EQ(words.size(), 2);
+}
+
+template <typename K>
+using PooledSet =
+    s21::set<K, std::less<K>, std::allocator<K>, s21::PooledTreePolicy>;
+
+// Проверка множества с пулом узлов и нетривиальными элементами
+TEST(PooledSetTest, StringKeys) {
+  PooledSet<std::string> words;
+  for (int i = 0; i < 200; ++i) words.insert("word" + std::to_string(i));
+  EXPECT_EQ(words.size(), 200);
+  words.erase(words.find("word42"));
+  EXPECT_FALSE(words.contains("word42"));
+
+  PooledSet<std::string> other(std::move(words));
+  EXPECT_EQ(other.size(), 199);
+  other.clear();
+  other.insert("again");
+  EXPECT_TRUE(other.contains("again"));
+}
+
+// Множество строк на монотонном буфере
+TEST(PmrSetTest, MonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource buffer;
+  s21::pmr::set<std::pmr::string> words(&buffer);
+  EXPECT_EQ(words.get_allocator().resource(), &buffer);
+  words.insert(std::pmr::string("a fairly long string that needs heap"));
+  words.insert(std::pmr::string("short"));
+  words.insert(std::pmr::string("short"));
+  EXPECT_EQ(words.size(), 2);
+  EXPECT_TRUE(words.contains(std::pmr::string("short")));
+  s21::pmr::set<std::pmr::string> moved(std::move(words));
+  EXPECT_EQ(moved.get_allocator().resource(), &buffer);
+  EXPECT_EQ(moved.size(), 2);
+}
+
+// Копирование и перемещение в множество с заданным ресурсом
+TEST(PmrSetTest, AllocatorExtendedConstructors) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::set<int> other(&first_pool);
+  for (int i = 0; i < 30; ++i) other.insert(i * 3);
+  s21::pmr::set<int> copy(other, &arena);
+  EXPECT_EQ(copy.get_allocator().resource(), &arena);
+  EXPECT_EQ(copy.size(), 30);
+  EXPECT_TRUE(copy.contains(87));
+
+  s21::pmr::set<int> moved(std::move(other), &arena);
+  EXPECT_EQ(moved.get_allocator().resource(), &arena);
+  EXPECT_EQ(moved.size(), 30);
+  EXPECT_EQ(*moved.begin(), 0);
+  EXPECT_TRUE(other.empty());
+}
+
+// Прозрачный компаратор, сравнивающий строки по длине с числами
+struct LengthLess {
+  using is_transparent = void;
+  bool operator()(const std::string &a, const std::string &b) const {
+    return a.size() < b.size();
+  }
+  bool operator()(const std::string &a, size_t length) const {
+    return a.size() < length;
+  }
+  bool operator()(size_t length, const std::string &b) const {
+    return length < b.size();
+  }
+};
+
+// Поиск по типу, из которого ключ не строится
+TEST(SetCompareTest, TransparentLookupWithoutConversion) {
+  s21::set<std::string, LengthLess> by_length;
+  by_length.insert("a");
+  by_length.insert("abc");
+  by_length.insert("xyz");
+  EXPECT_EQ(by_length.size(), 2);
+  EXPECT_TRUE(by_length.contains(size_t{3}));
+  EXPECT_FALSE(by_length.contains(size_t{2}));
+  EXPECT_EQ(*by_length.find(size_t{1}), "a");
+  EXPECT_EQ(by_length.find(size_t{7}), by_length.end());
+}
+
+// Множество с обратным порядком
+TEST(SetCompareTest, CustomComparator) {
+  s21::set<int, std::greater<int>> desc({1, 5, 3});
+  auto it = desc.begin();
+  EXPECT_EQ(*it, 5);
+  ++it;
+  EXPECT_EQ(*it, 3);
+  EXPECT_TRUE(desc.contains(1));
+}
+
+// Построение множества из диапазона
+TEST(SetBulkTest, RangeConstructor) {
+  int sorted[] = {1, 2, 2, 3, 5, 8, 13};
+  s21::set<int> fib(std::begin(sorted), std::end(sorted));
+  EXPECT_EQ(fib.size(), 6);
+  EXPECT_TRUE(fib.contains(13));
+
+  int shuffled[] = {5, 1, 4, 1, 3};
+  s21::set<int> other(std::begin(shuffled), std::end(shuffled));
+  EXPECT_EQ(other.size(), 4);
+  EXPECT_EQ(*other.begin(), 1);
+}
+
+// Множество с порядковой статистикой
+TEST(SetOrderStatisticTest, NthRankAndDistance) {
+  s21::set<int, std::greater<int>, std::allocator<int>,
+           s21::OrderStatisticTreePolicy>
+      desc({4, 8, 15, 16, 23, 42});
+  EXPECT_EQ(*desc.nth(0), 42);
+  EXPECT_EQ(*desc.nth(5), 4);
+  EXPECT_EQ(desc.nth(6), desc.end());
+  EXPECT_EQ(desc.rank(16), 2);
+  EXPECT_EQ(desc.find(8) - desc.begin(), 4);
+  desc.erase(desc.find(23));
+  EXPECT_EQ(*desc.nth(1), 16);
+  EXPECT_EQ(desc.end() - desc.begin(), 5);
+}
+
+// Границы множества, в том числе с обратным порядком
+TEST(SetBoundsTest, LowerUpperEqualRange) {
+  s21::set<int> values({10, 20, 30, 40});
+  EXPECT_EQ(*values.lower_bound(20), 20);
+  EXPECT_EQ(*values.lower_bound(21), 30);
+  EXPECT_EQ(*values.upper_bound(20), 30);
+  EXPECT_EQ(values.upper_bound(40), values.end());
+  auto range = values.equal_range(30);
+  EXPECT_EQ(*range.first, 30);
+  EXPECT_EQ(*range.second, 40);
+  EXPECT_EQ(values.equal_range(35).first, values.equal_range(35).second);
+
+  const auto &view = values;
+  EXPECT_EQ(*view.lower_bound(5), 10);
+  EXPECT_EQ(view.upper_bound(45), view.cend());
+
+  s21::set<int, std::greater<int>> desc({1, 5, 3});
+  EXPECT_EQ(*desc.lower_bound(4), 3);
+  EXPECT_EQ(*desc.upper_bound(5), 3);
+
+  s21::set<std::string, std::less<>> words({"kiwi", "lime"});
+  EXPECT_EQ(*words.lower_bound(std::string_view("l")), "lime");
+  EXPECT_EQ(words.upper_bound(std::string_view("lime")), words.end());
+}
+
+// Разделение множества с обратным порядком и соединение частей
+TEST(SetSplitJoinTest, SplitAndJoinBack) {
+  s21::set<int, std::greater<int>> desc({1, 3, 5, 7, 9});
+  auto low = desc.split(5);
+  EXPECT_EQ(desc.size(), 2);
+  EXPECT_EQ(*desc.begin(), 9);
+  EXPECT_EQ(low.size(), 3);
+  EXPECT_EQ(*low.begin(), 5);
+  EXPECT_THROW(desc.join(4, low), std::invalid_argument);
+  auto tail = low.split(4);
+  desc.join(low);
+  desc.join(4, tail);
+  EXPECT_EQ(desc.size(), 6);
+  EXPECT_TRUE(tail.empty());
+  int expected[] = {9, 7, 5, 4, 3, 1};
+  int i = 0;
+  for (int value : desc) EXPECT_EQ(value, expected[i++]);
+}
+
+// Объединение, пересечение и разность множеств
+TEST(SetAlgebraTest, UnionIntersectionDifference) {
+  s21::set<int> primes({2, 3, 5, 7, 11, 13});
+  s21::set<int> odds({1, 3, 5, 7, 9, 11, 13});
+  s21::set<int> all(primes);
+  all.set_union(odds);
+  EXPECT_EQ(all.size(), 8);
+  EXPECT_EQ(*all.begin(), 1);
+
+  s21::set<int> common(primes);
+  common.set_intersection(odds);
+  EXPECT_EQ(common.size(), 5);
+  EXPECT_FALSE(common.contains(2));
+
+  primes.set_difference(std::move(odds));
+  EXPECT_EQ(primes.size(), 1);
+  EXPECT_EQ(*primes.begin(), 2);
+
+  s21::set<int> empty;
+  empty.set_intersection(all);
+  EXPECT_TRUE(empty.empty());
+  all.set_difference(empty);
+  EXPECT_EQ(all.size(), 8);
+}
+
+// Извлечение узла и merge без копирования ключей
+TEST(SetNodeHandleTest, ExtractInsertAndMerge) {
+  s21::set<int> first = {1, 2, 3, 4};
+  s21::set<int> second = {3, 4, 5};
+  const int *address = &*first.find(1);
+
+  s21::set<int>::node_type node = first.extract(first.begin());
+  EXPECT_EQ(node.value(), 1);
+  auto result = second.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(&*result.position, address);
+  EXPECT_TRUE(first.extract(first.end()).empty());
+
+  auto refused = second.insert(first.extract(3));
+  EXPECT_FALSE(refused.inserted);
+  EXPECT_EQ(refused.node.value(), 3);
+  EXPECT_EQ(*refused.position, 3);
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 5);
+  EXPECT_EQ(second.size(), 1);
+  EXPECT_EQ(&*first.find(1), address);
+}
+
+// Вставка по подсказке в начало, конец и середину множества
+TEST(SetHintTest, InsertAndEmplaceHint) {
+  s21::set<int> values;
+  for (int i = 10; i < 20; ++i) values.insert(values.end(), i);
+  for (int i = 9; i >= 0; --i) {
+    EXPECT_EQ(*values.emplace_hint(values.begin(), i), i);
+  }
+  EXPECT_EQ(values.size(), 20);
+  EXPECT_EQ(*values.insert(values.find(5), 5), 5);
+  EXPECT_EQ(*values.insert(values.find(3), 25), 25);
+  EXPECT_EQ(values.size(), 21);
+  int expected = 0;
+  for (int value : values) {
+    EXPECT_EQ(value, expected);
+    expected = expected == 19 ? 25 : expected + 1;
+  }
+}
+
+// Перемещающая вставка и emplace
+TEST(SetEmplaceTest, MoveAndEmplace) {
+  s21::set<std::string> words;
+  std::string word(64, 'w');
+  EXPECT_TRUE(words.insert(std::move(word)).second);
+  EXPECT_TRUE(word.empty());
+
+  std::string same(64, 'w');
+  EXPECT_FALSE(words.insert(std::move(same)).second);
+  EXPECT_EQ(same, std::string(64, 'w'));
+
+  EXPECT_TRUE(words.emplace(3, 'a').second);
+  EXPECT_FALSE(words.emplace("aaa").second);
+  EXPECT_EQ(*words.insert(words.cend(), std::string(70, 'z')),
+            std::string(70, 'z'));
+  EXPECT_EQ(words.size(), 3);
+  EXPECT_EQ(*words.begin(), "aaa");
+}
+
+// Обратные итераторы и стандартные алгоритмы
+TEST(SetReverseIteratorTest, ReverseTraversal) {
+  using Set = s21::set<int>;
+  EXPECT_TRUE((std::is_same_v<
+               std::iterator_traits<Set::iterator>::iterator_category,
+               std::bidirectional_iterator_tag>));
+  EXPECT_TRUE((
+      std::is_same_v<std::iterator_traits<Set::const_iterator>::reference,
+                     const int &>));
+  Set numbers{5, 1, 4, 2, 3};
+  std::vector<int> reversed(numbers.rbegin(), numbers.rend());
+  EXPECT_EQ(reversed, (std::vector<int>{5, 4, 3, 2, 1}));
+  EXPECT_EQ(*std::prev(numbers.end()), 5);
+  const Set &view = numbers;
+  EXPECT_EQ(*std::prev(view.end(), 2), 4);
+  EXPECT_TRUE(std::equal(view.crbegin(), view.crend(), reversed.begin()));
+  EXPECT_EQ(std::find(view.rbegin(), view.rend(), 2).base(),
+            std::next(view.begin(), 2));
+  auto it = numbers.end();
+  EXPECT_TRUE(it-- == numbers.end());
+  EXPECT_EQ(*it, 5);
+}
+
+// Пакетный поиск по множеству строк с прозрачным компаратором
+TEST(SetFindManyTest, TransparentKeys) {
+  s21::set<std::string, std::less<>> words{"apple", "kiwi", "pear", "plum"};
+  std::vector<const char*> probes{"plum", "fig", "apple", "zucchini", "kiwi"};
+  std::vector<s21::set<std::string, std::less<>>::iterator> found;
+  words.find_many(probes.begin(), probes.end(), std::back_inserter(found));
+  ASSERT_EQ(found.size(), probes.size());
+  EXPECT_EQ(*found[0], "plum");
+  EXPECT_TRUE(found[1] == words.end());
+  EXPECT_EQ(*found[2], "apple");
+  EXPECT_TRUE(found[3] == words.end());
+  EXPECT_EQ(*found[4], "kiwi");
+
+  bool present[5] = {};
+  words.contains_many(probes.begin(), probes.end(), present);
+  EXPECT_TRUE(present[0] && !present[1] && present[2] && !present[3] &&
+              present[4]);
+}
+
+// Снимок множества с обратным компаратором и пустой снимок
+TEST(FrozenSetTest, LookupAndIteration) {
+  s21::set<int, std::greater<int>> numbers{5, 1, 9, 3, 7, 11};
+  s21::frozen_set<int, std::greater<int>> frozen = numbers.freeze();
+  EXPECT_EQ(std::vector<int>(frozen.begin(), frozen.end()),
+            std::vector<int>(numbers.begin(), numbers.end()));
+  EXPECT_TRUE(frozen.contains(7));
+  EXPECT_FALSE(frozen.contains(8));
+  EXPECT_EQ(*frozen.lower_bound(8), 7);
+  EXPECT_TRUE(frozen.lower_bound(0) == frozen.end());
+  EXPECT_EQ(*frozen.find(11), 11);
+  auto last = frozen.end();
+  EXPECT_EQ(*--last, 1);
+
+  s21::frozen_set<int> empty = s21::set<int>().freeze();
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(0));
+  EXPECT_TRUE(empty.lower_bound(0) == empty.end());
+}
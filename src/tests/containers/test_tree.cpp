@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
 
+#include "../../containers/tree/tree_parallel.h"
 #include "../../s21_containers.h"
 
 class RBTreeTest : public ::testing::Test {
@@ -15,7 +22,12 @@ class RBTreeTest : public ::testing::Test {
     using s21::RBTree<int, char>::rightRotate;
     using s21::RBTree<int, char>::GetRoot;
     using s21::RBTree<int, char>::GetMin;
+    using s21::RBTree<int, char>::GetHeader;
     using s21::RBTree<int, char>::RecursiveDelete;
+    using s21::RBTree<int, char>::insertUniqueHint;
+    using s21::RBTree<int, char>::createNode;
+    using s21::RBTree<int, char>::copySubtree;
+    using s21::RBTree<int, char>::deleteSubtree;
   };
 
   TestTree my_tree;
@@ -36,10 +48,10 @@ TEST_F(RBTreeTest, LeftRotate) {
 
   auto* root = my_tree.GetRoot();
   ASSERT_NE(root, nullptr);
-  EXPECT_EQ(root->key, 2);
+  EXPECT_EQ(root->key(), 2);
   EXPECT_EQ(root->color, s21::BLACK);
-  EXPECT_EQ(root->left->key, 1);
-  EXPECT_EQ(root->right->key, 3);
+  EXPECT_EQ(root->left->key(), 1);
+  EXPECT_EQ(root->right->key(), 3);
 }
 
 // Тест для метода rightRotate
@@ -50,10 +62,10 @@ TEST_F(RBTreeTest, RightRotate) {
 
   auto* root = my_tree.GetRoot();
   ASSERT_NE(root, nullptr);
-  EXPECT_EQ(root->key, 2);
+  EXPECT_EQ(root->key(), 2);
   EXPECT_EQ(root->color, s21::BLACK);
-  EXPECT_EQ(root->left->key, 1);
-  EXPECT_EQ(root->right->key, 3);
+  EXPECT_EQ(root->left->key(), 1);
+  EXPECT_EQ(root->right->key(), 3);
 }
 
 // Тест для метода insert
@@ -80,7 +92,7 @@ TEST_F(RBTreeTest, FindNode) {
 TEST_F(RBTreeTest, GetMin) {
   my_tree.insert(2, 'b');
   my_tree.insert(1, 'a');
-  EXPECT_EQ(my_tree.GetMin(my_tree.GetRoot())->key, 1);
+  EXPECT_EQ(my_tree.GetMin(my_tree.GetRoot())->key(), 1);
 }
 
 // Тест для метода RecursiveDelete
@@ -101,9 +113,9 @@ TEST_F(RBTreeTest, InsertComplexCase) {
 
   auto* root = my_tree.GetRoot();
   ASSERT_NE(root, nullptr);
-  EXPECT_EQ(root->key, 20);
-  EXPECT_EQ(root->left->right->key, 15);
-  EXPECT_EQ(root->right->left->key, 25);
+  EXPECT_EQ(root->key(), 20);
+  EXPECT_EQ(root->left->right->key(), 15);
+  EXPECT_EQ(root->right->left->key(), 25);
 }
 
 // Тест для удаления узла с двумя потомками
@@ -125,7 +137,7 @@ TEST_F(RBTreeTest, RecursiveDeleteLeftSubtree) {
   my_tree.insert(3, 'b');
   my_tree.insert(7, 'c');
 
-  my_tree.RecursiveDelete(my_tree.GetRoot(), 3);
+  my_tree.remove(3);
   EXPECT_FALSE(my_tree.contains(3));
   EXPECT_EQ(my_tree.size(), 2);
 }
@@ -188,14 +200,14 @@ TEST_F(RBTreeTest, RightRotateWithParent) {
   my_tree.rightRotate(node);
 
   // Проверяем новую структуру дерева
-  EXPECT_EQ(my_tree.GetRoot()->key, 30);
-  EXPECT_EQ(my_tree.GetRoot()->left->key, 10);
-  EXPECT_EQ(my_tree.GetRoot()->left->right->key, 20);
-  EXPECT_EQ(my_tree.GetRoot()->right->key, 40);
+  EXPECT_EQ(my_tree.GetRoot()->key(), 30);
+  EXPECT_EQ(my_tree.GetRoot()->left->key(), 10);
+  EXPECT_EQ(my_tree.GetRoot()->left->right->key(), 20);
+  EXPECT_EQ(my_tree.GetRoot()->right->key(), 40);
 
   // Проверяем родительские связи
-  EXPECT_EQ(node->parent->key, 10);
-  EXPECT_EQ(my_tree.GetRoot()->left->parent->key, 30);
+  EXPECT_EQ(node->parent->key(), 10);
+  EXPECT_EQ(my_tree.GetRoot()->left->parent->key(), 30);
 }
 
 // Тест для случая красного дяди в левой ветви
@@ -245,7 +257,7 @@ TEST_F(RBTreeTest, InitializerListConstructor) {
 
   auto* root = test_tree.GetRoot();
   ASSERT_NE(root, nullptr);
-  EXPECT_EQ(root->key, 20);
+  EXPECT_EQ(root->key(), 20);
   EXPECT_EQ(root->color, s21::BLACK);
 }
 
@@ -418,3 +430,959 @@ TEST_F(RBTreeTest, RedBlackProperties) {
   EXPECT_TRUE(checkRedBlackProperties(my_tree.GetRoot()));
   EXPECT_EQ(my_tree.GetRoot()->color, s21::BLACK);
 }
+
+// Проверка инвариантов красно-черного дерева: возвращает черную высоту
+// поддерева или -1, если свойства нарушены. Для корня, подвешенного к
+// заголовку, проверяется и его черный цвет
+static int CheckRedBlackInvariants(s21::RBTree<int, char>::RBTreeNode* node,
+                                   s21::RBTree<int, char>::RBTreeNode* parent) {
+  if (!node) return 1;
+  if (node->parent != parent) return -1;
+  if (parent->parent == node && node->color != s21::BLACK) return -1;
+  if (node->color == s21::RED &&
+      ((node->left && node->left->color == s21::RED) ||
+       (node->right && node->right->color == s21::RED))) {
+    return -1;
+  }
+  if (node->left && !(node->left->key() < node->key())) return -1;
+  if (node->right && !(node->key() < node->right->key())) return -1;
+  int left = CheckRedBlackInvariants(node->left, node);
+  int right = CheckRedBlackInvariants(node->right, node);
+  if (left < 0 || left != right) return -1;
+  return left + (node->color == s21::BLACK ? 1 : 0);
+}
+
+// Тест для сохранения свойств дерева при удалении всех типов узлов
+TEST_F(RBTreeTest, RemoveKeepsRedBlackProperties) {
+  for (int i = 1; i <= 200; ++i) my_tree.insert(i, 'a');
+  for (int i = 2; i <= 200; i += 2) {
+    my_tree.remove(i);
+    ASSERT_GT(
+        CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+  }
+  EXPECT_EQ(my_tree.size(), 100);
+  for (int i = 1; i <= 200; ++i) EXPECT_EQ(my_tree.contains(i), i % 2 == 1);
+  for (int i = 1; i <= 200; i += 2) my_tree.remove(i);
+  EXPECT_TRUE(my_tree.empty());
+  EXPECT_EQ(my_tree.GetRoot(), nullptr);
+}
+
+// Тест для высоты дерева при случайном чередовании вставок и удалений
+TEST_F(RBTreeTest, RandomChurnKeepsHeightLogarithmic) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> dist(0, 999);
+  std::set<int> reference;
+  for (int i = 0; i < 20000; ++i) {
+    int key = dist(gen);
+    if (gen() % 2) {
+      my_tree.insert(key, 'a');
+      reference.insert(key);
+    } else {
+      my_tree.remove(key);
+      reference.erase(key);
+    }
+  }
+  ASSERT_GT(
+      CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+  EXPECT_EQ(my_tree.size(), reference.size());
+
+  std::function<int(s21::RBTree<int, char>::RBTreeNode*)> getHeight =
+      [&getHeight](s21::RBTree<int, char>::RBTreeNode* node) -> int {
+    if (!node) return 0;
+    return 1 + std::max(getHeight(node->left), getHeight(node->right));
+  };
+  EXPECT_LE(getHeight(my_tree.GetRoot()), 2 * std::log2(my_tree.size() + 1));
+
+  auto it = my_tree.cbegin();
+  for (int key : reference) {
+    ASSERT_NE(it, my_tree.cend());
+    EXPECT_EQ((*it).first, key);
+    ++it;
+  }
+}
+
+// Тест для построения дерева из отсортированного диапазона любого размера
+TEST_F(RBTreeTest, AssignSortedBuildsValidTree) {
+  std::vector<std::pair<int, char>> items;
+  for (int n = 0; n <= 130; ++n) {
+    my_tree.assign_sorted(items.begin(), items.end());
+    ASSERT_EQ(my_tree.size(), items.size());
+    ASSERT_GT(
+        CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+    if (n > 0) {
+      EXPECT_EQ(my_tree.GetRoot()->color, s21::BLACK);
+    }
+    for (const auto& item : items) ASSERT_TRUE(my_tree.contains(item.first));
+    items.push_back({n * 2, 'a'});
+  }
+  my_tree.insert(7, 'b');
+  my_tree.remove(64);
+  EXPECT_GT(
+      CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+}
+
+// Тест для построения из неотсортированного диапазона с повторами ключей
+TEST_F(RBTreeTest, AssignSortedFallsBackToSort) {
+  std::mt19937 gen(7);
+  std::vector<std::pair<int, char>> items;
+  std::set<int> reference;
+  for (int i = 0; i < 1000; ++i) {
+    int key = static_cast<int>(gen() % 300);
+    items.push_back({key, reference.count(key) ? 'd' : 'f'});
+    reference.insert(key);
+  }
+  TestTree tree(items.begin(), items.end());
+  ASSERT_GT(CheckRedBlackInvariants(tree.GetRoot(), tree.GetHeader()), 0);
+  EXPECT_EQ(tree.size(), reference.size());
+  auto it = tree.cbegin();
+  for (int key : reference) {
+    ASSERT_NE(it, tree.cend());
+    EXPECT_EQ((*it).first, key);
+    EXPECT_EQ((*it).second, 'f');  // Из повторов остается первый
+    ++it;
+  }
+}
+
+// Тест для заголовка: минимум, максимум и --end() при вставках и удалениях
+TEST_F(RBTreeTest, HeaderTracksMinAndMax) {
+  EXPECT_EQ(my_tree.begin(), my_tree.end());
+  std::mt19937 gen(8);
+  std::set<int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(gen() % 500);
+    if (gen() % 3) {
+      my_tree.insert(key, 'a');
+      reference.insert(key);
+    } else {
+      my_tree.remove(key);
+      reference.erase(key);
+    }
+    if (reference.empty()) {
+      ASSERT_EQ(my_tree.begin(), my_tree.end());
+      continue;
+    }
+    ASSERT_EQ((*my_tree.begin()).first, *reference.begin());
+    ASSERT_EQ((*--my_tree.end()).first, *reference.rbegin());
+    ASSERT_EQ(my_tree.GetRoot()->parent, my_tree.GetHeader());
+  }
+
+  auto it = my_tree.end();
+  for (auto key = reference.rbegin(); key != reference.rend(); ++key) {
+    --it;
+    ASSERT_EQ((*it).first, *key);
+  }
+  EXPECT_EQ(it, my_tree.begin());
+  EXPECT_EQ(++(--my_tree.end()), my_tree.end());
+}
+
+// Тест для заголовка после копирования, перемещения и обмена
+TEST_F(RBTreeTest, HeaderSurvivesCopyMoveSwap) {
+  for (int i = 1; i <= 50; ++i) my_tree.insert(i, 'a');
+  TestTree copy(my_tree);
+  TestTree moved(std::move(copy));
+  EXPECT_EQ(copy.begin(), copy.end());
+  EXPECT_EQ((*moved.begin()).first, 1);
+  EXPECT_EQ((*--moved.end()).first, 50);
+  ASSERT_GT(CheckRedBlackInvariants(moved.GetRoot(), moved.GetHeader()), 0);
+
+  TestTree other;
+  other.insert(100, 'b');
+  other.swap(moved);
+  EXPECT_EQ((*--other.end()).first, 50);
+  EXPECT_EQ((*moved.begin()).first, 100);
+  EXPECT_EQ(++moved.begin(), moved.end());
+  ASSERT_GT(CheckRedBlackInvariants(other.GetRoot(), other.GetHeader()), 0);
+
+  moved = std::move(other);
+  EXPECT_EQ(other.begin(), other.end());
+  EXPECT_EQ((*--moved.end()).first, 50);
+  ASSERT_EQ(moved.GetRoot()->parent, moved.GetHeader());
+}
+
+// Дерево с порядковой статистикой: nth, rank и разность итераторов
+TEST(OrderStatisticTreeTest, SelectAndRankMatchReference) {
+  using Tree = s21::RBTree<int, char, std::less<int>,
+                           std::allocator<std::pair<const int, char>>,
+                           s21::OrderStatisticTreePolicy>;
+  Tree tree;
+  std::mt19937 gen(9);
+  std::set<int> reference;
+  for (int i = 0; i < 4000; ++i) {
+    int key = static_cast<int>(gen() % 600);
+    if (gen() % 3) {
+      tree.insert(key, 'a');
+      reference.insert(key);
+    } else {
+      tree.remove(key);
+      reference.erase(key);
+    }
+  }
+  Tree copy(tree);
+  size_t k = 0;
+  for (int key : reference) {
+    ASSERT_EQ((*tree.nth(k)).first, key);
+    ASSERT_EQ((*copy.nth(k)).first, key);
+    ASSERT_EQ(tree.rank(key), k);
+    ASSERT_EQ(tree.rank(key + 1), k + 1);
+    ASSERT_EQ(tree.find(key) - tree.begin(), static_cast<std::ptrdiff_t>(k));
+    ++k;
+  }
+  EXPECT_EQ(tree.nth(k), tree.end());
+  EXPECT_EQ(tree.end() - tree.begin(),
+            static_cast<std::ptrdiff_t>(reference.size()));
+  EXPECT_EQ(tree.rank(-1), 0);
+
+  std::vector<std::pair<int, char>> items;
+  for (int i = 0; i < 100; ++i) items.push_back({i * 3, 'b'});
+  tree.assign_sorted(items.begin(), items.end());
+  EXPECT_EQ((*tree.nth(50)).first, 150);
+  EXPECT_EQ(tree.rank(151), 51);
+
+  Tree empty;
+  EXPECT_EQ(empty.nth(0), empty.end());
+  EXPECT_EQ(empty.rank(5), 0);
+  EXPECT_EQ(empty.end() - empty.begin(), 0);
+}
+
+// Тест для границ: спуск по дереву совпадает с std::set
+TEST_F(RBTreeTest, BoundsMatchReference) {
+  std::mt19937 gen(10);
+  std::set<int> reference;
+  for (int i = 0; i < 500; ++i) {
+    int key = static_cast<int>(gen() % 1000) * 2;
+    my_tree.insert(key, 'a');
+    reference.insert(key);
+  }
+  const TestTree& view = my_tree;
+  for (int key = -1; key <= 2001; ++key) {
+    auto lower = reference.lower_bound(key);
+    auto upper = reference.upper_bound(key);
+    auto range = my_tree.equal_range(key);
+    if (lower == reference.end()) {
+      ASSERT_EQ(my_tree.lower_bound(key), my_tree.end());
+    } else {
+      ASSERT_EQ((*my_tree.lower_bound(key)).first, *lower);
+      ASSERT_EQ((*view.lower_bound(key)).first, *lower);
+    }
+    if (upper == reference.end()) {
+      ASSERT_EQ(my_tree.upper_bound(key), my_tree.end());
+      ASSERT_EQ(range.second, my_tree.end());
+    } else {
+      ASSERT_EQ((*my_tree.upper_bound(key)).first, *upper);
+      ASSERT_EQ((*view.upper_bound(key)).first, *upper);
+      ASSERT_EQ((*range.second).first, *upper);
+    }
+    ASSERT_EQ(range.first, my_tree.lower_bound(key));
+    ASSERT_EQ(range.first == range.second, reference.count(key) == 0);
+  }
+
+  TestTree empty;
+  EXPECT_EQ(empty.lower_bound(1), empty.end());
+  EXPECT_EQ(empty.upper_bound(1), empty.end());
+  EXPECT_EQ(empty.equal_range(1).first, empty.end());
+}
+
+// Тест для split и join: части совпадают с std::set, свойства сохраняются
+TEST_F(RBTreeTest, SplitJoinMatchReference) {
+  using Base = s21::RBTree<int, char>;
+  std::mt19937 gen(11);
+  for (int round = 0; round < 60; ++round) {
+    TestTree tree;
+    std::set<int> reference;
+    int count = static_cast<int>(gen() % 300);
+    for (int i = 0; i < count; ++i) {
+      int key = static_cast<int>(gen() % 1000);
+      tree.insert(key, 'a');
+      reference.insert(key);
+    }
+    // Ключи корня и его левого края разрезают дерево так, что меньшая
+    // часть - поддерево без изменений, корень которого может быть красным
+    int key = static_cast<int>(gen() % 1100) - 50;
+    if (round % 3 == 0 && tree.GetRoot() != nullptr) {
+      auto* node = tree.GetRoot();
+      for (int depth = round / 3 % 4; depth > 0 && node->left; --depth) {
+        node = node->left;
+      }
+      key = node->key();
+    }
+    TestTree right;
+    static_cast<Base&>(right) = tree.split(key);
+
+    std::vector<int> less(reference.begin(), reference.lower_bound(key));
+    std::vector<int> notLess(reference.lower_bound(key), reference.end());
+    ASSERT_GT(CheckRedBlackInvariants(tree.GetRoot(), tree.GetHeader()), 0);
+    ASSERT_GT(CheckRedBlackInvariants(right.GetRoot(), right.GetHeader()), 0);
+    ASSERT_EQ(tree.size(), less.size());
+    ASSERT_EQ(right.size(), notLess.size());
+    std::vector<int> keys;
+    for (auto item : tree) keys.push_back(item.first);
+    ASSERT_EQ(keys, less);
+    keys.clear();
+    for (auto item : right) keys.push_back(item.first);
+    ASSERT_EQ(keys, notLess);
+    if (!less.empty()) {
+      ASSERT_EQ((*--tree.end()).first, less.back());
+    }
+
+    if (round % 2 == 0 || right.size() == 0) {
+      tree.join(right);
+    } else {
+      right.remove(notLess.front());
+      tree.join({notLess.front(), 'b'}, right);
+    }
+    EXPECT_EQ(right.size(), 0);
+    EXPECT_EQ(right.begin(), right.end());
+    ASSERT_GT(CheckRedBlackInvariants(tree.GetRoot(), tree.GetHeader()), 0);
+    ASSERT_EQ(tree.size(), reference.size());
+    keys.clear();
+    for (auto item : tree) keys.push_back(item.first);
+    ASSERT_EQ(keys, std::vector<int>(reference.begin(), reference.end()));
+  }
+
+  TestTree low;
+  TestTree high;
+  low.insert(5, 'a');
+  high.insert(5, 'b');
+  EXPECT_THROW(low.join(high), std::invalid_argument);
+  EXPECT_THROW(low.join({7, 'c'}, high), std::invalid_argument);
+  EXPECT_EQ(low.size(), 1);
+  EXPECT_EQ(high.size(), 1);
+}
+
+// split и join поддерживают веса порядковой статистики и работают с пулом
+TEST(OrderStatisticTreeTest, SplitJoinKeepWeights) {
+  using Tree = s21::RBTree<int, char, std::less<int>,
+                           std::allocator<std::pair<const int, char>>,
+                           s21::OrderStatisticTreePolicy>;
+  using Pooled = s21::RBTree<int, char, std::less<int>,
+                             std::allocator<std::pair<const int, char>>,
+                             s21::PooledTreePolicy>;
+  Tree tree;
+  Pooled pooled;
+  for (int i = 0; i < 1000; ++i) {
+    tree.insert(i * 2, 'a');
+    pooled.insert(i * 2, 'a');
+  }
+  Tree right = tree.split(701);
+  Pooled pooledRight = pooled.split(701);
+  EXPECT_EQ(tree.size(), 351);
+  EXPECT_EQ(right.size(), 649);
+  EXPECT_EQ(pooled.size(), 351);
+  EXPECT_EQ(pooledRight.size(), 649);
+  EXPECT_EQ((*pooledRight.begin()).first, 702);
+  EXPECT_EQ((*tree.nth(350)).first, 700);
+  EXPECT_EQ((*right.nth(0)).first, 702);
+  EXPECT_EQ(right.rank(1000), 149);
+  EXPECT_EQ(right.end() - right.begin(), 649);
+
+  Tree middle = tree.split(300);
+  middle.join(right);
+  tree.join(middle);
+  pooled.join(pooledRight);
+  EXPECT_EQ(tree.size(), 1000);
+  EXPECT_EQ(pooled.size(), 1000);
+  for (size_t k = 0; k < 1000; k += 37) {
+    ASSERT_EQ((*tree.nth(k)).first, static_cast<int>(k * 2));
+    ASSERT_EQ(tree.rank(static_cast<int>(k * 2)), k);
+  }
+  EXPECT_EQ((*--pooled.end()).first, 1998);
+}
+
+// Тест для объединения, пересечения и разности: результат совпадает с
+// алгоритмами std, свойства дерева сохраняются
+TEST_F(RBTreeTest, SetAlgebraMatchesReference) {
+  std::mt19937 gen(12);
+  for (int round = 0; round < 90; ++round) {
+    std::set<int> mine;
+    std::set<int> theirs;
+    int mineCount = static_cast<int>(gen() % 400);
+    int theirCount = static_cast<int>(gen() % (round % 3 == 0 ? 10 : 400));
+    for (int i = 0; i < mineCount; ++i) mine.insert(gen() % 600);
+    for (int i = 0; i < theirCount; ++i) theirs.insert(gen() % 600);
+    TestTree tree;
+    TestTree other;
+    for (int key : mine) tree.insert(key, 'a');
+    for (int key : theirs) other.insert(key, 'b');
+
+    std::vector<int> expected;
+    if (round % 3 == 0) {
+      std::set_union(mine.begin(), mine.end(), theirs.begin(), theirs.end(),
+                     std::back_inserter(expected));
+      tree.set_union(other);
+    } else if (round % 3 == 1) {
+      std::set_intersection(mine.begin(), mine.end(), theirs.begin(),
+                            theirs.end(), std::back_inserter(expected));
+      tree.set_intersection(other);
+    } else {
+      std::set_difference(mine.begin(), mine.end(), theirs.begin(),
+                          theirs.end(), std::back_inserter(expected));
+      tree.set_difference(std::move(other));
+    }
+    ASSERT_GT(CheckRedBlackInvariants(tree.GetRoot(), tree.GetHeader()), 0);
+    ASSERT_EQ(tree.size(), expected.size());
+    std::vector<int> keys;
+    for (auto item : tree) {
+      keys.push_back(item.first);
+      ASSERT_EQ(item.second, mine.count(item.first) ? 'a' : 'b');
+    }
+    ASSERT_EQ(keys, expected);
+  }
+}
+
+// Операции над множествами обновляют веса и работают с пулом узлов
+TEST(OrderStatisticTreeTest, SetAlgebraKeepsWeights) {
+  using Tree = s21::RBTree<int, int, std::less<int>,
+                           std::allocator<std::pair<const int, int>>,
+                           s21::OrderStatisticTreePolicy>;
+  using Pooled = s21::RBTree<int, int, std::less<int>,
+                             std::allocator<std::pair<const int, int>>,
+                             s21::PooledTreePolicy>;
+  Tree evens;
+  Tree triples;
+  Pooled pooled;
+  Pooled pooledDelta;
+  for (int i = 0; i < 600; i += 2) {
+    evens.insert(i, 1);
+    pooled.insert(i, 1);
+  }
+  for (int i = 0; i < 600; i += 3) {
+    triples.insert(i, 10);
+    pooledDelta.insert(i, 10);
+  }
+  Tree both(evens);
+  both.set_intersection(triples, std::plus<int>());
+  EXPECT_EQ(both.size(), 100);
+  EXPECT_EQ((*both.nth(10)).first, 60);
+  EXPECT_EQ((*both.nth(10)).second, 11);
+  EXPECT_EQ(both.rank(61), 11);
+
+  evens.set_union(triples, std::plus<int>());
+  EXPECT_EQ(evens.size(), 400);
+  EXPECT_EQ(evens.end() - evens.begin(), 400);
+  EXPECT_EQ((*evens.nth(3)).first, 4);
+  EXPECT_EQ((*evens.nth(4)).second, 11);
+  evens.set_difference(std::move(both));
+  EXPECT_EQ(evens.size(), 300);
+  EXPECT_EQ(evens.rank(6), 3);
+
+  pooled.set_union(pooledDelta);
+  EXPECT_EQ(pooled.size(), 400);
+  EXPECT_EQ(pooledDelta.size(), 200);
+  pooled.set_difference(pooledDelta);
+  EXPECT_EQ(pooled.size(), 200);
+  EXPECT_FALSE(pooled.contains(6));
+}
+
+// Пул потоков: вложенные invoke и проброс исключений
+TEST(TaskPoolTest, NestedInvokeAndExceptions) {
+  s21::TaskPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+  std::function<long(int, int)> sum = [&](int from, int to) -> long {
+    if (to - from < 64) {
+      long total = 0;
+      for (int i = from; i < to; ++i) total += i;
+      return total;
+    }
+    int middle = from + (to - from) / 2;
+    long left = 0;
+    long right = 0;
+    pool.invoke([&] { left = sum(from, middle); },
+                [&] { right = sum(middle, to); });
+    return left + right;
+  };
+  EXPECT_EQ(sum(0, 100000), 4999950000L);
+
+  bool finished = false;
+  EXPECT_THROW(pool.invoke([] { throw std::runtime_error("first"); },
+                           [&] { finished = true; }),
+               std::runtime_error);
+  EXPECT_TRUE(finished);
+  EXPECT_THROW(pool.invoke([] {}, [] { throw std::logic_error("second"); }),
+               std::logic_error);
+
+  s21::TaskPool single(1);
+  int calls = 0;
+  single.invoke([&] { ++calls; }, [&] { ++calls; });
+  EXPECT_EQ(calls, 2);
+}
+
+// Параллельные операции совпадают с последовательными
+TEST_F(RBTreeTest, ParallelSetAlgebraMatchesSequential) {
+  using Base = s21::RBTree<int, char>;
+  s21::TaskPool pool(4);
+  std::mt19937 gen(13);
+  std::vector<std::pair<int, char>> items;
+  for (int i = 0; i < 60000; ++i) {
+    items.push_back({static_cast<int>(gen() % 200000), 'a'});
+  }
+  std::vector<std::pair<int, char>> delta;
+  for (int i = 0; i < 50000; ++i) {
+    delta.push_back({static_cast<int>(gen() % 200000), 'b'});
+  }
+  TestTree tree;
+  tree.parallel_insert(items.begin(), items.end(), pool);
+  Base reference(items.begin(), items.end());
+  Base other(delta.begin(), delta.end());
+  ASSERT_EQ(tree.size(), reference.size());
+  ASSERT_GT(CheckRedBlackInvariants(tree.GetRoot(), tree.GetHeader()), 0);
+
+  TestTree both;
+  static_cast<Base&>(both) = Base(tree);
+  both.parallel_union(other, pool);
+  reference.set_union(other);
+  ASSERT_GT(CheckRedBlackInvariants(both.GetRoot(), both.GetHeader()), 0);
+  ASSERT_EQ(both.size(), reference.size());
+  auto expected = reference.begin();
+  for (auto item : both) {
+    ASSERT_EQ(item.first, (*expected).first);
+    ASSERT_EQ(item.second, (*expected).second);
+    ++expected;
+  }
+
+  TestTree common;
+  static_cast<Base&>(common) = Base(both);
+  common.parallel_intersection(other, pool);
+  reference.set_intersection(other);
+  ASSERT_GT(CheckRedBlackInvariants(common.GetRoot(), common.GetHeader()), 0);
+  ASSERT_EQ(common.size(), reference.size());
+  ASSERT_EQ(common.size(), other.size());
+
+  size_t onlyMine = 0;
+  for (auto item : tree) onlyMine += other.contains(item.first) ? 0 : 1;
+  both.parallel_difference(other, pool);
+  ASSERT_GT(CheckRedBlackInvariants(both.GetRoot(), both.GetHeader()), 0);
+  ASSERT_EQ(both.size(), onlyMine);
+  for (auto item : both) ASSERT_FALSE(other.contains(item.first));
+}
+
+// Извлеченный узел переходит в другое дерево без копирования элемента
+TEST_F(RBTreeTest, ExtractAndInsertNodeHandles) {
+  for (int i = 1; i <= 20; ++i) my_tree.insert(i, 'a');
+  const auto* address = &*my_tree.find(7);
+
+  TestTree::NodeHandle handle = my_tree.extract(7);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 7);
+  handle.mapped() = 'z';
+  EXPECT_EQ(my_tree.size(), 19);
+  EXPECT_FALSE(my_tree.contains(7));
+  ASSERT_GT(CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+  EXPECT_TRUE(my_tree.extract(7).empty());
+  EXPECT_TRUE(my_tree.extract(my_tree.end()).empty());
+
+  TestTree other;
+  auto result = other.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(handle.empty());
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, address);
+  EXPECT_EQ((*result.position).second, 'z');
+
+  my_tree.insert(7, 'q');
+  auto refused = my_tree.insert(other.extract(other.begin()));
+  EXPECT_FALSE(refused.inserted);
+  ASSERT_FALSE(refused.node.empty());
+  EXPECT_EQ(refused.node.mapped(), 'z');
+  EXPECT_EQ((*refused.position).second, 'q');
+  EXPECT_TRUE(other.empty());
+}
+
+// merge перевешивает узлы и оставляет совпавшие ключи в источнике
+TEST_F(RBTreeTest, MergeRelinksNodesAndKeepsDuplicates) {
+  TestTree source;
+  std::vector<const std::pair<const int, char>*> odd;
+  for (int i = 1; i <= 200; ++i) {
+    source.insert(i, 's');
+    if (i % 2 == 1) odd.push_back(&*source.find(i));
+  }
+  for (int i = 2; i <= 400; i += 2) my_tree.insert(i, 'm');
+
+  my_tree.merge(source);
+  EXPECT_EQ(my_tree.size(), 300);
+  EXPECT_EQ(source.size(), 100);
+  ASSERT_GT(CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+  ASSERT_GT(CheckRedBlackInvariants(source.GetRoot(), source.GetHeader()), 0);
+  for (int i = 1; i <= 200; i += 2) {
+    EXPECT_EQ(&*my_tree.find(i), odd[i / 2]);
+  }
+  for (auto item : source) EXPECT_EQ(item.first % 2, 0);
+  EXPECT_EQ((*my_tree.find(100)).second, 'm');
+}
+
+// Узлы пула копируются в узлы аллокатора при извлечении
+TEST(OrderStatisticTreeTest, PooledNodeHandlesAndMerge) {
+  using Pooled = s21::RBTree<int, char, std::less<int>,
+                             std::allocator<std::pair<const int, char>>,
+                             s21::PooledTreePolicy>;
+  Pooled first;
+  Pooled second;
+  for (int i = 0; i < 100; ++i) first.insert(i, 'f');
+  for (int i = 50; i < 150; ++i) second.insert(i, 's');
+
+  Pooled::NodeHandle handle = first.extract(first.begin());
+  EXPECT_EQ(handle.key(), 0);
+  EXPECT_EQ(first.size(), 99);
+  EXPECT_TRUE(second.insert(std::move(handle)).inserted);
+  EXPECT_EQ((*second.begin()).first, 0);
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 150);
+  EXPECT_EQ(second.size(), 50);
+  EXPECT_EQ((*first.begin()).second, 'f');
+  EXPECT_EQ((*second.begin()).first, 50);
+}
+
+// Вставка по подсказке сохраняет порядок и свойства дерева при любой подсказке
+TEST_F(RBTreeTest, HintedInsertMatchesReference) {
+  for (int i = 0; i < 500; ++i) {
+    my_tree.insertUniqueHint(my_tree.GetHeader(), i * 2, i * 2, 'a');
+  }
+  for (int i = 499; i >= 0; --i) {
+    auto* first = my_tree.begin().iter_node_;
+    int key = i * 2 - 999;
+    EXPECT_TRUE(my_tree.insertUniqueHint(first, key, key, 'b').second);
+  }
+  ASSERT_GT(CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+
+  std::set<int> reference;
+  for (auto item : my_tree) reference.insert(item.first);
+  std::mt19937 gen(7);
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(gen() % 4000) - 1500;
+    auto hint = my_tree.begin();
+    for (unsigned step = gen() % 40; step > 0; --step) {
+      if (hint != my_tree.end()) ++hint;
+    }
+    auto [node, inserted] =
+        my_tree.insertUniqueHint(hint.iter_node_, key, key, 'c');
+    EXPECT_EQ(node->key(), key);
+    EXPECT_EQ(inserted, reference.insert(key).second);
+  }
+  ASSERT_GT(CheckRedBlackInvariants(my_tree.GetRoot(), my_tree.GetHeader()), 0);
+  ASSERT_EQ(my_tree.size(), reference.size());
+  EXPECT_TRUE(std::equal(reference.begin(), reference.end(), my_tree.begin(),
+                         [](int key, auto item) { return key == item.first; }));
+}
+
+// Константный итератор дерева не копирует элементы
+TEST_F(RBTreeTest, ConstIteratorReturnsReferences) {
+  for (int i = 0; i < 10; ++i) my_tree.insert(i, static_cast<char>('a' + i));
+  const TestTree &view = my_tree;
+  auto mutable_it = my_tree.begin();
+  for (auto it = view.cbegin(); it != view.cend(); ++it) {
+    EXPECT_EQ(&*it, &*mutable_it);
+    EXPECT_EQ(it->second, mutable_it->second);
+    ++mutable_it;
+  }
+  EXPECT_TRUE((std::is_same_v<decltype(*view.begin()),
+                              const std::pair<const int, char> &>));
+}
+
+using ThreadedTree = s21::RBTree<int, char, std::less<int>,
+                                 std::allocator<std::pair<const int, char>>,
+                                 s21::ThreadedTreePolicy>;
+
+// Прямой и обратный обход по ссылкам прошивки совпадает с эталоном
+static void ExpectThreadsMatch(const ThreadedTree& tree,
+                               const std::set<int>& reference) {
+  ASSERT_EQ(tree.size(), reference.size());
+  std::vector<int> forward;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it) {
+    forward.push_back((*it).first);
+  }
+  ASSERT_EQ(forward, std::vector<int>(reference.begin(), reference.end()));
+  std::vector<int> backward;
+  for (auto it = tree.cend(); it != tree.cbegin();) {
+    --it;
+    backward.push_back((*it).first);
+  }
+  ASSERT_EQ(backward, std::vector<int>(reference.rbegin(), reference.rend()));
+}
+
+// Прошивка переживает вставки, удаления, копирование, перемещение и обмен
+TEST(ThreadedTreeTest, ChurnCopyMoveSwap) {
+  std::mt19937 gen(20);
+  ThreadedTree tree;
+  std::set<int> reference;
+  for (int i = 0; i < 4000; ++i) {
+    int key = static_cast<int>(gen() % 1000);
+    if (gen() % 3 == 0) {
+      tree.remove(key);
+      reference.erase(key);
+    } else {
+      tree.insert(key, 'a');
+      reference.insert(key);
+    }
+  }
+  ExpectThreadsMatch(tree, reference);
+
+  ThreadedTree copy(tree);
+  ExpectThreadsMatch(copy, reference);
+  ThreadedTree moved(std::move(copy));
+  ExpectThreadsMatch(moved, reference);
+  ExpectThreadsMatch(copy, {});
+
+  ThreadedTree small{{5, 'b'}, {1, 'b'}, {3, 'b'}};
+  moved.swap(small);
+  ExpectThreadsMatch(moved, {1, 3, 5});
+  ExpectThreadsMatch(small, reference);
+  small = moved;
+  ExpectThreadsMatch(small, {1, 3, 5});
+
+  for (int key : reference) tree.remove(key);
+  ExpectThreadsMatch(tree, {});
+  tree.insert(7, 'c');
+  ExpectThreadsMatch(tree, {7});
+}
+
+// Прошивка после split, join, операций над множествами и переноса узлов
+TEST(ThreadedTreeTest, SplitJoinAndSetAlgebra) {
+  std::mt19937 gen(21);
+  std::vector<std::pair<int, char>> items;
+  std::set<int> reference;
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(gen() % 6000);
+    items.push_back({key, 'a'});
+    reference.insert(key);
+  }
+  ThreadedTree tree(items.begin(), items.end());
+  ExpectThreadsMatch(tree, reference);
+
+  ThreadedTree right = tree.split(3000);
+  ExpectThreadsMatch(tree, {reference.begin(), reference.lower_bound(3000)});
+  ExpectThreadsMatch(right, {reference.lower_bound(3000), reference.end()});
+  tree.join(right);
+  ExpectThreadsMatch(tree, reference);
+  int middle = *reference.lower_bound(4000);
+  ThreadedTree upper = tree.split(middle);
+  upper.remove(middle);
+  tree.join(std::make_pair(middle, 'p'), upper);
+  ExpectThreadsMatch(tree, reference);
+
+  ThreadedTree other;
+  std::set<int> theirs;
+  for (int i = 0; i < 500; ++i) {
+    int key = static_cast<int>(gen() % 6000);
+    other.insert(key, 'b');
+    theirs.insert(key);
+  }
+  std::set<int> expected;
+  std::set_intersection(reference.begin(), reference.end(), theirs.begin(),
+                        theirs.end(), std::inserter(expected, expected.end()));
+  ThreadedTree common(tree);
+  common.set_intersection(other);
+  ExpectThreadsMatch(common, expected);
+
+  expected.clear();
+  std::set_difference(reference.begin(), reference.end(), theirs.begin(),
+                      theirs.end(), std::inserter(expected, expected.end()));
+  ThreadedTree difference(tree);
+  difference.set_difference(other);
+  ExpectThreadsMatch(difference, expected);
+
+  s21::TaskPool pool(4);
+  expected = reference;
+  expected.insert(theirs.begin(), theirs.end());
+  tree.parallel_union(other, pool);
+  ExpectThreadsMatch(tree, expected);
+
+  ThreadedTree::NodeHandle handle = tree.extract(*expected.begin());
+  ASSERT_FALSE(handle.empty());
+  ThreadedTree single;
+  single.insert(std::move(handle));
+  ExpectThreadsMatch(single, {*expected.begin()});
+  expected.erase(expected.begin());
+  ExpectThreadsMatch(tree, expected);
+  tree.merge(single);
+  ExpectThreadsMatch(single, {});
+}
+
+// Копирование и удаление не зависят от глубины дерева: вырожденная цепочка
+// в миллион узлов не переполняет стек
+TEST_F(RBTreeTest, CopyAndDeleteDegenerateChainWithoutRecursion) {
+  using Node = TestTree::RBTreeNode;
+  const int depth = 1000000;
+  Node* top = my_tree.createNode(s21::BLACK, std::make_pair(depth, 'a'));
+  Node* bottom = top;
+  for (int key = depth - 1; key > 0; --key) {
+    Node* node = my_tree.createNode(s21::BLACK, std::make_pair(key, 'a'));
+    node->parent = bottom;
+    bottom->left = node;
+    bottom = node;
+  }
+  Node* copy = my_tree.copySubtree(top);
+  size_t length = 0;
+  int expected = depth;
+  for (Node* node = copy; node != nullptr; node = node->left) {
+    ASSERT_EQ(node->key(), expected--);
+    ASSERT_EQ(node->right, nullptr);
+    ++length;
+  }
+  EXPECT_EQ(length, static_cast<size_t>(depth));
+  EXPECT_EQ(my_tree.deleteSubtree(copy), static_cast<size_t>(depth));
+  EXPECT_EQ(my_tree.deleteSubtree(top), static_cast<size_t>(depth));
+  EXPECT_EQ(my_tree.deleteSubtree(nullptr), 0);
+}
+
+// Копия повторяет форму и цвета исходного дерева
+TEST_F(RBTreeTest, CopyKeepsShapeAndColors) {
+  std::mt19937 gen(22);
+  for (int i = 0; i < 5000; ++i) my_tree.insert(gen() % 20000, 'a');
+  TestTree copy(my_tree);
+  std::vector<std::pair<const TestTree::RBTreeNode*,
+                        const TestTree::RBTreeNode*>>
+      pending{{my_tree.GetRoot(), copy.GetRoot()}};
+  while (!pending.empty()) {
+    auto [ours, theirs] = pending.back();
+    pending.pop_back();
+    ASSERT_EQ(ours == nullptr, theirs == nullptr);
+    if (ours == nullptr) continue;
+    ASSERT_NE(ours, theirs);
+    ASSERT_EQ(ours->key(), theirs->key());
+    ASSERT_EQ(ours->color, theirs->color);
+    pending.push_back({ours->left, theirs->left});
+    pending.push_back({ours->right, theirs->right});
+  }
+  EXPECT_EQ(copy.size(), my_tree.size());
+}
+
+namespace {
+
+/// @brief Элемент, копирование которого бросает исключение по счетчику
+struct FragileValue {
+  static int live;
+  static int copiesLeft;
+  FragileValue() { ++live; }
+  FragileValue(const FragileValue&) {
+    if (--copiesLeft < 0) throw std::runtime_error("copy failed");
+    ++live;
+  }
+  ~FragileValue() { --live; }
+};
+int FragileValue::live = 0;
+int FragileValue::copiesLeft = 0;
+
+}  // namespace
+
+// Исключение при копировании любого элемента не оставляет созданных узлов
+// и не трогает исходное дерево
+TEST(RBTreeCopyTest, ThrowingCopyReleasesPartialTree) {
+  using Tree = s21::RBTree<int, FragileValue>;
+  {
+    Tree tree;
+    FragileValue::copiesLeft = 100;
+    for (int i = 0; i < 100; ++i) tree.insert(i, FragileValue());
+    ASSERT_EQ(FragileValue::live, 100);
+    for (int limit = 0; limit < 100; ++limit) {
+      FragileValue::copiesLeft = limit;
+      EXPECT_THROW(Tree copy(tree), std::runtime_error);
+      EXPECT_EQ(FragileValue::live, 100) << limit;
+    }
+    EXPECT_EQ(tree.size(), 100);
+    EXPECT_EQ(std::distance(tree.begin(), tree.end()), 100);
+    FragileValue::copiesLeft = 100;
+    Tree copy(tree);
+    EXPECT_EQ(FragileValue::live, 200);
+  }
+  EXPECT_EQ(FragileValue::live, 0);
+}
+
+using CompactBase = s21::RBTree<int, char, std::less<int>,
+                                std::allocator<std::pair<const int, char>>,
+                                s21::CompactTreePolicy>;
+
+class CompactTree : public CompactBase {
+ public:
+  using RBTree::RBTree;
+  CompactTree(CompactBase&& other) : CompactBase(std::move(other)) {}
+  using RBTree::GetHeader;
+  using RBTree::GetRoot;
+};
+
+// Черная высота поддерева; нарушение свойств красно-черного дерева
+// или связи с родителем отмечается неудачей теста
+static int CheckCompactNode(const CompactTree::RBTreeNode* node,
+                            const CompactTree::RBTreeNode* parent) {
+  if (node == nullptr) return 1;
+  EXPECT_EQ(node->getParent(), parent);
+  if (node->getColor() == s21::RED && node->left != nullptr) {
+    EXPECT_EQ(node->left->getColor(), s21::BLACK);
+  }
+  if (node->getColor() == s21::RED && node->right != nullptr) {
+    EXPECT_EQ(node->right->getColor(), s21::BLACK);
+  }
+  int left = CheckCompactNode(node->left, node);
+  int right = CheckCompactNode(node->right, node);
+  EXPECT_EQ(left, right);
+  return left + (node->getColor() == s21::BLACK ? 1 : 0);
+}
+
+static void ExpectCompactValid(const CompactTree& tree,
+                               const std::set<int>& reference) {
+  const auto* root = tree.GetRoot();
+  if (root != nullptr) {
+    EXPECT_EQ(root->getColor(), s21::BLACK);
+    EXPECT_EQ(root->getParent(), tree.GetHeader());
+    CheckCompactNode(root, tree.GetHeader());
+  }
+  std::vector<int> keys;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it) {
+    keys.push_back((*it).first);
+  }
+  EXPECT_EQ(keys, std::vector<int>(reference.begin(), reference.end()));
+}
+
+// Цвет в бите указателя на родителя: узел меньше, а свойства дерева
+// сохраняются при вставках, удалениях, split, join и копировании
+TEST(CompactTreeTest, ChurnSplitJoinKeepsInvariants) {
+  EXPECT_LT(sizeof(CompactTree::RBTreeNode),
+            sizeof(s21::RBTree<int, char>::RBTreeNode));
+
+  std::mt19937 gen(22);
+  CompactTree tree;
+  std::set<int> reference;
+  for (int i = 0; i < 6000; ++i) {
+    int key = static_cast<int>(gen() % 1500);
+    if (gen() % 3 == 0) {
+      tree.remove(key);
+      reference.erase(key);
+    } else {
+      tree.insert(key, 'a');
+      reference.insert(key);
+    }
+  }
+  ExpectCompactValid(tree, reference);
+
+  CompactTree right = tree.split(750);
+  ExpectCompactValid(tree, {reference.begin(), reference.lower_bound(750)});
+  ExpectCompactValid(right, {reference.lower_bound(750), reference.end()});
+  tree.join(right);
+  ExpectCompactValid(tree, reference);
+
+  CompactTree copy(tree);
+  ExpectCompactValid(copy, reference);
+  CompactTree other{{1, 'b'}, {2000, 'b'}};
+  copy.set_intersection(other);
+  std::set<int> expected;
+  if (reference.count(1) != 0) expected.insert(1);
+  ExpectCompactValid(copy, expected);
+
+  for (int key : reference) tree.remove(key);
+  ExpectCompactValid(tree, {});
+}
+
+// Пакетный поиск в дереве, где ключи групп расходятся по разным ветвям
+TEST_F(RBTreeTest, FindManyMatchesFind) {
+  std::mt19937 gen(23);
+  for (int i = 0; i < 5000; ++i) {
+    my_tree.insert(static_cast<int>(gen() % 20000), 'a');
+  }
+  std::vector<int> keys(3001);
+  for (int& key : keys) key = static_cast<int>(gen() % 21000) - 500;
+  std::vector<TestTree::Iterator> found;
+  my_tree.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == my_tree.find(keys[i])) << keys[i];
+  }
+}
@@ -247,3 +247,91 @@ TEST_F(VectorTest, InsertManyBack) {
   EXPECT_EQ(vector1[7], 30);
   EXPECT_EQ(vector1.size(), 8);
 }
+
+// Аллокатор с общим счетчиком живых выделений
+template <typename T>
+struct TrackingAllocator {
+  using value_type = T;
+  int *live;
+
+  explicit TrackingAllocator(int *counter) : live(counter) {}
+  template <typename U>
+  TrackingAllocator(const TrackingAllocator<U> &other) : live(other.live) {}
+
+  T *allocate(size_t n) {
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --*live;
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  bool operator==(const TrackingAllocator<U> &other) const {
+    return live == other.live;
+  }
+  template <typename U>
+  bool operator!=(const TrackingAllocator<U> &other) const {
+    return live != other.live;
+  }
+};
+
+// Вектор выделяет и освобождает память только через свой аллокатор
+TEST(AllocatorVectorTest, TrackingAllocator) {
+  int live = 0;
+  {
+    s21::vector<int, TrackingAllocator<int>> v{TrackingAllocator<int>(&live)};
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    EXPECT_EQ(live, 1);
+    s21::vector<int, TrackingAllocator<int>> copy(v);
+    EXPECT_EQ(live, 2);
+    EXPECT_EQ(copy[99], 99);
+    v.shrink_to_fit();
+    EXPECT_EQ(live, 2);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// Вектор строк на монотонном буфере
+TEST(AllocatorVectorTest, PmrVector) {
+  std::pmr::monotonic_buffer_resource buffer;
+  s21::pmr::vector<std::pmr::string> v(&buffer);
+  EXPECT_EQ(v.get_allocator().resource(), &buffer);
+  v.push_back(std::pmr::string("element that does not fit into SSO"));
+  v.push_back(std::pmr::string("x"));
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0].get_allocator().resource(), &buffer);
+  EXPECT_EQ(v[1], "x");
+}
+
+// Конструкторы с аллокатором размещают элементы в заданном ресурсе
+TEST(AllocatorVectorTest, AllocatorExtendedConstructors) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource second_pool;
+  s21::pmr::vector<int> sized(3, &first_pool);
+  s21::pmr::vector<int> filled(4, 7, &first_pool);
+  s21::pmr::vector<int> listed({1, 2, 3}, &first_pool);
+  EXPECT_EQ(sized.get_allocator().resource(), &first_pool);
+  EXPECT_EQ(sized.size(), 3);
+  EXPECT_EQ(sized[2], 0);
+  EXPECT_EQ(filled.size(), 4);
+  EXPECT_EQ(filled[3], 7);
+  EXPECT_EQ(listed.get_allocator().resource(), &first_pool);
+  EXPECT_EQ(listed[1], 2);
+
+  s21::pmr::vector<int> copy(listed, &second_pool);
+  EXPECT_EQ(copy.get_allocator().resource(), &second_pool);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy[2], 3);
+
+  const int *data = filled.data();
+  s21::pmr::vector<int> same(std::move(filled), &first_pool);
+  EXPECT_EQ(same.data(), data);
+  EXPECT_TRUE(filled.empty());
+  s21::pmr::vector<int> other(std::move(same), &second_pool);
+  EXPECT_EQ(other.get_allocator().resource(), &second_pool);
+  EXPECT_NE(other.data(), data);
+  EXPECT_EQ(other.size(), 4);
+  EXPECT_EQ(other[0], 7);
+  EXPECT_TRUE(same.empty());
+}
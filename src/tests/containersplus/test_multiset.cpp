@@ -1,5 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #include "../../s21_containersplus.h"
 
 class MultisetTest : public ::testing::Test {
@@ -294,3 +303,239 @@ TEST_F(MultisetTest, InsertManyReturnValues) {
     EXPECT_TRUE(res.second);
   }
 }
+
+template <typename T>
+using PooledMultiset =
+    s21::multiset<T, std::less<T>, std::allocator<T>, s21::PooledTreePolicy>;
+
+// Проверка обхода в обратном порядке от end() с дубликатами
+TEST_F(MultisetTest, DecrementFromEnd) {
+  int expected[] = {5, 5, 4, 3, 2, 2, 2, 1, 1};
+  auto it = sorted_test.end();
+  for (int value : expected) {
+    --it;
+    EXPECT_EQ(*it, value);
+  }
+  EXPECT_EQ(it, sorted_test.begin());
+}
+
+// Проверка мультимножества с пулом узлов
+TEST(PooledMultisetTest, InsertEraseClear) {
+  PooledMultiset<int> ms;
+  for (int i = 0; i < 300; ++i) ms.insert(i % 30);
+  EXPECT_EQ(ms.size(), 300);
+  EXPECT_EQ(ms.count(7), 10);
+
+  ms.erase(ms.find(7));
+  EXPECT_EQ(ms.count(7), 9);
+
+  PooledMultiset<int> copy(ms);
+  ms.clear();
+  EXPECT_TRUE(ms.empty());
+  EXPECT_EQ(copy.size(), 299);
+  ms.insert(5);
+  EXPECT_EQ(ms.count(5), 1);
+}
+
+// Мультимножество на монотонном буфере
+TEST(PmrMultisetTest, MonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource buffer;
+  s21::pmr::multiset<int> ms(&buffer);
+  EXPECT_EQ(ms.get_allocator().resource(), &buffer);
+  for (int i = 0; i < 100; ++i) ms.insert(i % 10);
+  EXPECT_EQ(ms.size(), 100);
+  EXPECT_EQ(ms.count(3), 10);
+  s21::pmr::multiset<int> copy(ms);
+  EXPECT_EQ(copy.size(), 100);
+}
+
+// Копирование и перемещение в мультимножество с заданным ресурсом
+TEST(PmrMultisetTest, AllocatorExtendedConstructors) {
+  std::pmr::monotonic_buffer_resource first_pool;
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::multiset<int> ms(&first_pool);
+  for (int i = 0; i < 100; ++i) ms.insert(i % 10);
+  s21::pmr::multiset<int> copy(ms, &arena);
+  EXPECT_EQ(copy.get_allocator().resource(), &arena);
+  EXPECT_EQ(copy.size(), 100);
+  EXPECT_EQ(copy.count(4), 10);
+
+  s21::pmr::multiset<int> moved(std::move(ms), &arena);
+  EXPECT_EQ(moved.get_allocator().resource(), &arena);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(moved.count(9), 10);
+  EXPECT_TRUE(ms.empty());
+  EXPECT_EQ(ms.size(), 0);
+}
+
+// Мультимножество с обратным порядком и прозрачным поиском
+TEST(MultisetCompareTest, CustomAndTransparentComparator) {
+  s21::multiset<int, std::greater<int>> desc({1, 3, 3, 2});
+  EXPECT_EQ(*desc.begin(), 3);
+  EXPECT_EQ(desc.count(3), 2);
+  EXPECT_EQ(*desc.lower_bound(2), 2);
+  EXPECT_EQ(*desc.upper_bound(3), 2);
+
+  s21::multiset<std::string, std::less<>> words({"b", "a", "b"});
+  EXPECT_EQ(words.count("b"), 2);
+  EXPECT_TRUE(words.contains(std::string_view("a")));
+  EXPECT_EQ(*words.find("a"), "a");
+}
+
+// Порядковая статистика мультимножества учитывает дубликаты
+TEST(MultisetOrderStatisticTest, NthAndRankCountDuplicates) {
+  s21::multiset<int, std::less<int>, std::allocator<int>,
+                s21::OrderStatisticTreePolicy>
+      ms;
+  std::multiset<int> reference;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 2000; ++i) {
+    int key = static_cast<int>(gen() % 50);
+    if (gen() % 4) {
+      ms.insert(key);
+      reference.insert(key);
+    } else if (ms.contains(key)) {
+      ms.erase(ms.find(key));
+      reference.erase(reference.find(key));
+    }
+  }
+  ASSERT_EQ(ms.size(), reference.size());
+  size_t k = 0;
+  for (auto it = ms.begin(); it != ms.end(); ++it, ++k) {
+    ASSERT_EQ(*ms.nth(k), *it);
+    ASSERT_EQ(ms.nth(k), it);
+    ASSERT_EQ(it - ms.begin(), static_cast<std::ptrdiff_t>(k));
+  }
+  EXPECT_EQ(ms.nth(k), ms.end());
+  for (int key = 0; key <= 50; ++key) {
+    auto first = reference.lower_bound(key);
+    EXPECT_EQ(ms.rank(key), static_cast<size_t>(
+                                std::distance(reference.begin(), first)));
+  }
+  EXPECT_EQ(ms.cend() - ms.cbegin(),
+            static_cast<std::ptrdiff_t>(reference.size()));
+}
+
+// Границы мультимножества охватывают все копии ключа
+TEST(MultisetBoundsTest, BoundsCoverAllCopies) {
+  s21::multiset<int> ms({4, 1, 4, 2, 4, 9});
+  auto range = ms.equal_range(4);
+  int copies = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(*it, 4);
+    ++copies;
+  }
+  EXPECT_EQ(copies, 3);
+  EXPECT_EQ(*range.second, 9);
+  EXPECT_EQ(*ms.lower_bound(3), 4);
+  EXPECT_EQ(ms.upper_bound(9), ms.end());
+
+  const auto &view = ms;
+  EXPECT_EQ(*view.lower_bound(2), 2);
+  EXPECT_EQ(*view.upper_bound(2), 4);
+  auto missing = view.equal_range(5);
+  EXPECT_EQ(*missing.first, 9);
+  EXPECT_EQ(missing.first, missing.second);
+
+  s21::multiset<std::string, std::less<>> words({"b", "a", "b", "c"});
+  auto bs = words.equal_range(std::string_view("b"));
+  EXPECT_EQ(*bs.first, "b");
+  EXPECT_EQ(*bs.second, "c");
+  EXPECT_EQ(*words.upper_bound(std::string_view("a")), "b");
+}
+
+// Разделение мультимножества не разбивает копии, соединение их сливает
+TEST(MultisetSplitJoinTest, SplitAndJoinCountCopies) {
+  s21::multiset<int> ms({1, 2, 2, 3, 3, 3, 4, 5, 5});
+  auto right = ms.split(3);
+  EXPECT_EQ(ms.size(), 3);
+  EXPECT_EQ(right.size(), 6);
+  EXPECT_EQ(right.count(3), 3);
+  EXPECT_EQ(ms.count(3), 0);
+
+  auto tail = right.split(5);
+  ms.join(3, right);
+  EXPECT_EQ(ms.size(), 8);
+  EXPECT_EQ(ms.count(3), 4);
+  EXPECT_TRUE(right.empty());
+
+  s21::multiset<int> more({5, 6});
+  tail.join(more);
+  EXPECT_EQ(tail.count(5), 3);
+  EXPECT_THROW(tail.join(4, ms), std::invalid_argument);
+  ms.join(tail);
+  EXPECT_EQ(ms.size(), 12);
+  EXPECT_EQ(*--ms.end(), 6);
+
+  s21::multiset<int, std::less<int>, std::allocator<int>,
+                s21::OrderStatisticTreePolicy>
+      ranked({1, 1, 2, 7, 7, 7, 9});
+  auto upper = ranked.split(7);
+  EXPECT_EQ(ranked.size(), 3);
+  EXPECT_EQ(upper.size(), 4);
+  EXPECT_EQ(*upper.nth(2), 7);
+  EXPECT_EQ(upper.rank(9), 3);
+}
+
+// Разрезание по ключу корня не оставляет красный корень у частей
+TEST(MultisetSplitJoinTest, SplitAtRootKeepsReverseTraversal) {
+  for (int key = 1; key <= 8; ++key) {
+    s21::multiset<int> ms;
+    for (int i = 1; i <= 8; ++i) ms.insert(i);
+    auto right = ms.split(key);
+    std::vector<int> keys;
+    for (auto it = ms.end(); it != ms.begin();) keys.push_back(*--it);
+    std::vector<int> expected;
+    for (int i = key - 1; i >= 1; --i) expected.push_back(i);
+    EXPECT_EQ(keys, expected) << key;
+    EXPECT_EQ(*--right.end(), 8);
+
+    ms.insert(0);
+    keys.clear();
+    for (auto it = ms.end(); it != ms.begin();) keys.push_back(*--it);
+    expected.push_back(0);
+    EXPECT_EQ(keys, expected) << key;
+  }
+}
+
+// Вставка по подсказке добавляет копии и новые ключи
+TEST(MultisetHintTest, InsertAndEmplaceHint) {
+  s21::multiset<std::string> words;
+  for (const char *word : {"ant", "ant", "bee", "cat", "cat", "cat"}) {
+    EXPECT_EQ(*words.insert(words.end(), word), word);
+  }
+  EXPECT_EQ(words.size(), 6);
+  EXPECT_EQ(words.count("cat"), 3);
+  EXPECT_EQ(*words.emplace_hint(words.begin(), 3, 'a'), "aaa");
+  EXPECT_EQ(*words.emplace_hint(words.find("bee"), "bee"), "bee");
+  EXPECT_EQ(words.size(), 8);
+  EXPECT_EQ(words.count("bee"), 2);
+  EXPECT_EQ(*words.begin(), "aaa");
+
+  s21::multiset<int, std::less<int>, std::allocator<int>,
+                s21::OrderStatisticTreePolicy>
+      ranked;
+  for (int i = 0; i < 50; ++i) ranked.insert(ranked.cend(), i / 5);
+  EXPECT_EQ(ranked.size(), 50);
+  EXPECT_EQ(*ranked.nth(27), 5);
+  EXPECT_EQ(ranked.rank(7), 35);
+}
+
+// Обратный обход проходит все копии ключей от больших к меньшим
+TEST(MultisetReverseIteratorTest, ReverseTraversalWithCopies) {
+  using Multiset = s21::multiset<int>;
+  EXPECT_TRUE((std::is_same_v<
+               std::iterator_traits<Multiset::iterator>::iterator_category,
+               std::bidirectional_iterator_tag>));
+  EXPECT_TRUE((std::is_same_v<decltype(*std::declval<Multiset::iterator>()),
+                              const int &>));
+  Multiset values{3, 1, 3, 2, 3, 1};
+  std::vector<int> reversed(values.rbegin(), values.rend());
+  EXPECT_EQ(reversed, (std::vector<int>{3, 3, 3, 2, 1, 1}));
+  EXPECT_EQ(*std::prev(values.end()), 3);
+  EXPECT_EQ(*std::prev(values.end(), 4), 2);
+  const Multiset &view = values;
+  EXPECT_TRUE(std::equal(view.crbegin(), view.crend(), reversed.begin()));
+  EXPECT_EQ(std::count(view.rbegin(), view.rend(), 3), 3);
+  EXPECT_EQ(&*values.begin(), &*view.begin());
+}